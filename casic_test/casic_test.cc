@@ -0,0 +1,232 @@
+// Test of the CASIC receiver and of GPS_Position::ReadCASIC() on synthesized streams.
+// A one-hour flight is made into NAV-PV + NAV-TIMEUTC frames, mixed with some NMEA (as the GPS sends before it is configured)
+// and noise, then cut into blocks of random size and taken through the same dispatch as GPS_Process() in the firmware.
+// Every frame must come out with the position, time and velocity it was made of, corrupted frames must be dropped.
+// Then the UART payload per second and the interpretation time are compared with the NMEA the GPS would send instead.
+// Last, CASIC_Watch must fall back on a NAK for CFG-MSG or after MaxMiss bursts without NAV-PV, but not on fewer lost frames.
+
+// make casic_test && ./casic_test
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "fifo.h"
+#include "ogn.h"
+
+static double getTime(void)
+{ struct timespec Now; clock_gettime(CLOCK_MONOTONIC, &Now);
+  return Now.tv_sec+1e-9*Now.tv_nsec; }
+
+static uint32_t Rand=12345;
+static uint32_t getRand(void) { Rand^=Rand<<13; Rand^=Rand>>17; Rand^=Rand<<5; return Rand; }
+
+static uint8_t *Stream; static size_t StreamLen;
+static void StreamByte(char Byte) { Stream[StreamLen++]=Byte; }
+
+class Epoch                                        // what is sent in one second
+{ public:
+   double Lat, Lon;                                // [deg]
+   float  Alt, Geoid;                              // [m]
+   float  Speed, Heading;                          // [m/s] [deg]
+   uint8_t Hour, Min, Sec, Sats;
+   float  PDOP;
+} ;
+
+static void makeEpoch(Epoch &Pos, int Time)        // a glider circling and drifting
+{ double Phase=Time*2*M_PI/25;
+  Pos.Lat = 45.5+0.001*Time/60+0.0005*sin(Phase);
+  Pos.Lon = -14.25+0.0007*cos(Phase);              // west: negative longitude
+  Pos.Alt = 800.0f+0.7f*(Time%600);
+  Pos.Geoid = 45.2f;
+  Pos.Speed = 22.0f+3.0f*(float)sin(Phase/3);
+  Pos.Heading = fmod(Time*360.0/25+90, 360.0);
+  Pos.Hour = 10+Time/3600; Pos.Min=(Time/60)%60; Pos.Sec=Time%60;
+  Pos.Sats = 7+(Time/100)%6;
+  Pos.PDOP = 1.2f+0.1f*(Time%7); }
+
+static void sendCASIC(const Epoch &Pos, uint32_t RunTime, bool Corrupt)
+{ CASIC_NAV_PV PV; memset(&PV, 0, sizeof(PV));
+  PV.runTime=RunTime; PV.posValid=7; PV.velValid=7; PV.system=3; PV.numSV=Pos.Sats;
+  PV.pDop=Pos.PDOP; PV.lat=Pos.Lat; PV.lon=Pos.Lon;
+  PV.height=Pos.Alt+Pos.Geoid; PV.sepGeoid=Pos.Geoid;
+  PV.speed2D=Pos.Speed; PV.heading=Pos.Heading;
+  size_t Start=StreamLen;
+  CASIC_RxMsg::Send(0x01, 0x03, StreamByte, (const uint8_t *)&PV, sizeof(PV));
+  if(Corrupt) Stream[Start+6+(getRand()%sizeof(PV))]^=1<<(getRand()%8);
+  CASIC_NAV_TIMEUTC UTC; memset(&UTC, 0, sizeof(UTC));
+  UTC.runTime=RunTime; UTC.year=2026; UTC.month=10; UTC.day=17;
+  UTC.hour=Pos.Hour; UTC.min=Pos.Min; UTC.sec=Pos.Sec; UTC.valid=1;
+  CASIC_RxMsg::Send(0x01, 0x10, StreamByte, (const uint8_t *)&UTC, sizeof(UTC)); }
+
+static int Sentence(char *Out, const char *Body)   // add '$', check-sum and CR/LF
+{ int Len=sprintf(Out, "$%s", Body);
+  return Len+NMEA_AppendCheckCRNL(Out, Len); }
+
+static size_t makeNMEA(char *Out, const Epoch &Pos) // the same epoch as the NMEA the GPS sends by default
+{ char Body[128]; size_t Len=0;
+  double Lat=fabs(Pos.Lat), Lon=fabs(Pos.Lon);
+  int LatDeg=(int)Lat, LonDeg=(int)Lon;
+  double LatMin=(Lat-LatDeg)*60, LonMin=(Lon-LonDeg)*60;
+  char LatSign = Pos.Lat<0 ? 'S':'N', LonSign = Pos.Lon<0 ? 'W':'E';
+  sprintf(Body, "GNGGA,%02d%02d%02d.000,%02d%07.4f,%c,%03d%07.4f,%c,1,%02d,%3.1f,%3.1f,M,%3.1f,M,,",
+          Pos.Hour, Pos.Min, Pos.Sec, LatDeg, LatMin, LatSign, LonDeg, LonMin, LonSign, Pos.Sats, Pos.PDOP, Pos.Alt, Pos.Geoid);
+  Len+=Sentence(Out+Len, Body);
+  sprintf(Body, "GNGLL,%02d%07.4f,%c,%03d%07.4f,%c,%02d%02d%02d.000,A,A", LatDeg, LatMin, LatSign, LonDeg, LonMin, LonSign, Pos.Hour, Pos.Min, Pos.Sec);
+  Len+=Sentence(Out+Len, Body);
+  sprintf(Body, "GPGSA,A,3,02,05,13,15,18,20,23,29,,,,,%3.1f,%3.1f,%3.1f", Pos.PDOP, Pos.PDOP, Pos.PDOP*1.5);
+  Len+=Sentence(Out+Len, Body);
+  Len+=Sentence(Out+Len, "BDGSA,A,3,07,10,13,,,,,,,,,,1.9,1.1,1.6");
+  for(int Pkt=1; Pkt<=3; Pkt++)
+  { sprintf(Body, "GPGSV,3,%d,11,%02d,45,120,33,%02d,30,200,28,%02d,15,300,,%02d,60,045,41", Pkt, Pkt*4, Pkt*4+1, Pkt*4+2, Pkt*4+3);
+    Len+=Sentence(Out+Len, Body); }
+  for(int Pkt=1; Pkt<=2; Pkt++)
+  { sprintf(Body, "BDGSV,2,%d,06,%02d,50,100,31,%02d,20,250,27,%02d,10,330,", Pkt, Pkt*3, Pkt*3+1, Pkt*3+2);
+    Len+=Sentence(Out+Len, Body); }
+  sprintf(Body, "GNRMC,%02d%02d%02d.000,A,%02d%07.4f,%c,%03d%07.4f,%c,%4.2f,%5.1f,171026,,,A",
+          Pos.Hour, Pos.Min, Pos.Sec, LatDeg, LatMin, LatSign, LonDeg, LonMin, LonSign, Pos.Speed/0.514444, Pos.Heading);
+  Len+=Sentence(Out+Len, Body);
+  sprintf(Body, "GNVTG,%5.1f,T,,M,%4.2f,N,%4.2f,K,A", Pos.Heading, Pos.Speed/0.514444, Pos.Speed*3.6);
+  Len+=Sentence(Out+Len, Body);
+  sprintf(Body, "GNZDA,%02d%02d%02d.000,17,10,2026,00,00", Pos.Hour, Pos.Min, Pos.Sec);
+  Len+=Sentence(Out+Len, Body);
+  return Len; }
+
+static NMEA_RxMsg  NMEA;
+static CASIC_RxMsg CASIC;
+static FIFO<uint8_t, 512> UART;
+static GPS_Position Pos;
+static int Frames=0, Sentences=0, Errors=0;
+static int Epochs=0;
+
+static bool Check(const Epoch &Ref)                 // the position read back must be what was sent
+{ bool OK=1;
+  if(abs(Pos.Latitude -(int32_t)lround(Ref.Lat*600000))>0) OK=0;
+  if(abs(Pos.Longitude-(int32_t)lround(Ref.Lon*600000))>0) OK=0;
+  if(abs(Pos.Altitude-(int32_t)lround(Ref.Alt*10))>1) OK=0;
+  if(Pos.GeoidSeparation!=(int16_t)lround(Ref.Geoid*10)) OK=0;
+  if(abs(Pos.Speed-(int16_t)lround(Ref.Speed*10))>1) OK=0;
+  int HeadErr=abs(Pos.Heading-(int16_t)lround(Ref.Heading*10)); if(HeadErr>1 && HeadErr<3599) OK=0;
+  if(Pos.Hour!=Ref.Hour || Pos.Min!=Ref.Min || Pos.Sec!=Ref.Sec || Pos.mSec!=0) OK=0;
+  if(Pos.Year!=26 || Pos.Month!=10 || Pos.Day!=17) OK=0;
+  if(Pos.Satellites!=Ref.Sats || Pos.FixMode!=3 || Pos.FixQuality!=1) OK=0;
+  if(Pos.PDOP!=(uint8_t)lround(Ref.PDOP*10)) OK=0;
+  if(!Pos.isValid()) OK=0;
+  if(!OK)
+  { printf("Epoch %02d:%02d:%02d: %d/%d %d/%d %d %d %d/%d %02d:%02d:%02d\n", Ref.Hour, Ref.Min, Ref.Sec,
+           Pos.Latitude, (int32_t)lround(Ref.Lat*600000), Pos.Longitude, (int32_t)lround(Ref.Lon*600000),
+           Pos.Altitude, Pos.Speed, Pos.Heading, (int)lround(Ref.Heading*10), Pos.Hour, Pos.Min, Pos.Sec); }
+  return OK; }
+
+static void Process(void)                           // same dispatch as GPS_Process() in the firmware
+{ for( ; ; )
+  { uint8_t *Block; size_t Len=UART.getReadBlock(Block); if(Len==0) break;
+    if(NMEA.isEmpty() && !CASIC.isLoading())
+    { size_t Skip=0;
+      while(Skip<Len && Block[Skip]!='$' && Block[Skip]!=CASIC_RxMsg::SyncL) Skip++;
+      if(Skip) { UART.flushReadBlock(Skip); continue; } }
+    if(CASIC.isLoading() || Block[0]==CASIC_RxMsg::SyncL)
+    { size_t Taken=CASIC.ProcessBlock(Block, Len);
+      if(CASIC.isComplete()) { Pos.ReadCASIC(CASIC); Frames++; CASIC.Clear(); }
+      UART.flushReadBlock(Taken); continue; }
+    size_t Taken=NMEA.ProcessBlock(Block, Len);
+    if(NMEA.isComplete()) { Pos.ReadNMEA(NMEA); Sentences++; NMEA.Clear(); }
+    UART.flushReadBlock(Taken); } }
+
+static void sendACK(bool Ack, uint8_t Class, uint8_t ID)  // answer of the GPS to a configuration message
+{ CASIC_ACK Msg; Msg.clsID=Class; Msg.msgID=ID; Msg.res=0;
+  CASIC_RxMsg::Send(0x05, Ack ? 0x01:0x00, StreamByte, (const uint8_t *)&Msg, sizeof(Msg)); }
+
+static bool WatchBurst(CASIC_Watch &Watch)          // pass the stream of one burst to the watch, return the failure state at the end of the burst
+{ CASIC_RxMsg Msg; Msg.Clear();
+  for(size_t Idx=0; Idx<StreamLen; )
+  { Idx+=Msg.ProcessBlock(Stream+Idx, StreamLen-Idx);
+    if(Msg.isComplete()) { Watch.Process(Msg); Msg.Clear(); } }
+  StreamLen=0;
+  return Watch.BurstEnd(); }
+
+static int TestWatch(void)                          // fallback to NMEA: NAK, no NAV-PV, but not on a few lost frames
+{ int Err=0; CASIC_Watch Watch; Epoch Ref;
+  StreamLen=0; sendACK(1, 0x06, 0x01); sendACK(1, 0x06, 0x01); // the GPS takes the configuration
+  for(int Time=0; Time<3600; Time++)
+  { makeEpoch(Ref, Time);
+    bool Lost = (Time%100)>=100-(CASIC_Watch::MaxMiss-1);      // up to MaxMiss-1 bursts in a row without NAV-PV
+    if(!Lost) sendCASIC(Ref, Time*1000, (Time%100)<50 && (getRand()%50)==0);  // corrupted frames count as missed too
+    if(WatchBurst(Watch)) { printf("Watch: failed at %d s with NAV-PV coming\n", Time); Err++; break; } }
+  if(Watch.ACK!=2 || Watch.NAK!=0) { printf("Watch: ACK/NAK %d/%d, expected 2/0\n", Watch.ACK, Watch.NAK); Err++; }
+
+  Watch.Start();                                               // the GPS refuses CFG-MSG: fallback at the end of that burst
+  sendACK(0, 0x06, 0x01); sendACK(1, 0x06, 0x00);              // NAK for CFG-MSG, ACK for another message does not count
+  if(!WatchBurst(Watch) || Watch.NAK!=1 || Watch.ACK!=2) { printf("Watch: NAK not taken\n"); Err++; }
+
+  Watch.Start();                                               // the GPS ignores CFG-MSG: only NMEA comes
+  int Bursts=0;
+  for( ; Bursts<20; )
+  { StreamLen+=makeNMEA((char *)Stream+StreamLen, Ref); Bursts++;
+    if(WatchBurst(Watch)) break; }
+  if(Bursts!=CASIC_Watch::MaxMiss) { printf("Watch: fallback after %d bursts without NAV-PV, expected %d\n", Bursts, CASIC_Watch::MaxMiss); Err++; }
+  printf("Watch: ACK/NAK %d/%d, fallback on NAK and after %d bursts without NAV-PV, none on %d lost in a row => %s\n",
+         Watch.ACK, Watch.NAK, Bursts, CASIC_Watch::MaxMiss-1, Err ? "FAIL":"OK");
+  return Err; }
+
+int main(int argc, char *argv[])
+{ const int Seconds=3600;
+  Stream = (uint8_t *)malloc(1<<20);
+  char *NMEAlog = (char *)malloc(Seconds*1024); size_t NMEAlen=0;
+  int Corrupted=0; int Lost=0; int Mixed=0;
+  UART.Clear();
+  for(int Time=0; Time<Seconds; Time++)
+  { Epoch Ref; makeEpoch(Ref, Time);
+    NMEAlen+=makeNMEA(NMEAlog+NMEAlen, Ref);
+    StreamLen=0;
+    if(Time%100==50) { StreamLen+=makeNMEA((char *)Stream, Ref); Mixed++; }  // some NMEA from before the configuration
+    for(int Noise=getRand()%4; Noise; Noise--) Stream[StreamLen++]=getRand(); // and some noise
+    bool Corrupt = (getRand()%50)==0; Corrupted+=Corrupt;
+    sendCASIC(Ref, Time*1000, Corrupt);
+    int FramesBefore=Frames;
+    for(size_t Idx=0; Idx<StreamLen; )                          // drain in blocks of random size
+    { uint8_t *Block; size_t Space=UART.getWriteBlock(Block);
+      size_t Len=1+getRand()%48; if(Len>StreamLen-Idx) Len=StreamLen-Idx; if(Len>Space) Len=Space;
+      memcpy(Block, Stream+Idx, Len); UART.flushWriteBlock(Len); Idx+=Len;
+      Process(); }
+    int Got=Frames-FramesBefore;
+    if(Corrupt) { if(Got!=1) { printf("Corrupted frame at %d s: %d frames\n", Time, Got); Errors++; } continue; }
+    if(Got!=2) { Lost++; printf("Lost frames at %d s: %d\n", Time, Got); Errors++; continue; }
+    if(!Check(Ref)) Errors++;
+    Epochs++; }
+  printf("%d s: %d epochs checked, %d corrupted frames dropped, %d frames, %d NMEA sentences in %d mixed seconds, %d lost\n",
+         Seconds, Epochs, Corrupted, Frames, Sentences, Mixed, Lost);
+
+  StreamLen=0;                                                  // payload per second: binary against NMEA
+  for(int Time=0; Time<Seconds; Time++)
+  { Epoch Ref; makeEpoch(Ref, Time); sendCASIC(Ref, Time*1000, 0); }
+  size_t CASIClen=StreamLen;
+  printf("UART payload: NMEA %3.0f B/s, CASIC %3.0f B/s (%3.1fx less), at 115200bps: %3.1f ms against %3.1f ms per burst\n",
+         (double)NMEAlen/Seconds, (double)CASIClen/Seconds, (double)NMEAlen/CASIClen,
+         10e3*NMEAlen/Seconds/115200, 10e3*CASIClen/Seconds/115200);
+
+  const int Loops=20;                                           // interpretation time for the same epochs
+  double Start=getTime();
+  for(int Loop=0; Loop<Loops; Loop++)
+  { for(size_t Idx=0; Idx<NMEAlen; Idx++)
+    { NMEA.ProcessByte(NMEAlog[Idx]);
+      if(NMEA.isComplete()) { Pos.ReadNMEA(NMEA); NMEA.Clear(); } } }
+  double TimeNMEA=getTime()-Start;
+  Start=getTime();
+  for(int Loop=0; Loop<Loops; Loop++)
+  { for(size_t Idx=0; Idx<CASIClen; )
+    { Idx+=CASIC.ProcessBlock(Stream+Idx, CASIClen-Idx);
+      if(CASIC.isComplete()) { Pos.ReadCASIC(CASIC); CASIC.Clear(); } } }
+  double TimeCASIC=getTime()-Start;
+  printf("Interpretation: NMEA %5.2f us/s, CASIC %5.2f us/s (%3.1fx faster)\n",
+         1e6*TimeNMEA/Loops/Seconds, 1e6*TimeCASIC/Loops/Seconds, TimeNMEA/TimeCASIC);
+
+  Errors+=TestWatch();
+
+  free(NMEAlog); free(Stream);
+  if(Errors) { printf("%d errors !\n", Errors); return 1; }
+  printf("OK\n");
+  return 0; }
@@ -0,0 +1,82 @@
+// Stress test of the SPSC_FIFO: a producer thread and a consumer thread run at full speed, on separate cores when available.
+// Every element carries a sequence number and a payload derived from it, so torn or repeated elements are detected.
+// With a retrying producer nothing may be lost or dropped: every element written is received, the drop counters stay zero.
+// With the dropping policies the elements received plus the drop counters must account for all the elements written.
+
+// make fifo_stress && ./fifo_stress [elements]
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <thread>
+
+#include "fifo.h"
+
+struct Element                                             // about the size of a raw OGN frame
+{ uint32_t Seq;
+  uint32_t Payload[15];
+
+  void Set(uint32_t Value)
+  { Seq=Value;
+    for(int Idx=0; Idx<15; Idx++) Payload[Idx] = Value*0x9E3779B9 + Idx; }
+
+  bool Check(void) const
+  { for(int Idx=0; Idx<15; Idx++)
+      if(Payload[Idx] != Seq*0x9E3779B9 + Idx) return 0;
+    return 1; }
+} ;
+
+template <class FIFO_t>
+ static int Test(const char *Name, uint32_t Elements, bool Retry, uint32_t Pace=0) // Retry: the producer waits when the FIFO is full
+                                                                                  // Pace: the producer pauses at random, up to that many loops,
+                                                                                  // and yields every 64 elements: the consumer gets turns on a single core
+{ static FIFO_t FIFO; FIFO.Clear();
+  uint32_t Received=0, Torn=0, Order=0; bool Done=0;
+
+  std::thread Consumer([&]()
+  { Element Elem; uint32_t Next=0;
+    for( ; ; )
+    { if(!FIFO.Read(Elem))
+      { if(__atomic_load_n(&Done, __ATOMIC_ACQUIRE) && FIFO.isEmpty()) break;
+        std::this_thread::yield(); continue; }
+      if(!Elem.Check()) Torn++;
+      if(Elem.Seq<Next) Order++;                           // repeated or out of order
+      Next=Elem.Seq+1; Received++; }
+  } );
+
+  uint32_t Random=1;
+  for(uint32_t Seq=0; Seq<Elements; )                      // producer
+  { if(Pace)                                               // random pause: so the consumer catches up at times
+    { Random = Random*1103515245 + 12345;
+      for(volatile uint32_t Loop=(Random>>16)%Pace; Loop; Loop--);
+      if((Seq&63)==0) std::this_thread::yield(); }
+    if(Retry && FIFO.Full()>=FIFO_t::Len) { std::this_thread::yield(); continue; } // full: wait for the consumer, do not drop
+    Element *Elem=FIFO.getWrite();
+    if(Elem==0) { Seq++; continue; }                       // dropped (counted by the FIFO): give up on this one
+    Elem->Set(Seq++);
+    FIFO.Write(); }
+  __atomic_store_n(&Done, 1, __ATOMIC_RELEASE);
+  Consumer.join();
+
+  uint32_t Dropped = FIFO.DropNew+FIFO.DropOld;
+  bool OK = Torn==0 && Order==0;
+  if(Retry) OK = OK && Received==Elements && Dropped==0;  // lossless
+       else OK = OK && Received+Dropped==Elements;          // every element either received or counted as dropped
+  printf("%-30s %9u written, %9u received, %8u/%8u dropped new/old, HW:%2u, torn:%u, order:%u => %s\n",
+         Name, Elements, Received, FIFO.DropNew, FIFO.DropOld, FIFO.HighWater, Torn, Order, OK ? "OK":"FAIL");
+  return OK ? 0:1; }
+
+int main(int argc, char *argv[])
+{ uint32_t Elements = 1000000;
+  if(argc>1) Elements = atoi(argv[1]);
+  int Fail=0;
+  Fail+=Test< SPSC_FIFO<Element, 16, 0> >("drop-newest, retry:", Elements, 1);
+  Fail+=Test< SPSC_FIFO<Element,  4, 0> >("drop-newest, 4 slots, retry:", Elements, 1);
+  Fail+=Test< SPSC_FIFO<Element, 16, 0> >("drop-newest, retry, paced:", Elements, 1, 400);
+  Fail+=Test< SPSC_FIFO<Element, 16, 0> >("drop-newest:", Elements, 0);
+  Fail+=Test< SPSC_FIFO<Element, 16, 1> >("drop-oldest:", Elements, 0);
+  Fail+=Test< SPSC_FIFO<Element,  4, 1> >("drop-oldest, 4 slots:", Elements, 0);
+  Fail+=Test< SPSC_FIFO<Element, 16, 0> >("drop-newest, paced:", Elements, 0, 400);
+  Fail+=Test< SPSC_FIFO<Element, 16, 1> >("drop-oldest, paced:", Elements, 0, 400);
+  Fail+=Test< SPSC_FIFO<Element,  4, 1> >("drop-oldest, 4 slots, paced:", Elements, 0, 400);
+  return Fail; }
@@ -0,0 +1,106 @@
+// Compare the LDPC_FloatBatchDecoder against the LDPC_FloatDecoder: random n208k160 codewords are sent through AWGN,
+// decoded lane-by-lane with the scalar decoder and in batches with the vector decoder.
+// The decoded codewords and the iteration counts must be the same, reports the packets per second of both.
+
+// make ldpc_batch && ./ldpc_batch [EbN0] [batches]
+// AVX2 version: make ldpc_batch_avx2
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+
+#include "ldpc.h"
+
+// ======================================================================================================
+
+static double UniformNoise(void)
+{ return ((double)rand()+1.0)/((double)RAND_MAX+1.0); }
+
+static void WhiteNoise(double &I, double &Q)
+{ double Power,Phase;
+  Power=sqrt(-2*log(UniformNoise()));
+  Phase=2*M_PI*UniformNoise();
+  I=Power*cos(Phase);
+  Q=Power*sin(Phase); }
+
+static double CPU_Time(void) { return (double)clock()/CLOCKS_PER_SEC; }
+
+// ======================================================================================================
+
+typedef LDPC_FloatBatchDecoder BatchDecoder;
+const int Lanes = BatchDecoder::Lanes;
+
+int main(int argc, char *argv[])
+{ double EbN0 = 3.0;
+  int Batches = 10000;
+  if(argc>1) EbN0    = atof(argv[1]);
+  if(argc>2) Batches = atoi(argv[2]);
+
+  uint32_t ParityCheck[48][7];                             // packed parity check matrix
+  memset(ParityCheck, 0, sizeof(ParityCheck));
+  for(int Row=0; Row<48; Row++)
+  { const uint8_t *Index=LDPC_ParityCheckIndex_n208k160[Row];
+    for(int Idx=1; Idx<=Index[0]; Idx++)
+      ParityCheck[Row][Index[Idx]>>5] |= (uint32_t)1<<(Index[Idx]&31); }
+  static LDPC_FloatDecoder<float> Scalar;
+  static BatchDecoder Batch;
+  Scalar.Configure(208, 48, ParityCheck[0]);
+  Batch.Configure(208, 48, ParityCheck[0]);
+
+  double Eb = 2.0*208/160;                                 // two chips per code bit, code rate 160/208
+  double Sigma = sqrt(Eb/(2*pow(10, 0.1*EbN0)))/sqrt(2.0); // a soft bit is the difference of two chips
+  printf("LDPC_FloatBatchDecoder: %d lanes, Eb/N0=%3.1fdB, %d packets\n", Lanes, EbN0, Batches*Lanes);
+
+  static float Soft[LDPC_BATCH_LANES][208];
+  static uint8_t Tx[LDPC_BATCH_LANES][26];
+  int Mismatch=0, Fail=0, Wrong=0;
+  double ScalarTime=0, BatchTime=0;
+  srand(1);
+  for(int Run=0; Run<Batches; Run++)
+  { for(int Lane=0; Lane<Lanes; Lane++)                    // random codewords with noise
+    { uint32_t Data[7];
+      for(int Idx=0; Idx<5; Idx++)
+        Data[Idx] = ((uint32_t)rand()<<16) ^ rand();
+      LDPC_Encode(Data);
+      memcpy(Tx[Lane], Data, 26);
+      for(int Bit=0; Bit<208; Bit+=2)
+      { double I, Q; WhiteNoise(I, Q);
+        Soft[Lane][Bit  ] = (((Data[Bit>>5]>>(Bit&31))&1) ? +1.0:-1.0) + Sigma*I;
+        Soft[Lane][Bit+1] = (((Data[(Bit+1)>>5]>>((Bit+1)&31))&1) ? +1.0:-1.0) + Sigma*Q; }
+    }
+
+    int ScalarLoops[LDPC_BATCH_LANES];
+    uint8_t ScalarOut[LDPC_BATCH_LANES][26];
+    double Start=CPU_Time();
+    for(int Lane=0; Lane<Lanes; Lane++)                    // scalar decoder: one codeword after another
+    { for(int Bit=0; Bit<208; Bit++)
+      { Scalar.InpBit[Bit] = Scalar.OutBit[Bit] = Soft[Lane][Bit]; Scalar.ExtBit[Bit]=0; }
+      int Loops;
+      for(Loops=1; Loops<=32; Loops++)
+        if(Scalar.ProcessChecks()==0) break;
+      ScalarLoops[Lane]=Loops;
+      Scalar.Output(ScalarOut[Lane]); }
+    ScalarTime+=CPU_Time()-Start;
+
+    Start=CPU_Time();
+    for(int Lane=0; Lane<Lanes; Lane++)                    // batch decoder: all codewords in lockstep
+      Batch.Input(Lane, Soft[Lane]);
+    Batch.Decode(32);
+    BatchTime+=CPU_Time()-Start;
+
+    for(int Lane=0; Lane<Lanes; Lane++)
+    { uint8_t Out[26]; Batch.Output(Lane, Out);
+      if(memcmp(Out, ScalarOut[Lane], 26)!=0 || Batch.Loops[Lane]!=ScalarLoops[Lane])
+      { if(Mismatch<10) printf("Mismatch: batch %d lane %d: %d/%d iterations\n", Run, Lane, Batch.Loops[Lane], ScalarLoops[Lane]);
+        Mismatch++; }
+      if(Batch.Loops[Lane]>32) Fail++;
+      else if(memcmp(Out, Tx[Lane], 26)!=0) Wrong++; }
+  }
+  int Packets=Batches*Lanes;
+  printf("FER=%8.6f (wrong %d), mismatch %d\n", (double)(Fail+Wrong)/Packets, Wrong, Mismatch);
+  printf("Scalar: %8.0f pkt/s\n", ScalarTime>0 ? Packets/ScalarTime:0.0);
+  printf("Batch:  %8.0f pkt/s\n", BatchTime>0 ? Packets/BatchTime:0.0);
+  return Mismatch ? 1:0; }
@@ -0,0 +1,254 @@
+// Monte Carlo frame error rate of the OGN packet decoding: random OGN1_Packet are encoded with LDPC_Encode,
+// Manchester encoded, sent through AWGN, sliced into hard chips, Manchester decoded like in Radio_RxDone
+// and then decoded by RFM_FSK_RxPktData::Decode() (LDPC_Decoder) and by the LDPC_FloatDecoder (hard and soft input).
+// Reports FER versus Eb/N0, average iterations and decoded packets per second.
+
+// make ldpc_ber && ./ldpc_ber [EbN0 start] [EbN0 stop] [EbN0 step] [packets]
+// other decoder variants: make ldpc_ber_flood, make ldpc_ber_int8, make ldpc_ber_osd
+// make ldpc_ber_combine: every packet is also received as a relayed copy, frames where both copies fail are soft-combined
+// make ldpc_ber_combine_int8: the same with LDPC_DECODER_INT8, where the combined soft bits reach the decoder as sign or erasure only
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+
+#include "manchester.h"
+#include "ldpc.h"
+#include "rfm.h"
+#ifdef WITH_LDPC_OSD
+#include "ldpc_osd.h"
+#endif
+#ifdef WITH_LDPC_COMBINE
+#include "ldpc_combine.h"
+#endif
+
+// ======================================================================================================
+
+static double UniformNoise(void)
+{ return ((double)rand()+1.0)/((double)RAND_MAX+1.0); }
+
+static void WhiteNoise(double &I, double &Q)
+{ double Power,Phase;
+  Power=sqrt(-2*log(UniformNoise()));
+  Phase=2*M_PI*UniformNoise();
+  I=Power*cos(Phase);
+  Q=Power*sin(Phase); }
+
+template <class Float>
+ void AddWhiteNoise(Float *Signal, int Size, double Sigma=1.0)
+{ double I,Q; int Idx;
+  for(Idx=0; Idx<(Size-1); Idx+=2)
+  { WhiteNoise(I, Q);
+    Signal[Idx]+=Sigma*I;
+    Signal[Idx+1]+=Sigma*Q; }
+  if(Idx<Size)
+  { WhiteNoise(I, Q);
+    Signal[Idx]+=Sigma*I; }
+}
+
+// ======================================================================================================
+
+static void SetRandom(OGN_TxPacket<OGN1_Packet> &Packet)    // random OGN packet with the FEC
+{ uint8_t *Data=Packet.Packet.Byte();
+  for(int Idx=0; Idx<OGN1_Packet::Bytes; Idx++)
+    Data[Idx] = rand();
+  Packet.Packet.calcAddrParity();
+  Packet.calcFEC(); }
+
+const int PktBytes = 26;                                   // OGN packet with FEC
+const int ChipBytes = 2*PktBytes;                          // Manchester encoded: 52 bytes on air
+const int Chips = 8*ChipBytes;                             // 416 chips
+
+static void Modulate(float *Signal, const uint8_t *Data)   // Manchester encode like Transmit() and make +/-1 chips
+{ int Chip=0;
+  for(int Idx=0; Idx<PktBytes; Idx++)
+  { uint8_t Byte=Data[Idx];
+    uint8_t Manch[2] = { ManchesterEncode[Byte>>4], ManchesterEncode[Byte&0x0F] };
+    for(int Half=0; Half<2; Half++)
+    { for(int Bit=7; Bit>=0; Bit--)                       // MSB goes first on air
+        Signal[Chip++] = (Manch[Half]>>Bit)&1 ? +1.0:-1.0; }
+  }
+}
+
+static void Demodulate(RFM_FSK_RxPktData &RxPkt, const float *Signal) // hard slice the chips and Manchester decode like Radio_RxDone()
+{ uint8_t Packet[ChipBytes];
+  int Chip=0;
+  for(int Idx=0; Idx<ChipBytes; Idx++)
+  { uint8_t Byte=0;
+    for(int Bit=0; Bit<8; Bit++)
+    { Byte<<=1; if(Signal[Chip++]>0) Byte|=1; }
+    Packet[Idx]=Byte; }
+  RxPkt.Manchester(Packet);
+  RxPkt.Channel=0; RxPkt.RSSI=0; RxPkt.Time=0; RxPkt.msTime=0;
+}
+
+static void SoftBits(float *Bits, const float *Signal)     // soft bits from the chip pairs: what a soft demodulator could give
+{ int Chip=0;
+  for(int Idx=0; Idx<PktBytes; Idx++)
+  { for(int Bit=7; Bit>=0; Bit--)
+    { Bits[Idx*8+Bit] = Signal[Chip+1]-Signal[Chip];      // Manchester: 1 => 01 thus the 2nd chip is high
+      Chip+=2; }
+  }
+}
+
+// ======================================================================================================
+
+class DecoderStat                                          // FER, iterations and CPU time for one decoder
+{ public:
+   int    Frames;
+   int    Fail;                                            // decoder did not converge
+   int    Wrong;                                           // decoder converged to a wrong packet
+   long   Iter;
+   double Time;                                            // [sec]
+
+  public:
+   DecoderStat() { Clear(); }
+   void Clear(void) { Frames=0; Fail=0; Wrong=0; Iter=0; Time=0; }
+
+   void Add(int Loops, bool Failed, bool Bad, double CPU)
+   { Frames++; Iter+=Loops; Time+=CPU;
+     if(Failed) Fail++; else if(Bad) Wrong++; }
+
+   void Print(const char *Name) const
+   { printf(" %s: FER=%8.6f (wrong %d) %4.2fi %6.0f pkt/s", Name,
+            (double)(Fail+Wrong)/Frames, Wrong, (double)Iter/Frames, Time>0 ? Frames/Time:0.0); }
+} ;
+
+static double CPU_Time(void) { return (double)clock()/CLOCKS_PER_SEC; }
+
+int main(int argc, char *argv[])
+{ double EbN0_Start = 1.0, EbN0_Stop = 5.0, EbN0_Step = 0.5;
+  int Packets = 20000;
+  if(argc>1) EbN0_Start = atof(argv[1]);
+  if(argc>2) EbN0_Stop  = atof(argv[2]);
+  if(argc>3) EbN0_Step  = atof(argv[3]);
+  if(argc>4) Packets    = atoi(argv[4]);
+
+  static LDPC_Decoder Decoder;                             // the decoder used by the firmware
+  static LDPC_FloatDecoder<float> FloatDecoder;            // reference decoder
+  uint32_t ParityCheck[48][7];                             // packed parity check matrix for the FloatDecoder
+  memset(ParityCheck, 0, sizeof(ParityCheck));
+  for(int Row=0; Row<48; Row++)
+  { const uint8_t *Index=LDPC_ParityCheckIndex_n208k160[Row];
+    for(int Idx=1; Idx<=Index[0]; Idx++)
+      ParityCheck[Row][Index[Idx]>>5] |= (uint32_t)1<<(Index[Idx]&31); }
+  FloatDecoder.Configure(208, 48, ParityCheck[0]);
+#ifdef WITH_LDPC_OSD
+  static LDPC_OSD OSD;
+#endif
+#ifdef WITH_LDPC_COMBINE
+  static LDPC_Combiner<4> Combiner;
+#endif
+
+  printf("LDPC decoder: %s %s, %d bytes\n",
+#ifdef LDPC_DECODER_LAYERED
+         "layered",
+#else
+         "flooding",
+#endif
+#ifdef LDPC_DECODER_INT8
+         "int8",
+#else
+         "int16",
+#endif
+         (int)sizeof(Decoder));
+
+  srand(1);
+  for(double EbN0=EbN0_Start; EbN0<=EbN0_Stop+0.001; EbN0+=EbN0_Step)
+  { double Eb = 2.0*208/160;                               // energy per user bit: two chips per code bit, code rate 160/208
+    double Sigma = sqrt(Eb/(2*pow(10, 0.1*EbN0)));         // noise per chip, N0=2*Sigma^2
+    DecoderStat Stat, HardStat, SoftStat;
+#ifdef WITH_LDPC_OSD
+    int OSD_Rec=0, OSD_Wrong=0;                            // frames accepted by the OSD reliability test: correct and wrong
+#endif
+#ifdef WITH_LDPC_COMBINE
+    int BothFail=0, Comb_Rec=0, Comb_Wrong=0;              // both copies failed, recovered by combining: correctly and wrongly
+    int Comb_RecErr=0, Comb_WrongErr=0;                    // same, which also pass RxErr<10 against the summed soft bits like in the firmware
+#endif
+    Decoder.Stat.Clear();
+    for(int Pkt=0; Pkt<Packets; Pkt++)
+    { OGN_TxPacket<OGN1_Packet> TxPacket; SetRandom(TxPacket);
+      float Signal[Chips];
+      Modulate(Signal, TxPacket.Byte());
+      AddWhiteNoise(Signal, Chips, Sigma);
+      RFM_FSK_RxPktData RxPkt; Demodulate(RxPkt, Signal);
+
+      OGN_RxPacket<OGN1_Packet> RxPacket;                  // firmware decoder
+      uint32_t PrevIter=Decoder.Stat.IterSum;
+      double Start=CPU_Time();
+      int Err=RxPkt.Decode(RxPacket, Decoder);
+      double Time=CPU_Time()-Start;
+      bool Bad = memcmp(RxPacket.Byte(), TxPacket.Byte(), PktBytes)!=0;
+      Stat.Add(Decoder.Stat.IterSum-PrevIter, Err!=0, Bad, Time);
+#ifdef WITH_LDPC_OSD
+      if(Err)                                              // run the OSD on failed frames and accept like the firmware
+      { OSD.Input(Decoder);
+        while(OSD.isBusy()) OSD.Process();
+        if(OSD.State==LDPC_OSD::StateDone)
+        { OSD.Output(RxPacket.Byte());
+          uint8_t Erasures=RxPkt.ErrCount(), Flips=RxPkt.ErrCount(RxPacket.Byte());
+          if(RxPacket.Packet.goodAddrParity() && OSD.isReliable(Erasures, Flips))
+          { bool Good = memcmp(RxPacket.Byte(), TxPacket.Byte(), PktBytes)==0;
+            if(Good) OSD_Rec++; else OSD_Wrong++; }
+        }
+        OSD.Clear();
+      }
+#endif
+
+#ifdef WITH_LDPC_COMBINE
+      if(Err)                                              // the same packet relayed: another reception with independent noise
+      { OGN_TxPacket<OGN1_Packet> RelayPacket = TxPacket; RelayPacket.setRelay(1);
+        float RelaySignal[Chips];
+        Modulate(RelaySignal, RelayPacket.Byte());
+        AddWhiteNoise(RelaySignal, Chips, Sigma);
+        RFM_FSK_RxPktData RelayPkt; Demodulate(RelayPkt, RelaySignal);
+        OGN_RxPacket<OGN1_Packet> RelayRxPacket;
+        if(RelayPkt.Decode(RelayRxPacket, Decoder))
+        { BothFail++;
+          Combiner.Clear();
+          RxPkt.Time=Pkt; RelayPkt.Time=Pkt;
+          Combiner.Add(RxPkt.Data, RxPkt.Err, RxPkt.Time);
+          int8_t Idx=Combiner.Add(RelayPkt.Data, RelayPkt.Err, RelayPkt.Time);
+          if(Idx>=0 && Combiner.Copies[Idx]>1 && Combiner.Decode(Idx, Decoder, RelayRxPacket.Byte())==0 && RelayRxPacket.Packet.goodAddrParity())
+          { bool Good = memcmp(RelayRxPacket.Byte(), TxPacket.Byte(), PktBytes)==0 || memcmp(RelayRxPacket.Byte(), RelayPacket.Byte(), PktBytes)==0;
+            if(Good) Comb_Rec++; else Comb_Wrong++;
+            if(Combiner.ErrCount(Idx, RelayRxPacket.Byte())<10) { if(Good) Comb_RecErr++; else Comb_WrongErr++; } }
+        }
+      }
+#endif
+
+      uint8_t Out[PktBytes]; int Loops;                    // FloatDecoder on the same hard bits
+      Start=CPU_Time();
+      FloatDecoder.Input(RxPkt.Data, RxPkt.Err);
+      for(Loops=1; Loops<=32; Loops++)
+        if(FloatDecoder.ProcessChecks()==0) break;
+      Time=CPU_Time()-Start;
+      FloatDecoder.Output(Out);
+      HardStat.Add(Loops>32?32:Loops, Loops>32, memcmp(Out, TxPacket.Byte(), PktBytes)!=0, Time);
+
+      float Bits[208]; SoftBits(Bits, Signal);             // FloatDecoder on soft bits
+      Start=CPU_Time();
+      for(int Bit=0; Bit<208; Bit++)
+      { FloatDecoder.InpBit[Bit] = FloatDecoder.OutBit[Bit] = Bits[Bit]/(Sigma*Sigma); FloatDecoder.ExtBit[Bit]=0; }
+      for(Loops=1; Loops<=32; Loops++)
+        if(FloatDecoder.ProcessChecks()==0) break;
+      Time=CPU_Time()-Start;
+      FloatDecoder.Output(Out);
+      SoftStat.Add(Loops>32?32:Loops, Loops>32, memcmp(Out, TxPacket.Byte(), PktBytes)!=0, Time);
+    }
+    printf("Eb/N0=%4.1fdB", EbN0);
+    Stat.Print("Decoder");
+#ifdef WITH_LDPC_OSD
+    printf(" +OSD: %d (wrong %d, %.1e/frame)", OSD_Rec, OSD_Wrong, (double)OSD_Wrong/Packets);
+#endif
+#ifdef WITH_LDPC_COMBINE
+    printf(" both failed: %d combined: %d (wrong %d) RxErr<10: %d (wrong %d)", BothFail, Comb_Rec, Comb_Wrong, Comb_RecErr, Comb_WrongErr);
+#endif
+    HardStat.Print("Float/hard");
+    SoftStat.Print("Float/soft");
+    printf("\n");
+  }
+  return 0; }
@@ -0,0 +1,65 @@
+// Compare the table-driven LDPC encoders against the generator-matrix encoder:
+// check they produce the same parity and measure the encoding time.
+
+// make ldpc_encode_bench && ./ldpc_encode_bench
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#include "ldpc.h"
+
+static void SetRandom(uint32_t *Data, int Words)                    // random data words
+{ for(int Idx=0; Idx<Words; Idx++)
+    Data[Idx] = ((uint32_t)rand()<<16) ^ rand();
+}
+
+static int Compare(const uint32_t *Data)                            // encode with all encoders and compare the parity
+{ uint32_t Ref[2], Byte[2], Nibble[2], Bytes[2];
+  LDPC_Encode_ParityGen  (Data, Ref);
+  LDPC_Encode_ByteTable  (Data, Byte);
+  LDPC_Encode_NibbleTable(Data, Nibble);
+  memset(Bytes, 0, sizeof(Bytes));
+  LDPC_Encode((const uint8_t *)Data, (uint8_t *)Bytes);
+  int Err=0;
+  if(Byte[0]!=Ref[0]   || Byte[1]!=Ref[1]  ) Err|=1;
+  if(Nibble[0]!=Ref[0] || Nibble[1]!=Ref[1]) Err|=2;
+  if(Bytes[0]!=Ref[0]  || Bytes[1]!=Ref[1] ) Err|=4;
+  if(Err) printf("Mismatch %d: %08X %08X %08X %08X %08X => %08X %04X\n", Err, Data[0], Data[1], Data[2], Data[3], Data[4], Ref[0], Ref[1]);
+  return Err!=0; }
+
+const int Packets = 4096;                                           // number of random packets to encode
+const int Loops   =  256;                                           // encode all packets so many times
+
+static double Bench(const char *Name, void (*Encode)(const uint32_t *, uint32_t *), uint32_t (*Data)[7], uint32_t &Sum)
+{ clock_t Start=clock();
+  for(int Loop=0; Loop<Loops; Loop++)
+  { for(int Pkt=0; Pkt<Packets; Pkt++)
+    { Encode(Data[Pkt], Data[Pkt]+5); Sum+=Data[Pkt][5]; }
+  }
+  double Time = (double)(clock()-Start)/CLOCKS_PER_SEC;
+  double ns = 1e9*Time/(Loops*Packets);
+  printf("%-18s %7.1f ns/packet\n", Name, ns);
+  return ns; }
+
+int main(int argc, char *argv[])
+{ int Errors=0;
+  uint32_t Data[5];
+  for(int Bit=0; Bit<160; Bit++)                                    // every single data bit
+  { memset(Data, 0, sizeof(Data)); Data[Bit>>5] = (uint32_t)1<<(Bit&31);
+    Errors+=Compare(Data); }
+  for(int Test=0; Test<100000; Test++)                              // random data
+  { SetRandom(Data, 5); Errors+=Compare(Data); }
+  printf("%d mismatches\n", Errors);
+
+  static uint32_t Packet[Packets][7];
+  for(int Pkt=0; Pkt<Packets; Pkt++)
+    SetRandom(Packet[Pkt], 5);
+  uint32_t Sum=0;
+  double Ref = Bench("ParityGen",   LDPC_Encode_ParityGen,   Packet, Sum);
+  double Nib = Bench("NibbleTable", LDPC_Encode_NibbleTable, Packet, Sum);
+  double Byt = Bench("ByteTable",   LDPC_Encode_ByteTable,   Packet, Sum);
+  printf("Speed-up: nibble table x%3.1f, byte table x%3.1f (%08X)\n", Ref/Nib, Ref/Byt, Sum);
+  return Errors!=0; }
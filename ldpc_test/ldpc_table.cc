@@ -0,0 +1,49 @@
+// Produces the src/ldpc_table.cpp with the parity tables for the table-driven LDPC encoder of the n208k160 code
+// Every table entry is the parity (48 bits as 3x 16-bit words) of a single data byte or nibble at a given position:
+// the encoder then only needs to XOR 20 (byte) or 40 (nibble) table entries.
+
+// make ldpc_table && ./ldpc_table > ../src/ldpc_table.cpp
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "ldpc.h"
+
+static void Parity(uint16_t Par[3], const uint32_t Data[5])        // use the reference (generator matrix) encoder
+{ uint32_t Word[2];
+  LDPC_Encode_ParityGen(Data, Word);
+  Par[0]=Word[0]; Par[1]=Word[0]>>16; Par[2]=Word[1]; }
+
+static void PrintTable(int Positions, int Bits)                    // table for every data position of given width and every value
+{ int Values = 1<<Bits;
+  for(int Pos=0; Pos<Positions; Pos++)
+  { printf(" {  // %s %d\n", Bits==8?"byte":"nibble", Pos);
+    for(int Val=0; Val<Values; Val++)
+    { uint32_t Data[5]; memset(Data, 0, sizeof(Data));
+      int Bit=Pos*Bits;
+      Data[Bit>>5] = (uint32_t)Val<<(Bit&31);
+      uint16_t Par[3]; Parity(Par, Data);
+      if((Val&3)==0) printf("  ");
+      printf("{ 0x%04X, 0x%04X, 0x%04X }", Par[0], Par[1], Par[2]);
+      if(Val<(Values-1)) printf(",");
+      if((Val&3)==3) printf("\n"); else printf(" "); }
+    printf(" }%s\n", Pos<(Positions-1) ? ",":"");
+  }
+}
+
+int main(int argc, char *argv[])
+{ printf("// parity tables for the table-driven LDPC encoder of the n208k160 code\n");
+  printf("// produced by ldpc_test/ldpc_table.cc: do not edit\n\n");
+  printf("#include <stdint.h>\n\n#include \"ldpc.h\"\n\n");
+  printf("#ifdef LDPC_ENCODE_BYTE_TABLE\n");
+  printf("// parity of every data byte value at every of the 20 byte positions\n");
+  printf("const uint16_t LDPC_ParityByte_n208k160[20][256][3] = {\n");
+  PrintTable(20, 8);
+  printf("} ;\n#endif // LDPC_ENCODE_BYTE_TABLE\n\n");
+  printf("#ifdef LDPC_ENCODE_NIBBLE_TABLE\n");
+  printf("// parity of every nibble value at every of the 40 nibble positions\n");
+  printf("const uint16_t LDPC_ParityNibble_n208k160[40][16][3] = {\n");
+  PrintTable(40, 4);
+  printf("} ;\n#endif // LDPC_ENCODE_NIBBLE_TABLE\n");
+  return 0; }
@@ -0,0 +1,50 @@
+// Benchmark of the LookOut collision prediction: one round over 64 targets, as done once per second by the tracker.
+// Targets spread over a few km (most are skipped by the range check) and all close (every target extrapolated: worst case).
+
+// make lookout_bench && ./lookout_bench [rounds]
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "lookout.h"
+
+static uint32_t Random=1;
+static uint32_t Rand(void) { Random ^= Random<<13; Random ^= Random>>17; Random ^= Random<<5; return Random; }
+static int32_t  Rand(int32_t Min, int32_t Max) { return Min + (int32_t)(Rand()%(uint32_t)(Max-Min+1)); }
+
+static double getTime(void)
+{ struct timespec Now; clock_gettime(CLOCK_MONOTONIC, &Now);
+  return Now.tv_sec + 1e-9*Now.tv_nsec; }
+
+struct Target { int32_t East, North, Up; int16_t Speed, Heading, Climb, Turn, Age; } ;
+
+template <uint8_t Targets>
+ static void Bench(const char *Name, int32_t Spread, int Rounds, uint8_t Horizon)
+{ static LookOut<Targets> Engine; Engine.Horizon=Horizon;
+  static Target Tgt[Targets];
+  for(int Idx=0; Idx<Targets; Idx++)
+  { Target &T=Tgt[Idx];
+    T.East=Rand(-Spread, Spread); T.North=Rand(-Spread, Spread); T.Up=Rand(-300, 300);
+    T.Speed=Rand(0, 600); T.Heading=Rand(0, 3599); T.Climb=Rand(-50, 50); T.Turn=Rand(-200, 200); T.Age=Rand(0, 1500); }
+  uint32_t Warn=0, Steps=0;
+  double Start=getTime();
+  for(int Round=0; Round<Rounds; Round++)
+  { Engine.setOwn(Rand(0, 600), Rand(0, 3599), Rand(-50, 50), Rand(-200, 200));
+    for(int Idx=0; Idx<Targets; Idx++)
+    { const Target &T=Tgt[Idx];
+      if(Engine.addTarget(Idx, T.East, T.North, T.Up, T.Speed, T.Heading, T.Climb, T.Turn, T.Age)>0) Warn++; }
+    Steps+=Engine.Steps; }
+  double Time=getTime()-Start;
+  printf("%-24s %2d targets, %2ds horizon: %6.2f us/round, %5.1f ns/target, %5.1f steps/target, %4.1f%% warnings\n",
+         Name, Targets, Horizon, 1e6*Time/Rounds, 1e9*Time/Rounds/Targets, (double)Steps/Rounds/Targets, 100.0*Warn/Rounds/Targets); }
+
+int main(int argc, char *argv[])
+{ int Rounds=100000;
+  if(argc>1) Rounds=atoi(argv[1]);
+  Bench<64>("spread over 10km", 5000, Rounds, 20);
+  Bench<64>("spread over 10km", 5000, Rounds, 30);
+  Bench<64>("all within 1km", 500, Rounds, 20);
+  Bench<64>("all within 1km", 500, Rounds, 30);
+  return 0; }
@@ -0,0 +1,87 @@
+// Scenario tests of the LookOut collision prediction: scripted own and target trajectories with the expected warning level.
+// Every scenario is also flown in floating point with small time steps:
+// the fixed point time and distance of the closest approach must agree with it, for every scenario.
+// When the distance does not change (parallel tracks) the closest approach is the earliest time.
+
+// make lookout_test && ./lookout_test
+
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+
+#include "lookout.h"
+
+struct Track                                      // initial state of a trajectory
+{ double East, North, Up;                         // [m]
+  double Speed, Heading, Climb, Turn;             // [m/s], [deg], [m/s], [deg/s]
+} ;
+
+struct Scenario
+{ const char *Name;
+  Track Own, Tgt;
+  double Age;                                     // [sec] how old the target position is
+  int Warn;                                       // expected warning level
+} ;
+
+static const Scenario Test[] =
+{ { "head-on, 1km",              {0,0,0, 30,  0,0,0}, {0,1000,0, 30,180,0,0}, 0, 1 },
+  { "head-on, 700m",             {0,0,0, 30,  0,0,0}, {0, 700,0, 30,180,0,0}, 0, 2 },
+  { "head-on, 400m",             {0,0,0, 30,  0,0,0}, {0, 400,0, 30,180,0,0}, 0, 3 },
+  { "head-on, 2km",              {0,0,0, 30,  0,0,0}, {0,2000,0, 30,180,0,0}, 0, 0 },
+  { "head-on, 500m aside",       {0,0,0, 30,  0,0,0}, {500,1000,0, 30,180,0,0}, 0, 0 },
+  { "head-on, 300m above",       {0,0,0, 30,  0,0,0}, {0,1000,300, 30,180,0,0}, 0, 0 },
+  { "crossing from the right",   {0,0,0, 25, 90,0,0}, {500,-500,0, 25,  0,0,0}, 0, 1 },
+  { "crossing, passing behind",  {0,0,0, 25, 90,0,0}, {200,-800,0, 25,  0,0,0}, 0, 0 },
+  { "overtaking",                {0,0,0, 20,  0,0,0}, {0,-150,0, 35,  0,0,0}, 0, 2 },
+  { "same thermal",              {0,0,0, 22,  0,2,18}, {150,0,10, 22,180,2,18}, 0, 2 },
+  { "thermal, 300m apart",       {0,0,0, 22,  0,2,18}, {0,600,0, 22,180,2,-18}, 0, 0 },
+  { "turning into",              {0,0,0, 30,  0,0,0}, {-300,250,0, 30,  0,0,12}, 0, 2 },
+  { "same but not turning",      {0,0,0, 30,  0,0,0}, {-300,250,0, 30,  0,0, 0}, 0, 0 },
+  { "diverging",                 {0,0,0, 30,  0,0,0}, {0,-300,0, 30,180,0,0}, 0, 0 },
+  { "close now, diverging",      {0,0,0, 30,  0,0,0}, {0,  50,0, 30, 90,0,0}, 0, 3 },
+  { "sink into",                 {0,0,0, 25,  0,0,0}, {0, 500,150, 25,180,-8,0}, 0, 2 },
+  { "head-on, old position",     {0,0,0, 30,  0,0,0}, {0, 900,0, 30,180,0,0}, 6, 2 },
+  { "parked",                    {0,0,0,  0,  0,0,0}, {30,30,0,  0,  0,0,0}, 0, 3 },
+  { "far away",                  {0,0,0, 30,  0,0,0}, {20000,0,0, 30,270,0,0}, 0, 0 },
+} ;
+
+static void Move(double &E, double &N, double &U, double &Head, const Track &T, double dT)
+{ double H=Head*M_PI/180;
+  E+=T.Speed*sin(H)*dT; N+=T.Speed*cos(H)*dT; U+=T.Climb*dT; Head+=T.Turn*dT; }
+
+static void Reference(const Scenario &S, int Horizon, double &CPATime, double &CPADist) // closest approach in floating point
+{ double OE=S.Own.East, ON=S.Own.North, OU=S.Own.Up, OH=S.Own.Heading;
+  double TE=S.Tgt.East, TN=S.Tgt.North, TU=S.Tgt.Up, TH=S.Tgt.Heading;
+  const double dT=0.01;
+  for(double Time=0; Time<S.Age; Time+=dT) Move(TE, TN, TU, TH, S.Tgt, dT);
+  static double Dist[4096]; int Steps=0;
+  for(double Time=0; Time<=Horizon+dT/2; Time+=dT)
+  { double dE=TE-OE, dN=TN-ON, dU=2*(TU-OU);
+    Dist[Steps++]=sqrt(dE*dE+dN*dN+dU*dU);
+    Move(OE, ON, OU, OH, S.Own, dT);
+    Move(TE, TN, TU, TH, S.Tgt, dT); }
+  CPADist=1e9;
+  for(int Step=0; Step<Steps; Step++) if(Dist[Step]<CPADist) CPADist=Dist[Step];
+  int Step=0; while(Dist[Step]>CPADist+0.01) Step++;             // earliest time within 1cm of the closest
+  CPATime=Step*dT; }
+
+int main(int argc, char *argv[])
+{ static LookOut<64> Engine;
+  int Fail=0;
+  const int Scenarios = sizeof(Test)/sizeof(Scenario);
+  for(int Idx=0; Idx<Scenarios; Idx++)
+  { const Scenario &S=Test[Idx];
+    Engine.setOwn(S.Own.Speed*10, S.Own.Heading*10, S.Own.Climb*10, S.Own.Turn*10);
+    int Warn=Engine.addTarget(Idx, S.Tgt.East-S.Own.East, S.Tgt.North-S.Own.North, S.Tgt.Up-S.Own.Up,
+                              S.Tgt.Speed*10, S.Tgt.Heading*10, S.Tgt.Climb*10, S.Tgt.Turn*10, S.Age*1000);
+    const LookOut_Target &Tgt=Engine.Target[0];
+    double CPATime, CPADist;
+    Reference(S, Engine.Horizon, CPATime, CPADist);
+    bool OK = Warn==S.Warn;
+    if(fabs(Tgt.TimeToCPA-CPATime)>1.0) OK=0;                   // compare with the reference
+    if(fabs(Tgt.MissDist-CPADist)>5+0.05*CPADist) OK=0;
+    printf("%-26s W%d (exp. W%d) CPA: %2ds %5dm %+4dm  reference: %4.1fs %6.0fm => %s\n",
+           S.Name, Warn, S.Warn, Tgt.TimeToCPA, Tgt.MissDist, Tgt.MissAlt, CPATime, CPADist, OK ? "OK":"FAIL");
+    if(!OK) Fail++; }
+  printf("%d/%d scenarios failed\n", Fail, Scenarios);
+  return Fail!=0; }
@@ -0,0 +1,157 @@
+// Benchmark of the NMEA intake from the GPS: sentences per second before and after the in-place tokenizer.
+// Before: every byte through ProcessByte(), which copies it and indexes the commas, then dispatch by chains of isGx...() tests.
+// After:  blocks from the FIFO through ProcessBlock(): sentences are left in place, classified by their packed type
+//         and only those we read (GGA, RMC, GSA, GSV) are indexed.
+// Both paths must give the same positions and satellite SNR sums: this is checked after every sentence.
+// Without a log file a one-hour Air530Z-like 1Hz log is made up: GGA, GLL, 2xGSA, 3xGPGSV, 2xBDGSV, RMC, VTG, ZDA, TXT.
+
+// make nmea_bench && ./nmea_bench [log-file]
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "fifo.h"
+#include "ogn.h"
+
+static double getTime(void)
+{ struct timespec Now; clock_gettime(CLOCK_MONOTONIC, &Now);
+  return Now.tv_sec+1e-9*Now.tv_nsec; }
+
+static int Sentence(char *Out, const char *Body)                           // add '$', check-sum and CR/LF
+{ int Len=sprintf(Out, "$%s", Body);
+  return Len+NMEA_AppendCheckCRNL(Out, Len); }
+
+static size_t MakeLog(char *Log, int Seconds)                              // a made-up log: a glider circling slowly
+{ size_t Len=0; char Body[128];
+  for(int Sec=0; Sec<Seconds; Sec++)
+  { int HH=10+Sec/3600, MM=(Sec/60)%60, SS=Sec%60;
+    int LatFrac=1234+(Sec*37)%5000, LonFrac=4321+(Sec*53)%5000;
+    int Alt=8000+(Sec%600), Hdg=(Sec*7)%3600, Spd=300+(Sec%50);
+    int Sats=8+(Sec/60)%5;
+    sprintf(Body, "GNGGA,%02d%02d%02d.000,4530.%04d,N,01415.%04d,E,1,%02d,1.1,%d.%d,M,45.2,M,,", HH, MM, SS, LatFrac, LonFrac, Sats, Alt/10, Alt%10);
+    Len+=Sentence(Log+Len, Body);
+    sprintf(Body, "GNGLL,4530.%04d,N,01415.%04d,E,%02d%02d%02d.000,A,A", LatFrac, LonFrac, HH, MM, SS);
+    Len+=Sentence(Log+Len, Body);
+    Len+=Sentence(Log+Len, "GPGSA,A,3,02,05,13,15,18,20,23,29,,,,,1.9,1.1,1.6");
+    Len+=Sentence(Log+Len, "BDGSA,A,3,07,10,13,,,,,,,,,,1.9,1.1,1.6");
+    for(int Pkt=1; Pkt<=3; Pkt++)
+    { sprintf(Body, "GPGSV,3,%d,11,%02d,45,120,%02d,%02d,30,200,%02d,%02d,15,300,,%02d,60,045,%02d",
+              Pkt, Pkt*4, 30+(Sec+Pkt)%15, Pkt*4+1, 25+(Sec*3)%17, Pkt*4+2, Pkt*4+3, 35+Sec%9);
+      Len+=Sentence(Log+Len, Body); }
+    for(int Pkt=1; Pkt<=2; Pkt++)
+    { sprintf(Body, "BDGSV,2,%d,06,%02d,50,100,%02d,%02d,20,250,%02d,%02d,10,330,", Pkt, Pkt*3, 28+Sec%11, Pkt*3+1, 22+Sec%7, Pkt*3+2);
+      Len+=Sentence(Log+Len, Body); }
+    sprintf(Body, "GNRMC,%02d%02d%02d.000,A,4530.%04d,N,01415.%04d,E,%d.%02d,%d.%d,170926,,,A", HH, MM, SS, LatFrac, LonFrac, Spd/10, Spd%10, Hdg/10, Hdg%10);
+    Len+=Sentence(Log+Len, Body);
+    sprintf(Body, "GNVTG,%d.%d,T,,M,%d.%02d,N,%d.%02d,K,A", Hdg/10, Hdg%10, Spd/10, Spd%10, Spd*2/10, Spd%10);
+    Len+=Sentence(Log+Len, Body);
+    sprintf(Body, "GNZDA,%02d%02d%02d.000,17,09,2026,00,00", HH, MM, SS);
+    Len+=Sentence(Log+Len, Body);
+    if(Sec%10==0) Len+=Sentence(Log+Len, "GPTXT,01,01,01,ANTENNA OK"); }
+  return Len; }
+
+static uint16_t SatSNRsum[4];
+static uint8_t  SatSNRcount[4];
+
+static bool Pkt1(NMEA_RxMsg &GSV) { return Read_Dec1((const char *)GSV.ParmPtr(1))==1; }
+
+static void ReadGSV(NMEA_RxMsg &GSV, uint8_t SatSys)                      // the SNR sums, as in ProcessGSV()
+{ if(Pkt1(GSV)) { SatSNRsum[SatSys]=0; SatSNRcount[SatSys]=0; }
+  for(int Parm=3; Parm+3<GSV.Parms; Parm+=4)
+  { int8_t SNR=Read_Dec2((const char *)GSV.ParmPtr(Parm+3)); if(SNR<=0) continue;
+    SatSNRsum[SatSys]+=SNR; SatSNRcount[SatSys]++; } }
+
+static void Before(NMEA_RxMsg &NMEA, GPS_Position &Pos)                    // dispatch as it was: chains of character tests
+{ if(NMEA.isGxGSV())
+  {      if(NMEA.isGPGSV()) ReadGSV(NMEA, 0);
+    else if(NMEA.isGLGSV()) ReadGSV(NMEA, 1);
+    else if(NMEA.isGAGSV()) ReadGSV(NMEA, 2);
+    else if(NMEA.isBDGSV()) ReadGSV(NMEA, 3);
+    return; }
+  if(NMEA.isGxGGA()) { Pos.ReadGGA(NMEA); return; }
+  if(NMEA.isGxRMC()) { Pos.ReadRMC(NMEA); return; }
+  if(NMEA.isGxGSA()) { Pos.ReadGSA(NMEA); return; }
+  if(NMEA.isPGRMZ()) { Pos.ReadPGRMZ(NMEA); return; } }
+
+static void After(NMEA_RxMsg &NMEA, GPS_Position &Pos)                     // dispatch as GPS_Sentence() does now
+{ if(NMEA.getType()==NMEA_Type('G','S','V'))
+  { switch(NMEA.getTalker())
+    { case NMEA_Talker('G','P'): NMEA.Index(); ReadGSV(NMEA, 0); break;
+      case NMEA_Talker('G','L'): NMEA.Index(); ReadGSV(NMEA, 1); break;
+      case NMEA_Talker('G','A'): NMEA.Index(); ReadGSV(NMEA, 2); break;
+      case NMEA_Talker('B','D'): NMEA.Index(); ReadGSV(NMEA, 3); break; }
+    return; }
+  Pos.ReadNMEA(NMEA); }
+
+static uint32_t Signature(const GPS_Position &Pos)                         // what the sentences have set
+{ uint32_t Sum=Pos.Latitude^(Pos.Longitude*3)^(Pos.Altitude*5)^(Pos.Speed*7)^(Pos.Heading*11)^(Pos.Satellites*13)^(Pos.HDOP*17)^(Pos.PDOP*19)^(Pos.FixMode*23);
+  Sum^=(Pos.Hour*3600+Pos.Min*60+Pos.Sec)*29^(Pos.mSec*31)^(Pos.Day*37);
+  for(int Sys=0; Sys<4; Sys++) Sum^=(SatSNRsum[Sys]*41+SatSNRcount[Sys])<<Sys;
+  return Sum; }
+
+static uint32_t *RefSig; static size_t RefCount;
+
+static size_t RunBefore(const char *Log, size_t LogLen, bool Record)
+{ NMEA_RxMsg NMEA; GPS_Position Pos; size_t Count=0;
+  memset(SatSNRsum, 0, sizeof(SatSNRsum)); memset(SatSNRcount, 0, sizeof(SatSNRcount));
+  for(size_t Idx=0; Idx<LogLen; Idx++)
+  { NMEA.ProcessByte(Log[Idx]);
+    if(!NMEA.isComplete()) continue;
+    Before(NMEA, Pos);
+    if(Record) RefSig[Count]=Signature(Pos);
+    Count++; NMEA.Clear(); }
+  return Count; }
+
+static size_t RunAfter(const char *Log, size_t LogLen, bool Check, size_t Chunk=64)
+{ static FIFO<uint8_t, 512> UART;
+  NMEA_RxMsg NMEA; GPS_Position Pos; size_t Count=0; size_t Errors=0;
+  memset(SatSNRsum, 0, sizeof(SatSNRsum)); memset(SatSNRcount, 0, sizeof(SatSNRcount));
+  UART.Clear();
+  for(size_t Idx=0; Idx<LogLen; )
+  { uint8_t *Block; size_t Space=UART.getWriteBlock(Block);              // the UART drain: whatever came since the last call
+    size_t Len=LogLen-Idx; if(Len>Chunk) Len=Chunk; if(Len>Space) Len=Space;
+    memcpy(Block, Log+Idx, Len); UART.flushWriteBlock(Len); Idx+=Len;
+    for( ; ; )
+    { size_t Avail=UART.getReadBlock(Block); if(Avail==0) break;
+      size_t Taken=NMEA.ProcessBlock(Block, Avail);
+      if(NMEA.isComplete())
+      { After(NMEA, Pos);
+        if(Check && (Count>=RefCount || RefSig[Count]!=Signature(Pos))) Errors++;
+        Count++; NMEA.Clear(); }
+      UART.flushReadBlock(Taken); } }
+  if(Check && Errors) printf("%lu sentences differ !\n", (unsigned long)Errors);
+  return Count; }
+
+int main(int argc, char *argv[])
+{ size_t MaxLen = 16<<20;
+  char *Log = (char *)malloc(MaxLen); size_t LogLen=0;
+  if(argc>1)
+  { FILE *File=fopen(argv[1], "rb"); if(File==0) { printf("Cannot open %s\n", argv[1]); return 1; }
+    LogLen=fread(Log, 1, MaxLen, File); fclose(File); }
+  else LogLen=MakeLog(Log, 3600);
+  RefSig = (uint32_t *)malloc(LogLen/8*sizeof(uint32_t));
+
+  RefCount=RunBefore(Log, LogLen, 1);
+  const size_t Chunks[4] = { 1, 7, 64, 500 };                              // UART drains of various sizes: sentences copied or in place
+  for(int Idx=0; Idx<4; Idx++)
+    if(RunAfter(Log, LogLen, 1, Chunks[Idx])!=RefCount) { printf("Sentence count differs for %lu-byte blocks !\n", (unsigned long)Chunks[Idx]); return 1; }
+  size_t Count=RunAfter(Log, LogLen, 1);
+  printf("%lu bytes, %lu sentences (%lu through the block path)\n", (unsigned long)LogLen, (unsigned long)RefCount, (unsigned long)Count);
+  if(Count!=RefCount) { printf("Sentence count differs !\n"); return 1; }
+
+  const int Loops=20;
+  double Start=getTime();
+  for(int Loop=0; Loop<Loops; Loop++) RunBefore(Log, LogLen, 0);
+  double TimeBefore=getTime()-Start;
+  printf("Before: %8.0f sentences/s %6.1f ns/byte\n", Loops*RefCount/TimeBefore, 1e9*TimeBefore/Loops/LogLen);
+  for(int Idx=2; Idx<4; Idx++)
+  { Start=getTime();
+    for(int Loop=0; Loop<Loops; Loop++) RunAfter(Log, LogLen, 0, Chunks[Idx]);
+    double TimeAfter=getTime()-Start;
+    printf("After:  %8.0f sentences/s %6.1f ns/byte (%3.1fx) %3lu-byte blocks\n",
+           Loops*Count/TimeAfter, 1e9*TimeAfter/Loops/LogLen, TimeBefore/TimeAfter, (unsigned long)Chunks[Idx]); }
+  free(RefSig); free(Log);
+  return 0; }
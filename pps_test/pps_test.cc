@@ -0,0 +1,59 @@
+// Test of the PPS_Estimator: the GPS burst starts are seen by the loop with a random latency, mostly short,
+// sometimes long when the loop was busy (RX processing, OLED), some seconds are missing altogether.
+// The CPU clock runs off the GPS clock by up to +/-100ppm. After the lock, the estimated burst start must be within 1ms
+// of the true one for 99% of the seconds, while the raw first-byte time is late by several ms, the period within 10us.
+
+// make pps_test && ./pps_test
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+#include <algorithm>
+
+#include "pps.h"
+
+static uint32_t Rand=1234567;
+static double Uniform(void) { Rand^=Rand<<13; Rand^=Rand>>17; Rand^=Rand<<5; return (Rand&0xFFFFFF)/16777216.0; }
+
+static double Latency(void)                                   // [us] how late the loop sees the first byte
+{ double Prob=Uniform();
+  if(Prob<0.70) return 1000*Uniform();                        // loop idle: within a millisecond
+  if(Prob<0.95) return -3000*log(1-Uniform());                // short jobs
+  return 5000+20000*Uniform(); }                              // RX drain, OLED update
+
+static int Run(double PPM, uint32_t Start, bool Print)        // return the number of failures
+{ PPS_Estimator PPS;
+  const int Seconds=3600; const int Settle=60;
+  double Period = 1e6*(1+PPM*1e-6);                            // [us] the GPS second as seen by the CPU clock
+  double Errors[Seconds]; int Count=0; double RawSum=0;
+  for(int Sec=0; Sec<Seconds; Sec++)
+  { if(Uniform()<0.02) continue;                               // missing burst
+    double True = Start + Sec*Period + 100*(2*Uniform()-1);    // GPS jitter
+    double Meas = True+Latency();
+    PPS.Process((uint32_t)(uint64_t)Meas);                     // wraps around as micros()
+    if(Sec<Settle) continue;
+    Errors[Count++] = (int32_t)(PPS.getTime()-(uint32_t)(uint64_t)True);
+    RawSum+=Meas-True; }
+  double Sum=0; for(int Idx=0; Idx<Count; Idx++) Sum+=Errors[Idx];
+  for(int Idx=0; Idx<Count; Idx++) Errors[Idx]=fabs(Errors[Idx]);
+  std::sort(Errors, Errors+Count);
+  double P99=Errors[Count*99/100], Max=Errors[Count-1];
+  int Fail = P99>1000 || !PPS.isLocked() || fabs(PPS.getPeriod()-Period)>10;
+  if(Print || Fail)
+  { char Line[128]; PPS.Print(Line);
+    printf("%+5.0fppm: error mean %+4.0fus, 99%% %4.0fus, max %5.0fus, raw latency %4.0fus, period %u/%1.0fus %s\n",
+           PPM, Sum/Count, P99, Max, RawSum/Count, PPS.getPeriod(), Period, Fail ? "FAIL":"");
+    printf("        %s\n", Line); }
+  return Fail; }
+
+int main(int argc, char *argv[])
+{ int Fail=0;
+  Fail+=Run(   0, 1000, 1);
+  Fail+=Run(+100, 0xFFF00000, 1);                             // micros() wraps around soon
+  Fail+=Run(-100, 123456789, 1);
+  for(int Test=0; Test<100; Test++)
+    Fail+=Run(200*Uniform()-100, Rand, 0);
+  if(Fail) { printf("%d failed !\n", Fail); return 1; }
+  printf("OK\n");
+  return 0; }
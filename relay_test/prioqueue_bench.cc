@@ -0,0 +1,136 @@
+// Benchmark and consistency check of the relay queues: OGN_PrioQueue (scanning) against OGN_TreePrioQueue (sum-tree)
+// at 32, 64, 128 and 512 slots.
+// A fleet of aircraft, larger than the queue, sends position packets: every packet takes a slot with getNew()/addNew(),
+// a few relay candidates are picked with getRand()/decrRank() and old packets are removed every second with cleanTime().
+// Both queues get the same traffic and after every second they are checked against a brute-force recalculation.
+
+// make prioqueue_bench && ./prioqueue_bench [seconds]
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "ogn.h"
+
+static uint32_t Random=1;
+static uint32_t Rand(void) { Random ^= Random<<13; Random ^= Random>>17; Random ^= Random<<5; return Random; }
+
+const int RelayPerPacket = 2;                // relay picks per received packet
+
+template <class Queue_t>
+ static void Receive(Queue_t &Queue, uint32_t AddressAndType, uint8_t Time, uint8_t Rank) // a new packet like in Radio_RxAccept()
+{ uint16_t Idx=Queue.getNew();
+  OGN_RxPacket<OGN1_Packet> *Pkt=Queue[Idx];
+  Pkt->Packet.HeaderWord=AddressAndType;
+  Pkt->Packet.Position.Time=Time;
+  Pkt->Rank=Rank;
+  Queue.addNew(Idx);
+  for(int Relay=0; Relay<RelayPerPacket; Relay++)
+  { if(Queue.getSum()==0) break;
+    uint16_t RelayIdx=Queue.getRand(Rand());
+    Queue.decrRank(RelayIdx); }
+}
+
+template <uint16_t Size>
+ static int Check(const OGN_PrioQueue<OGN1_Packet, Size> &Queue) // check the scanning queue, return number of errors
+{ int Err=0;
+  uint32_t Sum=0; uint16_t Count=0; bool Free=0; uint8_t Low=0xFF;
+  for(uint16_t Idx=0; Idx<Size; Idx++)
+  { const OGN_RxPacket<OGN1_Packet> &Pkt=Queue.Packet[Idx];
+    if(!Pkt.Alloc) { if(Pkt.Rank) Err++; Free=1; continue; }   // free slots have zero rank
+    Sum+=Pkt.Rank; Count++; if(Pkt.Rank<Low) Low=Pkt.Rank;
+    uint32_t Addr=Pkt.Packet.getAddressAndType();
+    for(uint16_t Other=Idx+1; Other<Size; Other++)              // no duplicate addresses
+      if(Queue.Packet[Other].Alloc && Queue.Packet[Other].Packet.getAddressAndType()==Addr) Err++; }
+  if(Sum!=Queue.getSum()) Err++;
+  if(Count!=Queue.size()) Err++;
+  const OGN_RxPacket<OGN1_Packet> &LowPkt=Queue.Packet[Queue.getLow()];
+  if(Free) { if(LowPkt.Alloc) Err++; }                          // a free slot is taken first
+  else if(LowPkt.Rank!=Low) Err++;                              // else the lowest rank
+  return Err; }
+
+template <uint16_t Size>
+ static int Check(const OGN_TreePrioQueue<OGN1_Packet, Size> &Queue) // check the sum-tree queue against a brute-force recalculation, return number of errors
+{ int Err=0;
+  typedef OGN_TreePrioQueue<OGN1_Packet, Size> Queue_t;
+  uint32_t Sum=0; uint16_t Count=0; uint16_t LowKey=0xFFFF;
+  for(uint16_t Idx=0; Idx<Size; Idx++)
+  { const OGN_RxPacket<OGN1_Packet> &Pkt=Queue.Packet[Idx];
+    uint8_t Rank=Queue.Rank[Idx];
+    if(Rank!=Pkt.Rank) Err++;                                   // ranks in the array and in the packets agree
+    if(!Pkt.Alloc && Rank) Err++;                               // free slots have zero rank
+    Sum+=Rank; Count+=Pkt.Alloc;
+    uint16_t Key=(Rank<<1)|Pkt.Alloc; if(Key<LowKey) LowKey=Key;
+    if(!Pkt.Alloc) continue;
+    uint32_t Addr=Pkt.Packet.getAddressAndType();
+    for(uint16_t Other=Idx+1; Other<Size; Other++)              // no duplicate addresses
+      if(Queue.Packet[Other].Alloc && Queue.Packet[Other].Packet.getAddressAndType()==Addr) Err++;
+    uint16_t Found=0;                                           // exactly once in the address index
+    for(uint16_t Pos=0; Pos<Queue_t::HashSize; Pos++) if(Queue.Index[Pos]==Idx) Found++;
+    if(Found!=1) Err++;
+    uint8_t Sec=Pkt.Packet.Position.Time; if(Sec>=60) Sec=Queue_t::TimeLists-1;
+    Found=0;                                                    // on the list of its time
+    for(uint16_t Link=Queue.TimeHead[Sec]; Link!=Queue_t::None; Link=Queue.TimeNext[Link]) if(Link==Idx) Found++;
+    if(Found!=1) Err++; }
+  if(Sum!=Queue.getSum()) Err++;
+  if(Count!=Queue.size()) Err++;
+  uint16_t Low=Queue.getLow();
+  if((((uint16_t)Queue.Rank[Low]<<1)|Queue.Packet[Low].Alloc)!=LowKey) Err++; // lowest rank, free slots first
+  uint16_t Indexed=0;
+  for(uint16_t Pos=0; Pos<Queue_t::HashSize; Pos++) if(Queue.Index[Pos]!=Queue_t::None) Indexed++;
+  if(Indexed!=Count) Err++;
+  if(Sum)                                                       // weighted pick: same as the cumulative scan over the slots
+  { for(int Test=0; Test<16; Test++)
+    { uint32_t Rnd=Rand(); uint32_t RankIdx=Rnd%Sum;
+      uint32_t RankSum=0; uint16_t Idx;
+      for(Idx=0; Idx<Size; Idx++) { RankSum+=Queue.Rank[Idx]; if(RankSum>RankIdx) break; }
+      if(Queue.getRand(Rnd)!=Idx) Err++; }
+  }
+  return Err; }
+
+static double getTime(void)
+{ struct timespec Now; clock_gettime(CLOCK_MONOTONIC, &Now);
+  return Now.tv_sec + 1e-9*Now.tv_nsec; }
+
+template <uint16_t Size>
+ static int Bench(int Seconds)
+{ const int Fleet   = Size*3/2;                                 // aircraft around: more than the queue can hold
+  const int Packets = Size;                                     // packets received per second
+  static uint32_t Address[Fleet];
+  for(int Acft=0; Acft<Fleet; Acft++) Address[Acft] = ((Acft&3)<<24) | (Rand()&0xFFFFFF);
+
+  static OGN_TreePrioQueue<OGN1_Packet, Size> Queue; Queue.Clear();
+  static OGN_PrioQueue<OGN1_Packet, Size> Scan; Scan.Clear();
+
+  int Err=0; double Time=0, ScanTime=0;
+  for(int Sec=0; Sec<Seconds; Sec++)
+  { uint32_t Seed=Random;
+    double Start=getTime();
+    for(int Pkt=0; Pkt<Packets; Pkt++)
+      Receive(Queue, Address[Rand()%Fleet], (Rand()&63)==0 ? 63:Sec%60, Rand()&63);
+    Queue.cleanTime((Sec+60-20)%60);
+    Time+=getTime()-Start;
+    Random=Seed;                                                // same traffic for the scanning queue
+    Start=getTime();
+    for(int Pkt=0; Pkt<Packets; Pkt++)
+      Receive(Scan, Address[Rand()%Fleet], (Rand()&63)==0 ? 63:Sec%60, Rand()&63);
+    Scan.cleanTime((Sec+60-20)%60);
+    ScanTime+=getTime()-Start;
+    Err+=Check(Queue)+Check(Scan); }
+
+  double Ops = (double)Seconds*Packets;
+  printf("%3d slots: tree %7.1f ns/packet, %5d bytes, scan %7.1f ns/packet, %5d bytes => tree x%4.1f, %d/%d allocated, errors: %d => %s\n",
+         Size, 1e9*Time/Ops, (int)sizeof(Queue), 1e9*ScanTime/Ops, (int)sizeof(Scan), ScanTime/Time, Queue.size(), Size, Err, Err ? "FAIL":"OK");
+  return Err; }
+
+int main(int argc, char *argv[])
+{ int Seconds=2000;
+  if(argc>1) Seconds=atoi(argv[1]);
+  printf("%d packets + %d relay picks per slot per second\n", 1, RelayPerPacket);
+  int Err=0;
+  Err+=Bench<32>(Seconds);
+  Err+=Bench<64>(Seconds);
+  Err+=Bench<128>(Seconds);
+  Err+=Bench<512>(Seconds);
+  return Err!=0; }
@@ -0,0 +1,66 @@
+// Test of the GPS_PosRing: a climbing, turning and accelerating flight is fed as fixes at 1, 2, 5 and 10Hz,
+// some fixes are missing. The climb rate, turn rate and acceleration over the window must agree with
+// the exact difference divided by the time to within one LSB, while the reciprocal of the window time
+// is calculated only when the window time changes, not for every fix.
+
+// make ring_test && ./ring_test
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "ogn.h"
+
+static uint32_t Rand=12345;
+static uint32_t getRand(void) { Rand^=Rand<<13; Rand^=Rand>>17; Rand^=Rand<<5; return Rand; }
+
+static void setFix(GPS_Position &Pos, int32_t msTime)           // [ms] since 12:00:00: a position along the flight
+{ double Time=0.001*msTime;
+  Pos.Year=23; Pos.Month=6; Pos.Day=21;
+  Pos.Hour=12; Pos.Min=(msTime/60000)%60; Pos.Sec=(msTime/1000)%60; Pos.mSec=msTime%1000;
+  Pos.FixQuality=1; Pos.FixMode=3; Pos.Satellites=9;
+  Pos.Altitude  = lround(10*(1000 + 2.5*Time + 40*sin(Time/7)));          // [0.1m]
+  Pos.Heading   = lround(10*fmod(360+3*Time+20*sin(Time/5), 360))%3600;   // [0.1deg]
+  Pos.Speed     = lround(10*(30 + 8*sin(Time/3)));                        // [0.1m/s]
+  Pos.hasBaro=0; }
+
+static int16_t Exact(int32_t Diff, int16_t TimeDiff) { return lround(Diff*1000.0/TimeDiff); }
+
+static int Run(uint8_t Rate, uint16_t Window)                   // [Hz], [ms]
+{ GPS_PosRing<4> Ring;
+  int16_t Period=1000/Rate;
+  Ring.setWindow(Window/Period);
+  int Fixes=0, Rates=0, Recips=0, MaxErr=0; int16_t PrevWindowTime=0;
+  int32_t Time[GPS_PosRing<4>::Size];
+  for(int32_t msTime=0; msTime<3600000; msTime+=Period)
+  { if(getRand()%37==0) continue;                               // missing fix
+    GPS_Position &New=Ring.getNew(); setFix(New, msTime); Time[Ring.Seq&Ring.Mask]=msTime;
+    GPS_Position Ref=Ring.Pos[(Ring.Seq-Ring.Window)&Ring.Mask];
+    int16_t TimeDiff=Ring.Next(0); Fixes++;
+    if(TimeDiff==0) continue;
+    Rates++;
+    if(Ring.WindowTime!=PrevWindowTime) { Recips++; PrevWindowTime=Ring.WindowTime; }
+    const GPS_Position &Pos=Ring.getLast();
+    if(TimeDiff!=msTime-Time[(Ring.Seq-1-Ring.Window)&Ring.Mask]) { printf("%dHz: wrong time difference %d\n", Rate, TimeDiff); return 1; }
+    int32_t Turn=Pos.Heading-Ref.Heading; if(Turn>1800) Turn-=3600; else if(Turn<(-1800)) Turn+=3600;
+    int Err;
+    Err=abs(Pos.ClimbRate-Exact(Pos.Altitude-Ref.Altitude, TimeDiff)); if(Err>MaxErr) MaxErr=Err;
+    Err=abs(Pos.TurnRate -Exact(Turn                     , TimeDiff)); if(Err>MaxErr) MaxErr=Err;
+    Err=abs(Pos.LongAccel-Exact(Pos.Speed-Ref.Speed      , TimeDiff)); if(Err>MaxErr) MaxErr=Err; }
+  int Fail = MaxErr>1 || Rates<Fixes*9/10;
+  printf("%2dHz %4dms window: %6d fixes, %6d rates, %4d reciprocals, max. error %d LSB %s\n",
+         Rate, Window, Fixes, Rates, Recips, MaxErr, Fail ? "FAIL":"");
+  return Fail; }
+
+int main(int argc, char *argv[])
+{ int Fail=0;
+  Fail+=Run( 1, 1000);
+  Fail+=Run( 1, 2000);
+  Fail+=Run( 2, 1000);
+  Fail+=Run( 5, 1000);
+  Fail+=Run(10, 1000);
+  Fail+=Run(10,  500);
+  if(Fail) { printf("%d failed !\n", Fail); return 1; }
+  printf("OK\n");
+  return 0; }
@@ -0,0 +1,221 @@
+#ifndef __CASIC_H__
+#define __CASIC_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+// CASIC: the binary protocol of the Air530Z (and other ZKW/CASIC chips), configured with the $PCAS sentences and CFG messages.
+// Frame: 0xBA 0xCE, payload length (2 bytes), Class, ID, payload (a multiple of 4 bytes), check-sum (4 bytes)
+// The check-sum is (ID<<24) + (Class<<16) + Length plus the payload added up as 32-bit little-endian words.
+
+class CASIC_NAV_PV        // 0x01 0x03: position and velocity
+{ public:
+   uint32_t runTime;       // [ms] since the receiver start
+   uint8_t  posValid;      // 0:invalid, 1:external, 2:rough, 3:kept, 4:dead-reckoning, 5:fast, 6:2-D, 7:3-D, 8:GNSS+DR
+   uint8_t  velValid;      // same as above, for the velocity
+   uint8_t  system;        // systems used: bit 0:GPS, 1:BDS, 2:GLONASS
+   uint8_t  numSV;         // [satellites] used for the solution
+   uint8_t  numSVGPS;      // [satellites] GPS
+   uint8_t  numSVBDS;      // [satellites] Beidou
+   uint8_t  numSVGLN;      // [satellites] GLONASS
+   uint8_t  res;
+   float    pDop;          // position dilution of precision
+   double   lon;           // [deg] longitude
+   double   lat;           // [deg] latitude
+   float    height;        // [m] height above the ellipsoid
+   float    sepGeoid;      // [m] geoid separation: ellipsoid above the geoid
+   float    hAcc;          // [m] horizontal accuracy
+   float    vAcc;          // [m] vertical accuracy
+   float    velN;          // [m/s] velocity north
+   float    velE;          // [m/s] velocity east
+   float    velU;          // [m/s] velocity up
+   float    speed3D;       // [m/s]
+   float    speed2D;       // [m/s] ground speed
+   float    heading;       // [deg] track-over-ground
+   float    sAcc;          // [m/s] speed accuracy
+   float    cAcc;          // [deg] heading accuracy
+} ;
+
+class CASIC_NAV_TIMEUTC   // 0x01 0x10: UTC time
+{ public:
+   uint32_t runTime;       // [ms] since the receiver start
+   float    tAcc;          // [s] time accuracy
+   float    msErr;         // [ms] fraction of the millisecond
+   uint16_t ms;            // [ms] millisecond of the second
+   uint16_t year;          // [year]
+   uint8_t  month;         // [1..12]
+   uint8_t  day;           // [1..31]
+   uint8_t  hour;          // [0..23]
+   uint8_t  min;           // [0..59]
+   uint8_t  sec;           // [0..59]
+   uint8_t  valid;         // non-zero when the time is known
+   uint8_t  tmSrc;         // time source: 0:GPS, 1:BDS, 2:GLONASS
+   uint8_t  res;
+} ;
+
+class CASIC_CFG_MSG       // 0x06 0x01: message output rate
+{ public:
+   uint8_t  clsID;         // Class of the message
+   uint8_t  msgID;         // ID of the message
+   uint16_t rate;          // [fixes] output every that many fixes, 0 = off
+} ;
+
+class CASIC_ACK           // 0x05 0x01 (ACK) or 0x05 0x00 (NAK): answer to a configuration message
+{ public:
+   uint8_t  clsID;         // Class of the message acknowledged
+   uint8_t  msgID;         // ID of the message acknowledged
+   uint16_t res;
+} ;
+
+class CASIC_RxMsg // receiver for the CASIC frames
+{ public:
+   static const uint8_t MaxWords=32;   // maximum number of 32-bit words (excl. head and tail)
+   static const uint8_t MaxBytes=4*MaxWords; // max. number of bytes
+   static const uint8_t SyncL=0xBA;    // CASIC sync bytes
+   static const uint8_t SyncH=0xCE;
+
+   union
+   { uint32_t Word[MaxWords];          // here we store the CASIC payload (excl. head and tail)
+     uint8_t  Byte[MaxBytes]; } ;
+   uint8_t  Class;                     // Class (01=NAV)
+   uint8_t  ID;                        // ID
+   uint8_t  Bytes;                     // number of bytes in the payload (excl. head and tail)
+
+  private:
+   uint8_t  State;                     // bits: 0:loading, 1:complete
+   uint8_t  Idx;                       // loading index
+   uint32_t Check;                     // check-sum: received, compared at the end
+
+  public:
+   static uint32_t calcCheck(uint8_t Class, uint8_t ID, uint16_t Bytes, const uint32_t *Word)
+   { uint32_t Sum = ((uint32_t)ID<<24) + ((uint32_t)Class<<16) + Bytes;
+     for(uint8_t Idx=0; Idx<Bytes/4; Idx++) Sum+=Word[Idx];   // little-endian CPU: the words are the protocol words
+     return Sum; }
+
+   inline void Clear(void) { Idx=0; State=0; }
+
+   uint8_t isLoading(void) const
+     { return State&0x01; }
+
+   uint8_t isComplete(void) const
+     { return State&0x02; }
+
+   void ProcessByte(uint8_t RxByte) // pass all bytes through this call and it will build the frame
+     {
+       if(isComplete()) Clear(); // if already a complete frame, clear it
+       switch(Idx)
+       { case 0:  // expect SyncL
+            if(RxByte!=SyncL) { Clear(); return; }
+            State=0x01; break;  // declare "isLoading" state
+         case 1: // expect SyncH
+            if(RxByte==SyncL) return;       // repeated SyncL: could be the start of the frame
+            if(RxByte!=SyncH) { Clear(); return; }
+            break;
+         case 2: // LSB of payload length
+            Bytes=RxByte; if(Bytes>MaxBytes || (Bytes&3)) { Clear(); return; }
+            break;
+         case 3: // MSB of payload length (expect zero)
+            if(RxByte!=0) { Clear(); return; }
+            break;
+         case 4: // Class
+            Class=RxByte;
+            break;
+         case 5: // ID
+            ID=RxByte;
+            break;
+         default:                         // past the header, now load the payload
+            uint8_t ByteIdx=Idx-6;
+            if(ByteIdx<Bytes)
+            { Byte[ByteIdx]=RxByte; }
+            else                          // the check-sum: four bytes
+            { uint8_t CheckIdx=ByteIdx-Bytes;
+              if(CheckIdx==0) Check=0;
+              Check|=(uint32_t)RxByte<<(8*CheckIdx);
+              if(CheckIdx==3)
+              { if(Check!=calcCheck(Class, ID, Bytes, Word)) { Clear(); return; }
+                State=0x02; } }            // declare "isComplete" state
+            break;
+       }
+       Idx++;
+     }
+
+   size_t ProcessBlock(const uint8_t *Block, size_t BlockLen) // pass blocks of bytes: stops after a complete frame or when the sync is lost
+     { size_t Taken=0;                                             // returns the number of bytes taken, at least one
+       while(Taken<BlockLen)
+       { uint8_t ByteIdx=Idx-6;
+         if(Idx>=6 && ByteIdx<Bytes)                               // in the payload: copy as much as there is
+         { size_t Len=Bytes-ByteIdx; if(Len>BlockLen-Taken) Len=BlockLen-Taken;
+           memcpy(Byte+ByteIdx, Block+Taken, Len); Idx+=Len; Taken+=Len; continue; }
+         ProcessByte(Block[Taken++]);
+         if(isComplete() || !isLoading()) break; }
+       return Taken; }
+
+   static void Send(uint8_t Class, uint8_t ID, void (*SendByte)(char), const uint8_t *Data=0, uint8_t DataLen=0)
+   { uint32_t Word[MaxWords];                                      // DataLen must be a multiple of 4
+     if(DataLen>MaxBytes) DataLen=MaxBytes;
+     if(Data) memcpy(Word, Data, DataLen);
+     uint32_t Sum = calcCheck(Class, ID, DataLen, Word);
+     (*SendByte)(SyncL);
+     (*SendByte)(SyncH);
+     (*SendByte)(DataLen);
+     (*SendByte)(0x00);
+     (*SendByte)(Class);
+     (*SendByte)(ID);
+     for(uint8_t Idx=0; Idx<DataLen; Idx++)
+     { (*SendByte)(Data[Idx]); }
+     for(uint8_t Idx=0; Idx<4; Idx++)                              // send the check sum
+     { (*SendByte)(Sum); Sum>>=8; }
+   }
+
+   bool isNAV(void) const { return Class==0x01; }
+   bool isACK(void) const { return Class==0x05; }
+   bool isCFG(void) const { return Class==0x06; }
+
+   bool isNAV_PV     (void) const { return isNAV() && (ID==0x03) && (Bytes==sizeof(CASIC_NAV_PV)); }
+   bool isNAV_TIMEUTC(void) const { return isNAV() && (ID==0x10) && (Bytes==sizeof(CASIC_NAV_TIMEUTC)); }
+
+   bool isACK_NAK    (void) const { return isACK() && (ID==0x00); }
+   bool isACK_ACK    (void) const { return isACK() && (ID==0x01); }
+
+   bool isCFG_PRT    (void) const { return isCFG() && (ID==0x00); }
+   bool isCFG_MSG    (void) const { return isCFG() && (ID==0x01); }
+
+   bool isAnswerTo(uint8_t AckClass, uint8_t AckID) const           // ACK or NAK for the given message
+   { if(!isACK() || Bytes<sizeof(CASIC_ACK)) return 0;
+     const CASIC_ACK *Ack = (const CASIC_ACK *)Byte;
+     return Ack->clsID==AckClass && Ack->msgID==AckID; }
+} ;
+
+// Checks that the GPS really sends the binary output after the configuration:
+// the NMEA positions are switched off, thus if the CFG-MSG is refused (NAK) or no NAV-PV comes
+// for MaxMiss bursts in a row, the binary output has failed and the NMEA profile has to be taken back.
+
+class CASIC_Watch
+{ public:
+   static const uint8_t MaxMiss = 5;   // [bursts] without a NAV-PV before giving up on the binary output
+   uint16_t ACK, NAK;                  // answers to CFG-MSG
+   uint8_t  Miss;                      // [bursts] in a row without a NAV-PV
+   bool     NavPV;                     // NAV-PV received in this burst
+   bool     Failed;                    // binary output is not coming
+
+  public:
+   CASIC_Watch() { ACK=0; NAK=0; Start(); }
+
+   void Start(void) { Miss=0; NavPV=0; Failed=0; }                    // binary configuration has just been sent
+
+   void Process(const CASIC_RxMsg &Msg)                               // every complete frame from the GPS
+   { if(Msg.isNAV_PV()) { NavPV=1; return; }
+     if(!Msg.isAnswerTo(0x06, 0x01)) return;
+     if(Msg.isACK_ACK()) ACK++;
+     else if(Msg.isACK_NAK()) { NAK++; Failed=1; } }
+
+   bool BurstEnd(void)                                                // the GPS burst is over: true when the binary output failed
+   { if(NavPV) Miss=0;
+     else if(Miss<MaxMiss) Miss++;
+     NavPV=0;
+     if(Miss>=MaxMiss) Failed=1;
+     return Failed; }
+} ;
+
+#endif // __CASIC_H__
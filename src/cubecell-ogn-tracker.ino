@@ -18,9 +18,12 @@
 
 #include "fifo.h"
 #include "lowpass2.h"
+#include "cycles.h"
 
 #include "format.h"
 #include "nmea.h"
+#include "casic.h"
+#include "pps.h"
 #include "manchester.h"
 #include "ogn1.h"
 #include "adsl.h"
@@ -39,6 +42,46 @@
 static uECC_SignKey SignKey;
 #endif
 
+// ===============================================================================================
+// #define WITH_LDPC_OSD                   // ordered-statistics decoder for packets the LDPC_Decoder fails on: 1.8KB RAM
+
+#ifdef WITH_LDPC_OSD
+#include "ldpc_osd.h"
+
+static LDPC_OSD          OSD;              // runs in the idle time on a frame where the LDPC_Decoder failed
+static RFM_FSK_RxPktData OSD_RxPkt;        // the frame being processed by the OSD
+static uint32_t          OSD_Time;         // [us] CPU time spent so far on this frame
+const  uint32_t          OSD_Budget = 20000; // [us] CPU time budget per frame
+const  uint32_t          OSD_Slice  =  1000; // [us] CPU time per call from the loop()
+#endif
+
+// ===============================================================================================
+// #define WITH_LDPC_COMBINE               // soft combining of repeated receptions the LDPC_Decoder fails on: 0.9KB RAM
+
+#ifdef WITH_LDPC_COMBINE
+#include "ldpc_combine.h"
+#ifdef LDPC_DECODER_INT8                   // the 2-bit INT8 input keeps only the sign of the combined soft bits: combining becomes a 3-level vote
+#error "WITH_LDPC_COMBINE needs the int16 LDPC_Decoder: undefine LDPC_DECODER_INT8"
+#endif
+
+static LDPC_Combiner<4>  Combiner;         // recent failed frames keyed by their address
+#endif
+
+// ===============================================================================================
+// #define WITH_LOOKOUT                    // collision prediction for the aircraft in the traffic table: 0.8KB RAM
+
+#ifdef WITH_LOOKOUT
+#include "lookout.h"
+
+static uint32_t          LookOut_Time;     // [us] CPU time of the last round
+static uint32_t          LookOut_TimeMax;  // [us] max. CPU time of a round
+#endif
+
+// ===============================================================================================
+#define WITH_GPS_CASIC                     // switch the Air530Z to the CASIC binary protocol: NAV-PV and NAV-TIMEUTC instead of NMEA
+#define GPS_FIX_RATE            1          // [Hz] fixes per second from the GPS: 1, 2, 5 or 10
+#define GPS_RATE_WINDOW      1000          // [ms] climb and turn rates over that time: a multiple of the fix period
+
 // ===============================================================================================
 
 static uint64_t getUniqueID(void) { return getID(); }        // get unique serial ID of the CPU/chip
@@ -97,6 +140,68 @@ static Air530ZClass GPS;                 // GPS
 // $GPCAS12 - low power (sleep ?)
 // $GPCAS15 - SBAS control ?
 
+// GPS output profiles: what the GPS sends every fix. The RF slot starts only after the burst following the PPS,
+// thus the shorter the burst the earlier the slot. GSV only gives the SNR for the display: every 10 fixes is enough.
+const uint8_t GPS_ProfileFull   = 0;     // what the GPS sends by default
+const uint8_t GPS_ProfileNMEA   = 1;     // GGA, GSA, RMC every fix, GSV every 10 fixes
+const uint8_t GPS_ProfileBinary = 2;     // CASIC NAV-PV and NAV-TIMEUTC every fix, GSV every 10 fixes
+#ifdef WITH_GPS_CASIC
+const uint8_t GPS_Profiles      = 3;
+static uint8_t GPS_Profile = GPS_ProfileBinary;
+#else
+const uint8_t GPS_Profiles      = 2;
+static uint8_t GPS_Profile = GPS_ProfileNMEA;
+#endif
+static uint8_t GPS_ProfileReq  = 0xFF;   // profile requested from the console: sent after the burst, 0xFF = none
+static uint8_t GPS_ConfigWait  = 0;      // [sentences] before the configuration is sent again
+#ifdef WITH_GPS_CASIC
+static CASIC_Watch GPS_Watch;            // falls back to the NMEA profile when the binary output does not come
+static uint8_t GPS_Fallbacks   = 0;      // how many times it did
+#endif
+
+static const char * const GPS_ProfileName[3] = { "Full", "NMEA", "Binary" };
+static const char * const GPS_ProfileCmd[3] =   //  GGA,GLL,GSA,GSV,RMC,VTG,ZDA,ANT,DHV,LPS,-,-,UTC,GST,-,-,-,TIM
+{ "$PCAS03,1,1,1,1,1,1,1,1,0,0,,,0,0,,,,0",
+  "$PCAS03,1,0,1,10,1,0,0,0,0,0,,,0,0,,,,0",
+  "$PCAS03,0,0,0,10,0,0,0,0,0,0,,,0,0,,,,0" };
+
+static void GPS_SendCmd(const char *Cmd)         // send a $PCAS command with the check-sum
+{ char NMEA[64];
+  uint8_t Len=Format_String(NMEA, Cmd);
+  Len+=NMEA_AppendCheckCRNL(NMEA, Len);
+  GPS.write((const uint8_t *)NMEA, Len); }
+
+static void GPS_SendByte(char Byte) { GPS.write((uint8_t)Byte); }
+
+const uint16_t GPS_FixPeriod = 1000/GPS_FIX_RATE; // [ms]
+
+static void GPS_SetProfile(uint8_t Profile)      // configure what the GPS sends every fix
+{ if(Profile>=GPS_Profiles) Profile=GPS_ProfileFull;
+  GPS_Profile=Profile;
+  char Cmd[16];
+  uint8_t Len=Format_String(Cmd, "$PCAS02,");
+  Len+=Format_UnsDec(Cmd+Len, GPS_FixPeriod); Cmd[Len]=0;
+  GPS_SendCmd(Cmd);                              // [ms] fix period
+#ifdef WITH_GPS_CASIC
+  CASIC_CFG_MSG CFG;
+  CFG.rate = Profile==GPS_ProfileBinary;         // every fix or off
+  CFG.clsID=0x01; CFG.msgID=0x03;                // NAV-PV: position and velocity
+  CASIC_RxMsg::Send(0x06, 0x01, GPS_SendByte, (const uint8_t *)&CFG, sizeof(CFG));
+  CFG.clsID=0x01; CFG.msgID=0x10;                // NAV-TIMEUTC: time and date
+  CASIC_RxMsg::Send(0x06, 0x01, GPS_SendByte, (const uint8_t *)&CFG, sizeof(CFG));
+  GPS_Watch.Start();                             // the binary output (or none) from now on
+#endif
+  GPS_SendCmd(GPS_ProfileCmd[Profile]); }        // then the NMEA: after the binary so the positions do not stop
+
+static bool GPS_isExpected(uint32_t Type)        // should the GPS send this NMEA in the current profile ?
+{ switch(Type)
+  { case NMEA_Type('G','S','V'):
+    case NMEA_Type('T','X','T'): return 1;
+    case NMEA_Type('G','G','A'):
+    case NMEA_Type('G','S','A'):
+    case NMEA_Type('R','M','C'): return GPS_Profile!=GPS_ProfileBinary; }
+  return GPS_Profile==GPS_ProfileFull; }
+
 // ===============================================================================================
 
 static SSD1306Wire Display(0x3c, 500000, SDA, SCL, GEOMETRY_128_64, GPIO10 ); // OLED: addr , freq , i2c group , resolution , rst
@@ -117,10 +222,43 @@ static void VextOFF(void)                  // Vext default OFF
 
 static FreqPlan Radio_FreqPlan;       // RF hopping pattern
 
-static FIFO<RFM_FSK_RxPktData, 16> RxFIFO;         // buffer for received packets
+static SPSC_FIFO<RFM_FSK_RxPktRaw, 16, 1> RxFIFO;  // raw frames captured by Radio_RxDone(), decoded by Radio_RxProcess(): drop the oldest when full
+static CycleStat RxDoneCycles;                     // CPU time spent in the Radio_RxDone() callback
+static CycleStat RxManchCycles;                    // CPU time to Manchester decode a frame in Radio_RxProcess()
+static CycleStat GPS_ParseCycles;                  // CPU time to interpret one NMEA sentence from the GPS
+static CycleStat GPS_FrameCycles;                  // CPU time to interpret one CASIC frame from the GPS
+static CycleStat TX_PrepCycles;                    // CPU time to make a position packet: extrapolate, encode, whiten, FEC
+static int16_t   TX_Extrap=0;                      // [ms] the last position packet was extrapolated by that much
+static CycleStat TX_ArmCycles;                     // CPU time to configure the radio for a frame, ahead of the TX time
+static CycleStat TX_SendCycles;                    // CPU time at the TX time: Radio.Send() of the staged frame
+static uint32_t  TX_LateMax=0;                     // [ms] max. delay of the TX after its time since the last print
+static uint32_t  TX_NotArmed=0;                    // [frames] the radio configured at the TX time: the loop came too late
+static uint16_t  GPS_Bytes=0;                      // [bytes] received from the GPS in this second
+static uint16_t  GPS_BytesPrev=0;                  // [bytes] received from the GPS in the previous second
+static uint32_t  GPS_BurstStart=0;                 // [ms] first byte of the GPS burst after the PPS
+static uint32_t  GPS_BurstEnd=0;                   // [ms] last byte of the GPS burst
+static uint32_t  GPS_SecStart=0;                   // [ms] first byte of the burst after the most recent PPS
+static bool      GPS_SecBurst=0;                   // the current burst is the one after the PPS: the RF slot starts after it
+static uint16_t  GPS_BurstLen=0;                   // [ms] length of the last GPS burst
+static uint16_t  GPS_BurstMax=0;                   // [ms] longest GPS burst since the last print
+static uint16_t  GPS_SlotDelay=0;                  // [ms] after the estimated PPS the RF slot started
+static PPS_Estimator PPS;                          // GPS second boundary from the burst start times
+static RFM_FSK_RxDupCache<8> RxDupCache;          // recent frames and their results: exact duplicates skip the FEC
+static uint16_t  RX_Decoded=0;                     // [packets] processed from the RxFIFO in this second
+static uint8_t   RX_Backlog=0;                     // [packets] max. RxFIFO backlog seen in this second
+static uint16_t  RX_DecodedPrev=0;                 // [packets] same for the previous second
+static uint8_t   RX_BacklogPrev=0;
+static uint32_t  RX_BudgetStop=0;                  // [passes] draining stopped by the time budget with packets left
+static uint32_t  RX_ProcMax=0;                     // [us] (slowly decaying) max. time to process one packet
 
 const int RelayQueueSize = 32;
 static OGN_PrioQueue<OGN1_Packet, RelayQueueSize> RelayQueue;  // candidate packets to be relayed
+const int TrafficTableSize = 32;
+static OGN_TrafficTable<TrafficTableSize> Traffic;             // aircraft heard: last position, reception statistics, distance and bearing
+#ifdef WITH_LOOKOUT
+static LookOut<TrafficTableSize> Look;                         // own and target tracks extrapolated once per second
+#endif
+static LDPC_Decoder      Decoder;      // decoder and error corrector for the OGN Gallager/LDPC code
 
 static Delay<uint8_t, 64> RX_OGN_CountDelay;   // to average the OGN packet rate over one minute
 static uint16_t           RX_OGN_Count64=0;    // counts received packets for the last 64 seconds
@@ -201,8 +339,93 @@ static void CONS_CtrlR(void)
   Len+=RelayQueue.Print(Line+Len);
   Len--; Line[Len]=0; Serial.println(Line); }
 
+static void CONS_CtrlG(void)                                   // step to the next GPS output profile
+{ GPS_ProfileReq = GPS_Profile+1; if(GPS_ProfileReq>=GPS_Profiles) GPS_ProfileReq=0;
+  uint8_t Len=Format_String(Line, "GPS: profile ");
+  Len+=Format_String(Line+Len, GPS_ProfileName[GPS_ProfileReq]);
+  Line[Len]=0; Serial.println(Line); }
+
+static void CONS_CtrlD(void)                                   // print LDPC decoder statistics
+{ uint8_t Len=Format_String(Line, "RxDone: ");
+  Len+=RxDoneCycles.Print(Line+Len);
+  Len+=Format_String(Line+Len, " Manchester: ");
+  Len+=RxManchCycles.Print(Line+Len);
+  Line[Len]=0; Serial.println(Line);
+  Len=Format_String(Line, "RxProc: ");
+  Len+=Format_UnsDec(Line+Len, RX_DecodedPrev); Len+=Format_String(Line+Len, "/s backlog:");
+  Len+=Format_UnsDec(Line+Len, RX_BacklogPrev); Len+=Format_String(Line+Len, " budget-stop:");
+  Len+=Format_UnsDec(Line+Len, RX_BudgetStop); Len+=Format_String(Line+Len, " max:");
+  Len+=Format_UnsDec(Line+Len, RX_ProcMax); Len+=Format_String(Line+Len, "us");
+  Line[Len]=0; Serial.println(Line);
+  Len=Format_String(Line, "Traffic: ");
+  Len+=Traffic.Print(Line+Len);
+  Line[Len]=0; Serial.println(Line);
+#ifdef WITH_LOOKOUT
+  Len=Format_String(Line, "LookOut: ");
+  Len+=Look.Print(Line+Len); Line[Len++]=' ';
+  Len+=Format_UnsDec(Line+Len, LookOut_Time); Line[Len++]='/';
+  Len+=Format_UnsDec(Line+Len, LookOut_TimeMax); Len+=Format_String(Line+Len, "us");
+  Line[Len]=0; Serial.println(Line);
+#endif
+  Len=Format_String(Line, "GPS: NMEA ");
+  Len+=GPS_ParseCycles.Print(Line+Len);
+  Len+=Format_String(Line+Len, " CASIC ");
+  Len+=GPS_FrameCycles.Print(Line+Len);
+  Line[Len]=0; Serial.println(Line);
+  Len=Format_String(Line, "GPS: ");
+  Len+=Format_String(Line+Len, GPS_ProfileName[GPS_Profile]); Len+=Format_String(Line+Len, " burst ");
+  Len+=Format_UnsDec(Line+Len, GPS_BurstLen); Line[Len++]='/';
+  Len+=Format_UnsDec(Line+Len, GPS_BurstMax); Len+=Format_String(Line+Len, "ms ");
+  Len+=Format_UnsDec(Line+Len, GPS_BytesPrev); Len+=Format_String(Line+Len, "B/s slot at +");
+  Len+=Format_UnsDec(Line+Len, GPS_SlotDelay); Len+=Format_String(Line+Len, "ms");
+#ifdef WITH_GPS_CASIC
+  Len+=Format_String(Line+Len, " CFG ack/nak ");
+  Len+=Format_UnsDec(Line+Len, GPS_Watch.ACK); Line[Len++]='/';
+  Len+=Format_UnsDec(Line+Len, GPS_Watch.NAK); Len+=Format_String(Line+Len, " fallback ");
+  Len+=Format_UnsDec(Line+Len, GPS_Fallbacks);
+#endif
+  Line[Len]=0; Serial.println(Line);
+  GPS_BurstMax=0;
+  Len=Format_String(Line, "PPS: ");
+  Len+=PPS.Print(Line+Len);
+  Line[Len]=0; Serial.println(Line);
+  PPS.clrHist();
+  Len=Format_String(Line, "TX: position ");
+  Len+=TX_PrepCycles.Print(Line+Len); Len+=Format_String(Line+Len, " extrapolated +");
+  Len+=Format_UnsDec(Line+Len, (uint16_t)TX_Extrap); Len+=Format_String(Line+Len, "ms");
+  Line[Len]=0; Serial.println(Line);
+  Len=Format_String(Line, "TX: arm ");
+  Len+=TX_ArmCycles.Print(Line+Len); Len+=Format_String(Line+Len, " send ");
+  Len+=TX_SendCycles.Print(Line+Len); Len+=Format_String(Line+Len, " late ");
+  Len+=Format_UnsDec(Line+Len, TX_LateMax); Len+=Format_String(Line+Len, "ms not-armed:");
+  Len+=Format_UnsDec(Line+Len, TX_NotArmed);
+  Line[Len]=0; Serial.println(Line);
+  TX_LateMax=0;
+  Len=Format_String(Line, "RxDup: ");
+  Len+=RxDupCache.Print(Line+Len);
+  Line[Len]=0; Serial.println(Line);
+  Len=Format_String(Line, "RxFIFO: ");
+  Len+=RxFIFO.Print(Line+Len);
+  Line[Len]=0; Serial.println(Line);
+  Len=Format_String(Line, "LDPC: ");
+  Len+=Decoder.Stat.Print(Line+Len);
+  Line[Len]=0; Serial.println(Line);
+#ifdef WITH_LDPC_COMBINE
+  Len=Format_String(Line, "Combine: ");
+  Len+=Combiner.Print(Line+Len);
+  Line[Len]=0; Serial.println(Line);
+#endif
+#ifdef WITH_LDPC_OSD
+  Len=Format_String(Line, "OSD: ");
+  Len+=OSD.Print(Line+Len);
+  Line[Len]=0; Serial.println(Line);
+#endif
+}
+
 // const char CtrlB = 'B'-'@';
 const char CtrlC = 'C'-'@';
+const char CtrlD = 'D'-'@';
+const char CtrlG = 'G'-'@';
 const char CtrlR = 'R'-'@';
 
 static int CONS_Proc(void)
@@ -212,6 +435,8 @@ static int CONS_Proc(void)
     Count++;
     // if(Byte==CtrlB) CONS_CtrlB();                                // print battery voltage and capacity -> crashes, why ?!
     if(Byte==CtrlC) CONS_CtrlC();                                // if Ctrl-C received: print parameters
+    if(Byte==CtrlD) CONS_CtrlD();                                // print LDPC decoder statistics
+    if(Byte==CtrlG) CONS_CtrlG();                                // change the GPS output profile
     if(Byte==CtrlR) CONS_CtrlR();                                // print relay queue
     ConsNMEA.ProcessByte(Byte);
     // printf("CONS_Proc() Err=%d, Byte=%02X, State/Len=%d/%d\n\r", Err, Byte, ConsNMEA.State, ConsNMEA.Len);
@@ -235,12 +460,13 @@ static uint8_t    GPS_SatCnt = 0;                // number of satelites in the a
 
 static void ProcessGSV(NMEA_RxMsg &GSV)          // process GxGSV to extract satellite data
 { uint8_t SatSys=0;
-       if(GSV.isGPGSV()) { SatSys=0; }
-  else if(GSV.isGLGSV()) { SatSys=1; }
-  else if(GSV.isGAGSV()) { SatSys=2; }
-  else if(GSV.isBDGSV()) { SatSys=3; }
-  else return;
-  if(GSV.Parms<3) return;
+  switch(GSV.getTalker())
+  { case NMEA_Talker('G','P'): SatSys=0; break;
+    case NMEA_Talker('G','L'): SatSys=1; break;
+    case NMEA_Talker('G','A'): SatSys=2; break;
+    case NMEA_Talker('B','D'): SatSys=3; break;
+    default: return; }
+  if(GSV.Index()<3) return;
   int8_t Pkts=Read_Dec1((const char *)GSV.ParmPtr(0)); if(Pkts<0) return;            // how many packets to pass all sats
   int8_t Pkt =Read_Dec1((const char *)GSV.ParmPtr(1)); if(Pkt <0) return;            // which packet in the sequence
   int8_t Sats=Read_Dec2((const char *)GSV.ParmPtr(2));                               // total number of satellites
@@ -267,8 +493,7 @@ static void ProcessGSV(NMEA_RxMsg &GSV)          // process GxGSV to extract sat
 // ===============================================================================================
 // Process GPS position data
 
-static int          GPS_Ptr = 0;       // 
-static GPS_Position GPS_Pipe[2];       // two most recent GPS readouts
+static GPS_PosRing<OGN_calcBits(GPS_RATE_WINDOW/GPS_FixPeriod+1)> GPS_Ring; // most recent GPS readouts: the rate window and the one being filled
 
 static uint32_t GPS_Latitude;          // [1/60000deg]
 static uint32_t GPS_Longitude;         // [1/60000deg]
@@ -281,32 +506,73 @@ static uint32_t GPS_PPS_ms = 0;                        // [ms] System timer at t
 static uint32_t GPS_PPS_Time = 0;                      // [sec] Unix time which corresponds to the most recent PPS
 
 static uint32_t GPS_Idle=0;                            // [ticks] to detect when GPS stops sending data
+static const uint32_t GPS_ByteTime = 87;               // [us] one byte at 115200bps: 10 bits
 
 static NMEA_RxMsg GpsNMEA;                             // NMEA catcher for GPS
+static FIFO<uint8_t, 256> GPS_UART;                    // bytes drained from the GPS UART: scanned for NMEA sentences in blocks
+
+static int GPS_Drain(void)                             // move all bytes waiting in the GPS UART into GPS_UART, return their number
+{ int Count=0;
+  for( ; ; )
+  { int Avail=GPS.available(); if(Avail<=0) break;    // how many bytes are waiting
+    uint8_t *Block; size_t Space=GPS_UART.getWriteBlock(Block); if(Space==0) break;
+    if((size_t)Avail>Space) Avail=Space;
+    for(int Idx=0; Idx<Avail; Idx++) Block[Idx]=GPS.read(); // the driver gives them one by one
+    GPS_UART.flushWriteBlock(Avail);
+    Count+=Avail; }
+  return Count; }
+
+#ifdef WITH_GPS_CASIC
+static CASIC_RxMsg GpsCASIC;                           // CASIC catcher for GPS
+
+static void GPS_Frame(void)                            // process a complete CASIC frame from the GPS
+{ CPU_Timer Start;
+  GPS_Ring.getNew().ReadCASIC(GpsCASIC);               // interpret NAV-PV and NAV-TIMEUTC
+  GPS_Watch.Process(GpsCASIC);                         // NAV-PV and the ACK/NAK of the configuration
+  GPS_FrameCycles.Add(Start.Elapsed());
+  GpsCASIC.Clear(); }
+#endif
+
+static void GPS_Sentence(void)                         // process a complete NMEA sentence from the GPS
+{ CPU_Timer Start;
+  if(!GPS_isExpected(GpsNMEA.getType()))              // the GPS missed the configuration or was restarted
+  { if(GPS_ConfigWait) GPS_ConfigWait--;
+                  else { GPS_SetProfile(GPS_Profile); GPS_ConfigWait=10; } }
+  if(GpsNMEA.getType()==NMEA_Type('G','S','V')) ProcessGSV(GpsNMEA); // process satellite data
+  else
+  { GPS_Ring.getNew().ReadNMEA(GpsNMEA);               // interpret the position NMEA by the GPS
+    // if(GpsNMEA.isGxRMC() || GpsNMEA.isGxGGA() /* || GpsNMEA.isGxGSA() */ )          // selected GPS sentens
+    // { Serial.println((const char *)(GpsNMEA.Msg)); }                                   // copy to the console, but this does not work, characters are being lost
+  }
+  GPS_ParseCycles.Add(Start.Elapsed());
+  GpsNMEA.Clear(); }
 
 static int GPS_Process(void)                           // process serial data stream from the GPS
 { int Count=0;
   for( ; ; )
-  { if(GPS.available()<=0) break;                      // if no more characters then give up
-    uint8_t Byte=GPS.read();                           // read character
-    // GPS.encode(Byte);                                 // process character through the GPS NMEA interpreter
-    GpsNMEA.ProcessByte(Byte);                         // NMEA interpreter
-    if(GpsNMEA.isComplete())                           // if NMEA is done
-    { if(GpsNMEA.isGxGSV()) ProcessGSV(GpsNMEA);       // process satellite data
-      else
-      { GPS_Pipe[GPS_Ptr].ReadNMEA(GpsNMEA);           // interpret the position NMEA by the GPS
-        // if(GpsNMEA.isGxRMC() || GpsNMEA.isGxGGA() /* || GpsNMEA.isGxGSA() */ )          // selected GPS sentens
-        // { GpsNMEA.Data[GpsNMEA.Len]=0; Serial.println((const char *)(GpsNMEA.Data)); } // copy to the console, but this does not work, characters are being lost
-      }
-      GpsNMEA.Clear(); }
-    // Serial.write(Byte);                                // copy character to the console (no loss of characters here)
-    Count++; }                                         // count processed characters
-  return Count; }                                      // return number of processed characters
-
-static void GPS_Next(void)                             // step to the next GPS position
-{ int Next = GPS_Ptr^1;
-  if(GPS_Pipe[GPS_Ptr].isValid() && GPS_Pipe[Next].isValid()) GPS_Pipe[GPS_Ptr].calcDifferentials(GPS_Pipe[Next]);
-  GPS_Ptr=Next; }
+  { Count+=GPS_Drain();                                // take as much as the UART has and GPS_UART can hold
+    bool More = GPS_UART.Full()>=GPS_UART.Len;         // GPS_UART is full: more may be waiting in the UART
+    for( ; ; )
+    { uint8_t *Block; size_t Len=GPS_UART.getReadBlock(Block); if(Len==0) break;
+#ifdef WITH_GPS_CASIC
+      if(GpsNMEA.isEmpty() && !GpsCASIC.isLoading())   // between messages: skip to a '$' or a CASIC sync
+      { size_t Skip=0;
+        while(Skip<Len && Block[Skip]!='$' && Block[Skip]!=CASIC_RxMsg::SyncL) Skip++;
+        if(Skip) { GPS_UART.flushReadBlock(Skip); continue; } }
+      if(GpsCASIC.isLoading() || Block[0]==CASIC_RxMsg::SyncL)
+      { size_t Taken=GpsCASIC.ProcessBlock(Block, Len); // binary frame: sync to check-sum
+        if(GpsCASIC.isComplete()) GPS_Frame();
+        GPS_UART.flushReadBlock(Taken); continue; }
+#endif
+      size_t Taken=GpsNMEA.ProcessBlock(Block, Len);   // frame the sentence: '$' to CR/LF
+      if(GpsNMEA.isComplete()) GPS_Sentence();         // if NMEA is done: before the flush as it may still sit in the block
+      GPS_UART.flushReadBlock(Taken); }
+    if(!More) break; }
+  GPS_Bytes+=Count;
+  return Count; }                                      // return number of characters taken from the UART
+
+static void GPS_Next(void)                             // the fix is complete: rates over the window, step to the next GPS position
+{ GPS_Ring.Next(); }
 
 static void GPS_Random_Update(uint8_t Bit)             // process single LSB bit from the GPS data
 { Random.GPS = (Random.GPS<<1) | (Bit&1); }
@@ -387,33 +653,31 @@ static void OLED_Relay(const GPS_Position &GPS)                 // display list
   Display.setFont(ArialMT_Plain_10);
   Display.setTextAlignment(TEXT_ALIGN_LEFT);
   uint8_t VertPos=0;
-  for( uint8_t Idx=0; Idx<RelayQueueSize; Idx++)
-  { OGN_RxPacket<OGN1_Packet> *Packet = RelayQueue.Packet+Idx; if(Packet->Alloc==0) continue;
-    if(Packet->Packet.Header.NonPos) continue;                     // don't show non-position packets
-    // int32_t LatDist, LonDist;
-    // if(Packet->Packet.calcDistanceVector(LatDist, LonDist, GPS.Latitude, GPS.Longitude, GPS.LatitudeCosine, 20000)<0) continue;
-    uint32_t Dist= IntDistance(Packet->LatDist, Packet->LonDist);      // [m]
-    uint32_t Dir = IntAtan2(Packet->LonDist, Packet->LatDist);         // [16-bit cyclic]
-    Dir &= 0xFFFF; Dir = (Dir*360)>>16;                                // [deg]
+  for( uint16_t Idx=0; Idx<TrafficTableSize; Idx++)
+  { OGN_Traffic *Acft = Traffic[Idx]; if(!Acft->Used) continue;
+    if(!Traffic.calcRelative(*Acft)) continue;                     // distance and bearing: computed once per own position
+    uint32_t Dist= Acft->Distance;                                 // [m]
+    uint32_t Dir = Acft->Bearing;                                  // [16-bit cyclic]
+    Dir = (Dir*360)>>16;                                           // [deg]
     uint8_t Len=0;
-    Len+=Format_String(Line+Len, AcftTypeName[Packet->Packet.Position.AcftType]);
-    // Line[Len++]=HexDigit(Packet->Packet.Position.AcftType);
+    Len+=Format_String(Line+Len, AcftTypeName[Acft->AcftType]);
+    // Line[Len++]=HexDigit(Acft->AcftType);
     // Line[Len++]=':';
-    // Line[Len++]='0'+Packet->Packet.Header.AddrType;                // address-type
+    // Line[Len++]='0'+(Acft->AddressAndType>>24);                   // address-type
     // Line[Len++]=':';
-    // Len+=Format_Hex(Line+Len, Packet->Packet.Header.Address, 6);   // address
+    // Len+=Format_Hex(Line+Len, Acft->AddressAndType&0xFFFFFF, 6);  // address
     Line[Len++]=' ';
-    // Len+=Format_SignDec(Line+Len, -(int16_t)Packet->RxRSSI/2);     // [dBm] RSSI
+    // Len+=Format_SignDec(Line+Len, -(int16_t)Acft->RxRSSI/2);       // [dBm] RSSI
     // Len+=Format_String(Line+Len, "dBm ");
-    // Len+=Format_Hex(Line+Len, Packet->Rank);                       // rank for relay
+    // Len+=Format_UnsDec(Line+Len, Acft->Packets);                  // packets received
     // Line[Len++]=' ';
     // Line[Len++]=':';
-    Len+=Format_UnsDec(Line+Len, Packet->Packet.DecodeAltitude()); // [m] altitude
+    Len+=Format_UnsDec(Line+Len, (uint32_t)Acft->Altitude);       // [m] altitude
     Line[Len++]='m'; Line[Len++]=' ';
     Len+=Format_UnsDec(Line+Len, Dir, 3);                             // [deg] direction to target
     Line[Len++]=' ';
     Len+=Format_UnsDec(Line+Len, (Dist+50)/100, 2, 1);                // [km] distance to target
-    // Len+=Format_UnsDec(Line+Len, Packet->Packet.Position.Time, 2); // [sec] timestamp
+    // Len+=Format_UnsDec(Line+Len, Acft->PosTime, 2);               // [sec] timestamp
     Len+=Format_String(Line+Len, "km");
     Line[Len]=0;
     Display.drawString(0, VertPos, Line);
@@ -611,14 +875,15 @@ static int getStatusPacket(OGN1_Packet &Packet, const GPS_Position &GPS)
   Packet.Status.TxPower = TxPower;
   return 1; }
 
-static int getPosPacket(OGN1_Packet &Packet, const GPS_Position &GPS)  // produce position OGN packet
+static int getPosPacket(OGN1_Packet &Packet, const GPS_Position &GPS, int16_t dTime=0)  // produce position OGN packet, extrapolated by dTime [ms]
 { Packet.HeaderWord = 0;
   Packet.Header.Address = Parameters.Address;                          // aircraft address
   Packet.Header.AddrType = Parameters.AddrType;                        // aircraft address-type
   Packet.calcAddrParity();
   Packet.Position.AcftType = Parameters.AcftType;                      // aircraft type
   Packet.Position.Stealth  = Parameters.Stealth;
-  GPS.Encode(Packet);
+  if(dTime) GPS.Encode(Packet, dTime);
+       else GPS.Encode(Packet);
   return 1; }
 
 static int getAdslPacket(ADSL_Packet &Packet, const GPS_Position &GPS)  // produce position ADS-L packet
@@ -658,23 +923,19 @@ static void Radio_TxTimeout(void)
 
 static uint8_t RX_OGN_Packets=0;            // [packets] counts received packets
 
-static LDPC_Decoder      Decoder;      // decoder and error corrector for the OGN Gallager/LDPC code
-static RFM_FSK_RxPktData RxPktData;
-
 static void CleanRelayQueue(uint32_t Time, uint32_t Delay=20) // remove "old" packets from the relay queue
 { uint8_t Sec = (Time-Delay)%60; // Serial.printf("cleanTime(%d)\n", Sec);
   RelayQueue.cleanTime(Sec); }             // remove packets 20(default) seconds into the past
 
 static bool GetRelayPacket(OGN_TxPacket<OGN_Packet> *Packet)      // prepare a packet to be relayed
-{ if(RelayQueue.Sum==0) return 0;                     // if no packets in the relay queue
+{ if(RelayQueue.getSum()==0) return 0;                 // if no packets in the relay queue
   XorShift64(Random.Word);                             // produce a new random number
-  uint8_t Idx=RelayQueue.getRand(Random.RX);          // get weight-random packet from the relay queue
-  if(RelayQueue.Packet[Idx].Rank==0) return 0;        // should not happen ...
-  memcpy(Packet->Packet.Byte(), RelayQueue[Idx]->Byte(), OGN_Packet::Bytes); // copy the packet
-  Packet->Packet.Header.Relay=1;                      // increment the relay count (in fact we only do single relay)
+  uint16_t Idx=RelayQueue.getRand(Random.RX);          // get weight-random packet from the relay queue
+  if(RelayQueue.getRank(Idx)==0) return 0;             // should not happen ...
+  memcpy(Packet->Byte(), RelayQueue[Idx]->Byte(), OGN_TxPacket<OGN_Packet>::Bytes); // copy the packet together with the received FEC
   // Packet->Packet.calcAddrParity();
-  if(!Packet->Packet.Header.Encrypted) Packet->Packet.Whiten(); // whiten but only for non-encrypted packets
-  Packet->calcFEC();                                  // Calc. the FEC code => packet ready for transmission
+  if(!Packet->Packet.Header.Encrypted) Packet->Packet.Whiten(); // whiten but only for non-encrypted packets: the FEC is again valid
+  Packet->setRelay(1);                                // increment the relay count (in fact we only do single relay) and patch the FEC
   // PrintRelayQueue(Idx);  // for debug
   RelayQueue.decrRank(Idx);                           // reduce the rank of the packet selected for relay
   return 1; }
@@ -682,48 +943,36 @@ static bool GetRelayPacket(OGN_TxPacket<OGN_Packet> *Packet)      // prepare a p
 // a new packet has been received callback - this should probably be a quick call
 static void Radio_RxDone( uint8_t *Packet, uint16_t Size, int16_t RSSI, int8_t SNR) // RSSI and SNR are not passed for FSK packets
 { if(Size!=2*26) return;
+  uint32_t Start=CPU_Cycles();
   RX_OGN_Packets++;
   PacketStatus_t RadioPktStatus; // to get the packet RSSI: https://github.com/HelTecAutomation/CubeCell-Arduino/issues/236
-  SX126xGetPacketStatus(&RadioPktStatus);
+  SX126xGetPacketStatus(&RadioPktStatus);                              // has to be read now, before the next packet
   RSSI = RadioPktStatus.Params.Gfsk.RssiAvg;
-  RFM_FSK_RxPktData *RxPkt = RxFIFO.getWrite();                        // new packet in the RxFIFO
-  RxPkt->Time = GPS_PPS_Time;                                          // [sec]
-  RxPkt->msTime = millis()-GPS_PPS_ms;                                 // [ms] time since PPS
-  RxPkt->Channel = 0x80 | RF_Channel;                                  // system:channel
-  RxPkt->RSSI = -2*RSSI;                                               // [-0.5dBm]
-  uint8_t PktIdx=0;
-  for(uint8_t Idx=0; Idx<26; Idx++)                                    // loop over packet bytes
-  { uint8_t ByteH = Packet[PktIdx++];
-    ByteH = ManchesterDecode[ByteH]; uint8_t ErrH=ByteH>>4; ByteH&=0x0F; // decode manchester, detect (some) errors
-    uint8_t ByteL = Packet[PktIdx++];
-    ByteL = ManchesterDecode[ByteL]; uint8_t ErrL=ByteL>>4; ByteL&=0x0F;
-    RxPkt->Data[Idx]=(ByteH<<4) | ByteL;
-    RxPkt->Err [Idx]=(ErrH <<4) | ErrL ; }
+  RFM_FSK_RxPktRaw *RxRaw = RxFIFO.getWrite();                         // capture only the raw frame: decoding is done by Radio_RxProcess()
+  if(RxRaw==0) return;                                                 // FIFO full: not with the drop-oldest policy
+  RxRaw->Time = GPS_PPS_Time;                                          // [sec]
+  RxRaw->msTime = millis()-GPS_PPS_ms;                                 // [ms] time since PPS
+  RxRaw->Channel = 0x80 | RF_Channel;                                  // system:channel
+  RxRaw->RSSI = -2*RSSI;                                               // [-0.5dBm]
+  memcpy(RxRaw->Chips, Packet, RFM_FSK_RxPktRaw::Bytes);
   RxFIFO.Write();                                                      // put packet into the RxFIFO
-  Random.RX = (Random.RX*RSSI) ^ (~RSSI); XorShift64(Random.Word);     // update random number
+  RxDoneCycles.Add(CPU_CyclesSince(Start));
 }
 
-static void Radio_RxProcess(void)                                      // process packets in the RxFIFO
-{ RFM_FSK_RxPktData *RxPkt = RxFIFO.getRead();                         // check for new received packets
-  if(RxPkt==0) return;
-  LED_Green();                                                         // green flash
-  uint8_t RxPacketIdx  = RelayQueue.getNew();                          // get place for this new packet
-  OGN_RxPacket<OGN1_Packet> *RxPacket = RelayQueue[RxPacketIdx];
-  uint8_t DecErr = RxPkt->Decode(*RxPacket, Decoder);                  // LDPC FEC decoder
-  // Serial.printf("%d: Radio_RxDone( , %d, %d, %d) RxErr=%d/%d %08X { %08X %08X }\n",
-  //         millis(), Size, RSSI, SNR, DecErr, RxPacket->RxErr, RxPacket->Packet.HeaderWord, Random.GPS, Random.RX);
-  if(DecErr || RxPacket->RxErr>=10 ) { RxFIFO.Read(); LED_OFF(); return; }                             // if FEC not correctly decoded or too many bit errors then give up
+static void Radio_RxAccept(uint16_t RxPacketIdx)                        // process a correctly decoded packet in the relay queue
+{ OGN_RxPacket<OGN1_Packet> *RxPacket = RelayQueue[RxPacketIdx];
   uint8_t OwnPacket = ( RxPacket->Packet.Header.Address  == Parameters.Address  )       // is it my own packet (through a relay) ?
                    && ( RxPacket->Packet.Header.AddrType == Parameters.AddrType );
-  if(OwnPacket || RxPacket->Packet.Header.NonPos || RxPacket->Packet.Header.Encrypted) { RxFIFO.Read(); LED_OFF(); return; }
+  if(OwnPacket || RxPacket->Packet.Header.NonPos || RxPacket->Packet.Header.Encrypted) return;
   RxPacket->Packet.Dewhiten();
+  OGN_Traffic *Acft = Traffic.Update(RxPacket->Packet, GPS_PPS_Time, RxPacket->RxRSSI, RxPacket->RxErr); // aircraft state for display and other users
   if(GPS_Satellites)
-  { int32_t LatDist=0, LonDist=0;
-    bool DistOK = RxPacket->Packet.calcDistanceVector(LatDist, LonDist, GPS_Latitude, GPS_Longitude, GPS_LatCosine)>=0;
+  { bool DistOK = Traffic.calcRelative(*Acft);                     // distance from own position
     if(DistOK)
-    { RxPacket->LatDist = LatDist;
-      RxPacket->LonDist = LonDist;
+    { RxPacket->LatDist = Acft->LatDist;
+      RxPacket->LonDist = Acft->LonDist;
       // int32_t Alt = GPS_Altitude/10; if(Alt<0) Alt=0;
+      RxPacket->Warn = Acft->Warn;                                 // collision warning level from the last LookOut round
       RxPacket->calcRelayRank(GPS_Altitude/10);                    // calculate the relay-rank (priority for relay)
       // Serial.printf("GPS:%dm Pkt:%dm/%d => Rank:%d\r\n", GPS_Altitude/10, RxPacket->Packet.DecodeAltitude(), RxPacket->RxRSSI, RxPacket->Rank);
       OGN_RxPacket<OGN1_Packet> *PrevRxPacket = RelayQueue.addNew(RxPacketIdx);
@@ -731,12 +980,85 @@ static void Radio_RxProcess(void)                                      // proces
     }
   }
   // Serial.printf("RX[%02X] RSSI:%d, RxErr:%d %08X\n",
-  //                 RxPkt->Channel, RxPkt->RSSI, RxPacket->RxErr, RxPacket->Packet.HeaderWord);
-  // RxPkt->Print(CONS_UART_Write, 1);
+  //                 RxPacket->RxChan, RxPacket->RxRSSI, RxPacket->RxErr, RxPacket->Packet.HeaderWord);
   // uint8_t Len=RxPacket->WritePOGNT(Line);
   // if(Len>=8) { Line[Len-1]=0; Serial.println(Line); }
-  RxFIFO.Read();
-  LED_OFF(); }
+}
+
+#ifdef WITH_LDPC_COMBINE
+static uint8_t Radio_RxCombine(const RFM_FSK_RxPktData &RxPkt, OGN_RxPacket<OGN1_Packet> &RxPacket) // add a failed frame to its earlier copies
+{ int8_t Idx=Combiner.Add(RxPkt.Data, RxPkt.Err, RxPkt.Time);
+  if(Idx<0 || Combiner.Copies[Idx]<2) return 1;                       // not taken or no other copy yet
+  if(Combiner.Decode(Idx, Decoder, RxPacket.Packet.Byte())) return 1; // decode the sum of all copies
+  if(!RxPacket.Packet.goodAddrParity()) return 1;                      // header parity is an extra check
+  RxPkt.setRxInfo(RxPacket, 1);
+  uint8_t RxErr=Combiner.ErrCount(Idx, RxPacket.Packet.Byte());       // bit errors against the summed soft bits, not the single copy
+  RxPacket.RxErr = RxErr>15 ? 15:RxErr;
+  if(RxErr>=10) return 1;                                              // too many bit errors: keep the copies, a next one may help
+  Combiner.Remove(Idx); Combiner.Recovered++;
+  return 0; }
+#endif
+
+static bool Radio_RxProcess(void)                                      // process a packet from the RxFIFO, return false when none
+{ static RFM_FSK_RxPktRaw RxRaw;
+  if(!RxFIFO.Read(RxRaw)) return 0;                                    // check for new received packets
+  LED_Green();                                                         // green flash
+  uint32_t Start=CPU_Cycles();
+  static RFM_FSK_RxPktData RxPktData;
+  RFM_FSK_RxPktData *RxPkt = &RxPktData;
+  RxPkt->Input(RxRaw);                                                 // Manchester decode
+  Random.RX = (Random.RX*RxPkt->RSSI) ^ (~RxPkt->RSSI); XorShift64(Random.Word); // update random number
+  RxManchCycles.Add(CPU_CyclesSince(Start));
+  uint32_t Hash = RxDupCache.calcHash(*RxPkt);
+  if(RxDupCache.Find(Hash, RxPkt->Time)>=0) { LED_OFF(); return 1; }  // exact duplicate: already processed
+  uint16_t RxPacketIdx = RelayQueue.getNew();                          // get place for this new packet
+  OGN_RxPacket<OGN1_Packet> *RxPacket = RelayQueue[RxPacketIdx];
+  uint8_t DecErr = RxPkt->Decode(*RxPacket, Decoder);                  // LDPC FEC decoder
+  // Serial.printf("%d: Radio_RxDone( , %d, %d, %d) RxErr=%d/%d %08X { %08X %08X }\n",
+  //         millis(), Size, RSSI, SNR, DecErr, RxPacket->RxErr, RxPacket->Packet.HeaderWord, Random.GPS, Random.RX);
+#ifdef WITH_LDPC_OSD
+  if(DecErr)                                                           // pass the frame to the OSD while the Decoder still holds this single frame
+  { if(OSD.isBusy()) OSD.Skipped++;                                    // unless busy with another one
+    else { OSD.Input(Decoder); OSD_RxPkt=*RxPkt; OSD_Time=0; }
+  }
+#endif
+#ifdef WITH_LDPC_COMBINE
+  if(DecErr)
+  { DecErr=Radio_RxCombine(*RxPkt, *RxPacket);                         // try again together with earlier copies of this packet
+#ifdef WITH_LDPC_OSD
+    if(DecErr==0 && OSD.isBusy() && OSD_RxPkt.Time==RxPkt->Time && OSD_RxPkt.msTime==RxPkt->msTime)
+      OSD.Clear();                                                     // recovered by combining: the OSD is not needed for this frame
+#endif
+  }
+#endif
+  if(DecErr==0 && RxPacket->RxErr<10) Radio_RxAccept(RxPacketIdx);    // give up if too many bit errors
+  RxDupCache.Add(Hash, RxPkt->Time, DecErr);
+  // RxPkt->Print(CONS_UART_Write, 1);
+  LED_OFF();
+  return 1; }
+
+#ifdef WITH_LDPC_OSD
+static void Radio_OSD_Process(uint32_t Budget)                         // run the OSD for a time slice within the given budget [us]
+{ if(!OSD.isBusy() || Budget==0) return;
+  uint32_t Start=micros(); uint32_t Time=0;
+  while(OSD.isBusy() && Time<Budget)
+  { OSD.Process(); Time=micros()-Start; }
+  OSD.CPU_Time+=Time; OSD_Time+=Time;
+  if(OSD.isBusy())
+  { if(OSD_Time>=OSD_Budget) { OSD.Clear(); OSD.Timeout++; }         // give up when over the CPU budget
+    return; }
+  if(OSD.State!=LDPC_OSD::StateDone) { OSD.Clear(); return; }
+  OSD.Clear();
+  uint16_t RxPacketIdx = RelayQueue.getNew();
+  OGN_RxPacket<OGN1_Packet> *RxPacket = RelayQueue[RxPacketIdx];
+  OSD.Output(RxPacket->Packet.Byte());                                 // get the OSD result into the relay queue
+  uint8_t Erasures=OSD_RxPkt.ErrCount();                               // Manchester errors
+  uint8_t Flips=OSD_RxPkt.ErrCount(RxPacket->Packet.Byte());           // other bits changed by the OSD
+  if(!RxPacket->Packet.goodAddrParity() || !OSD.isReliable(Erasures, Flips)) { OSD.Rejected++; return; }
+  OSD_RxPkt.setRxInfo(*RxPacket, 1);                                   // RxErr = Erasures+Flips, up to 15: no RxErr<10 limit, isReliable() is the test
+  OSD.Recovered++;
+  Radio_RxAccept(RxPacketIdx); }
+#endif
 
 extern SX126x_t SX126x; // access to LoraWan102 driver parameters in LoraWan102/src/radio/radio.c
 
@@ -766,29 +1088,24 @@ static void ADSL_RxConfig(void)
 { Radio.SetRxConfig(MODEM_FSK, 200000, 100000, 0, 200000, 1, 100, 1, 48, 0, 0, 0, 0, true);
   OGN_UpdateConfig(ADSL_SYNC+1, 7); }
 
-static int Transmit(const uint8_t *Data, uint8_t PktLen=26, uint8_t *Sign=0, uint8_t SignLen=68)      // send packet, but first manchester encode it
-{ static uint8_t TxPacket[2*26+64+4];                                  // buffer to fit manchester encoded packet and the digital signature
-  uint8_t TxLen=0;
-  for(uint8_t Idx=0; Idx<PktLen; Idx++)
-  { uint8_t Byte=Data[Idx];
-    TxPacket[TxLen++]=ManchesterEncode[Byte>>4];                      // software manchester encode every byte
-    TxPacket[TxLen++]=ManchesterEncode[Byte&0x0F];
-  }
-  if(SignLen && Sign)
-  { for(uint8_t Idx=0; Idx<SignLen; Idx++)                            // digital signature
-    { uint8_t Byte=Sign[Idx];
-      TxPacket[TxLen++]=Byte; }                                       // copy the bytes directly, without Manchester encoding
-  }
-  Radio.Send(TxPacket, TxLen);
-  return TxLen; }
-
-static int OGN_Transmit(const OGN_TxPacket<OGN1_Packet> &TxPacket, uint8_t *Sign=0, uint8_t SignLen=68)
-{ OGN_TxConfig();
-  return Transmit(TxPacket.Byte(), TxPacket.Bytes, Sign, SignLen); }
-
-static int ADSL_Transmit(const ADSL_Packet &TxPacket, uint8_t *Sign=0, uint8_t SignLen=68) // transmit an ADS-L packet
-{ ADSL_TxConfig();
-  return Transmit(&(TxPacket.Version), TxPacket.TxBytes-3, Sign, SignLen); }
+static void TX_Arm(RFM_FSK_TxFrame &Frame)            // configure the radio for the frame: ahead of its TX time
+{ if(Frame.Len==0) return;                             // nothing to send: leave the radio receiving
+  CPU_Timer Start;                                     // SPI transfers to the radio: can take longer than a SysTick period
+  Radio.Standby();                                     // stop the RX first: a frame completed with the TX sync and length would be taken as received
+  if(Frame.SYNC==ADSL_SYNC) ADSL_TxConfig();
+                       else OGN_TxConfig();
+  Frame.Armed=1;
+  TX_ArmCycles.Add(Start.Elapsed()); }
+
+static int TX_Send(RFM_FSK_TxFrame &Frame, uint32_t Late) // at the TX time only send: the frame is encoded, the radio configured
+{ if(Frame.Len==0) return 0;
+  if(!Frame.Armed) { TX_Arm(Frame); TX_NotArmed++; }  // the loop came too late to arm it ahead
+  uint32_t Start=CPU_Cycles();
+  Radio.Send(Frame.Chips, Frame.Len);
+  TX_SendCycles.Add(CPU_CyclesSince(Start));
+  if(Late>TX_LateMax) TX_LateMax=Late;                 // [ms] after the TX time
+  uint8_t Len=Frame.Len; Frame.Clear();
+  return Len; }
 
 // ===============================================================================================
 
@@ -923,6 +1240,8 @@ void setup()
   OLED_Logo();
 
   GPS.begin(115200);                                  // Start the GPS
+  GPS_SetProfile(GPS_Profile);                        // only what we need: short burst after the PPS
+  GPS_Ring.setWindow(GPS_RATE_WINDOW/GPS_FixPeriod);  // [fixes] climb and turn rates over that many
 
   // Serial.println("GPS started");
   Radio_FreqPlan.setPlan(Parameters.FreqPlan);       // set the frequency plan from the parameters
@@ -966,6 +1285,7 @@ void setup()
 }
 
 static OGN_TxPacket<OGN1_Packet> TxPosPacket, TxStatPacket, TxRelPacket, TxInfoPacket; // OGN position, status and info packets
+static OGN_TxPacket<OGN1_Packet> TxPosPacket1; // OGN position packet for the 2nd slot: extrapolated to its own TX time
 static ADSL_Packet ADSL_TxPosPacket;           // ADS-L position packet
 
 // static uint8_t OGN_Sign[68];                // digital signature to be appended to some position packets
@@ -980,21 +1300,84 @@ static OGN_TxPacket<OGN1_Packet> *SignTxPkt=0;
 static OGN_TxPacket<OGN1_Packet> *ADSL_TxPkt=0;
 static bool ADSL_TxSlot=0;
 
+static GPS_Position TxPosFix;               // fix at the slot start: the position packets are made from it (or a newer fix)
+static OGN_TxPacket<OGN1_Packet> *TxPosPrep0=0, *TxPosPrep1=0; // position packets to be made just before their TX time
+const uint32_t TX_PrepLead  =   10;         // [ms] the position packet is made that long before its TX time
+const  int32_t TX_MaxExtrap = 1500;         // [ms] do not extrapolate further than that
+const uint32_t TX_ArmLead   =    2;         // [ms] the radio stops receiving and is configured for the frame that long before its TX time
+
+static RFM_FSK_TxFrame TX_Stage[2];         // radio-ready frames, one per slot: Radio.Send() is all that is left at the TX time
+
+static void TX_StageSlot(bool Slot, const OGN_TxPacket<OGN1_Packet> *TxPkt) // encode the frame of the slot: signed OGN, ADS-L or OGN
+{ RFM_FSK_TxFrame &Frame = TX_Stage[Slot];
+#ifdef WITH_DIG_SIGN
+  if(SignKey.SignReady && SignTxPkt==TxPkt) { Frame.Encode(OGN1_SYNC, TxPkt->Byte(), TxPkt->Bytes, SignKey.Signature, 68); return; }
+#else
+  if(ADSL_TxPkt==TxPkt && ADSL_TxSlot==Slot) { Frame.Encode(ADSL_SYNC, &(ADSL_TxPosPacket.Version), ADSL_TxPosPacket.TxBytes-3); return; }
+#endif
+  Frame.Encode(OGN1_SYNC, TxPkt->Byte(), TxPkt->Bytes); }
+
 static int32_t  RxRssiSum=0;                // sum RSSI readouts
 static int      RxRssiCount=0;              // count RSSI readouts
 
+#ifdef WITH_LOOKOUT
+static void LookOut_Process(const GPS_Position &GPS)          // predict collisions with the aircraft in the traffic table
+{ uint32_t Start=micros();
+  Look.setOwn(GPS.Speed, GPS.Heading, GPS.ClimbRate, GPS.TurnRate);
+  for(uint16_t Idx=0; Idx<TrafficTableSize; Idx++)
+  { OGN_Traffic *Acft = Traffic[Idx]; if(!Acft->Used) continue;
+    Acft->Warn=0;
+    if(!Traffic.calcRelative(*Acft)) continue;                // too far or no own position
+    int16_t Age=0;                                            // [ms] how much older the target position is than own
+    if(Acft->PosTime<60)
+    { int16_t Diff = GPS.Sec-Acft->PosTime;
+      if(Diff<(-30)) Diff+=60; else if(Diff>=30) Diff-=60;
+      Age = Diff*1000+GPS.mSec; }
+    int8_t Warn=Look.addTarget(Acft->AddressAndType, Acft->LonDist, Acft->LatDist, Acft->AltDist,
+                               Acft->Speed, Acft->Heading, Acft->ClimbRate, Acft->TurnRate, Age);
+    if(Warn<0) break;                                         // max. number of targets reached
+    Acft->Warn=Warn; }
+  LookOut_Time=micros()-Start;
+  if(LookOut_Time>LookOut_TimeMax) LookOut_TimeMax=LookOut_Time; }
+#endif
+
+static void TX_PrepPos(OGN_TxPacket<OGN1_Packet> &TxPacket, bool Slot, uint32_t TxTime) // make the position packet for the slot
+{ CPU_Timer Start;
+  const GPS_Position &Last = GPS_Ring.getLast();                  // at higher fix rates: newer than the fix at the slot start
+  const GPS_Position &Fix = Last.isValid() ? Last:TxPosFix;
+  int32_t dTime = (int32_t)TxTime - Fix.calcTimeDiff(TxPosFix) - TxPosFix.mSec; // [ms] from the fix to the TX time after the PPS
+  if(dTime<0) dTime=0; else if(dTime>TX_MaxExtrap) dTime=TX_MaxExtrap;
+  getPosPacket(TxPacket.Packet, Fix, dTime);                      // position where we will be at the TX time
+  TxPacket.Packet.Whiten();
+  TxPacket.calcFEC();                                             // position packet is ready for transmission
+#ifdef WITH_ADSL
+  if(ADSL_TxPkt==&TxPacket)                                       // ADS-L goes out in this slot
+  { GPS_Position Pos=Fix; Pos.Extrapolate(dTime);
+    getAdslPacket(ADSL_TxPosPacket, Pos);
+    ADSL_TxPosPacket.Scramble();                                  // this call hangs when -Os is used to compile
+    ADSL_TxPosPacket.setCRC(); }
+#endif
+  TX_StageSlot(Slot, &TxPacket);                                  // Manchester encoded, ready for the radio
+  TX_Extrap=dTime;
+  TX_PrepCycles.Add(Start.Elapsed()); }
+
 static void StartRFslot(void)                                     // start the TX/RX time slot right after the GPS stops sending data
 { if(RxRssiCount) { RX_RSSI.Process(RxRssiSum/RxRssiCount); RxRssiSum=0; RxRssiCount=0; }
 
   // Serial.printf("StartRFslot() #0\n");
   XorShift64(Random.Word);
-  GPS_Position &GPS = GPS_Pipe[GPS_Ptr];
+  GPS_Position &GPS = GPS_Ring.getLast();                     // the fix at the start of this second
   GPS_Satellites = GPS.Satellites;
   if(GPS.isTimeValid() && GPS.isDateValid()) { LED_Blue(); GPS_PPS_Time = GPS.getUnixTime(); }    // if time and date are valid
                                        else  { LED_Yellow(); }
   RX_OGN_Count64 += RX_OGN_Packets - RX_OGN_CountDelay.Input(RX_OGN_Packets); // add OGN packets received, subtract packets received 64 seconds ago
   RX_OGN_Packets=0;                                                           // clear the received packet count
+  RX_DecodedPrev=RX_Decoded; RX_Decoded=0;                                    // RX processing statistics for the past second
+  RX_BacklogPrev=RX_Backlog; RX_Backlog=0;
+  GPS_BytesPrev=GPS_Bytes; GPS_Bytes=0;                                       // GPS data in the past second
+  if(GPS_ProfileReq<GPS_Profiles) { GPS_SetProfile(GPS_ProfileReq); GPS_ProfileReq=0xFF; } // new profile: between the bursts
   CleanRelayQueue(GPS_PPS_Time);
+  Traffic.cleanTime(GPS_PPS_Time);                            // forget aircraft not heard for a minute
   bool TxPos=0;
   if(GPS.isValid())                                           // if position is valid
   { GPS_Altitude  = GPS.Altitude;                             // set global GPS variables
@@ -1002,23 +1385,25 @@ static void StartRFslot(void)                                     // start the T
     GPS_Longitude = GPS.Longitude;
     GPS_GeoidSepar= GPS.GeoidSeparation;
     GPS_LatCosine = GPS.LatitudeCosine;
+    Traffic.setRef(GPS_Latitude, GPS_Longitude, GPS_Altitude/10, GPS_LatCosine); // distances to other aircraft become out-of-date
+#ifdef WITH_LOOKOUT
+    LookOut_Process(GPS);
+#endif
     Radio_FreqPlan.setPlan(GPS_Latitude, GPS_Longitude);      // set Radio frequency plan
     GPS_Random_Update(GPS);
     XorShift64(Random.Word);
-    getPosPacket(TxPosPacket.Packet, GPS);                    // produce position packet to be transmitted
+    TxPosFix = GPS;                                           // position packets are made from it just before their TX time
 #ifdef WITH_DIG_SIGN
+    getPosPacket(TxPosPacket.Packet, GPS);                    // the signature covers the packet: made now, not extrapolated
     if(SignKey.KeysReady)
     { SignKey.Hash(GPS_PPS_Time, TxPosPacket.Packet.Byte(), TxPosPacket.Packet.Bytes); // produce SHA256 hash (takes below 1ms)
       SignTxPkt = &TxPosPacket; }
-#endif
     TxPosPacket.Packet.Whiten();
     TxPosPacket.calcFEC();                                    // position packet is ready for transmission
+#endif
 #ifdef WITH_ADSL
-    ADSL_TxPkt = &TxPosPacket;
-    getAdslPacket(ADSL_TxPosPacket, GPS);
-    ADSL_TxPosPacket.Scramble();                              // this call hangs when -Os is used to compile
-    ADSL_TxPosPacket.setCRC();
     ADSL_TxSlot = Random.GPS&0x20;
+    ADSL_TxPkt = ADSL_TxSlot ? &TxPosPacket1:&TxPosPacket;   // made with the OGN position packet of that slot
 #endif
     TxPos=1; }
   // Serial.printf("StartRFslot() #1\n");
@@ -1037,8 +1422,16 @@ static void StartRFslot(void)                                     // start the T
   Radio.RxBoosted(0);
   TxTime0 = Random.RX  % 389;                                 // transmit times within slots
   TxTime1 = Random.GPS % 299;
-  TxPkt0=TxPkt1=0;
-  if(TxPos) TxPkt0 = TxPkt1 = &TxPosPacket;
+  TxPkt0=TxPkt1=0; TxPosPrep0=TxPosPrep1=0;
+  if(TxPos)
+  {
+#ifdef WITH_DIG_SIGN
+    TxPkt0 = TxPkt1 = &TxPosPacket;                           // signed: made at the slot start
+#else
+    TxPkt0 = TxPosPrep0 = &TxPosPacket;                       // made just before the TX time, extrapolated to it
+    TxPkt1 = TxPosPrep1 = &TxPosPacket1;
+#endif
+  }
   static uint8_t InfoTxBackOff=0;
   static uint8_t InfoToggle=0;
   if(InfoTxBackOff) InfoTxBackOff--;
@@ -1061,7 +1454,6 @@ static void StartRFslot(void)                                     // start the T
   { if(Random.RX&0x20) TxPkt1 = &TxRelPacket;
                   else TxPkt0 = &TxRelPacket;
     RelayTxBackOff = Random.RX%3; }
-  GPS_Next();
   XorShift64(Random.Word);
 #ifdef WITH_DIG_SIGN
   static uint8_t SignTxBackOff=0;
@@ -1078,46 +1470,101 @@ static void StartRFslot(void)                                     // start the T
       SignTxBackOff = 6 + (Random.RX%7); }
   }
 #endif
+  TX_Stage[0].Clear(); TX_Stage[1].Clear();
+  if(TxPkt0 && TxPkt0!=TxPosPrep0) TX_StageSlot(0, TxPkt0);     // frames not waiting for the extrapolation: ready now
+  if(TxPkt1 && TxPkt1!=TxPosPrep1) TX_StageSlot(1, TxPkt1);
   TxTime0 += 400;
   TxTime1 += 800;
   LED_OFF();
 }
 
+const uint32_t RX_DrainMax   = 20000;       // [us] max. time to drain the RxFIFO in one pass of the loop()
+const uint32_t RX_DrainGPS   =  5000;       // [us] same but when the GPS is sending data
+const uint32_t RX_TxMargin   =  2000;       // [us] keep that much before the next transmission or slot change
+
+static uint32_t Radio_RxBudget(uint32_t Max) // [us] time for the RX processing before the next TX deadline
+{ uint32_t SysTime = millis() - GPS_PPS_ms;
+  uint32_t Deadline;
+  if(RF_Slot==0) Deadline = TxPkt0 ? TxTime0-(TxPkt0==TxPosPrep0 ? TX_PrepLead:0) : 800; // 1st slot: transmission (or making its packet) or the slot change
+  else if(TxPkt1) Deadline = TxTime1-(TxPkt1==TxPosPrep1 ? TX_PrepLead:0);            // 2nd slot: transmission
+  else return Max;
+  if(SysTime>=Deadline) return 0;
+  uint32_t Budget = (Deadline-SysTime)*1000;
+  if(Budget<=RX_TxMargin) return 0;
+  Budget-=RX_TxMargin;
+  return Budget<Max ? Budget:Max; }
+
+static void Radio_RxDrain(void)             // process packets from the RxFIFO as long as the time budget allows
+{ uint8_t Backlog=RxFIFO.Full(); if(Backlog==0) return;
+  if(Backlog>RX_Backlog) RX_Backlog=Backlog;
+  uint32_t Max = GPS_Done ? RX_DrainMax:RX_DrainGPS;
+  uint32_t Budget=Radio_RxBudget(Max);
+  uint32_t Need = RX_ProcMax<Max ? RX_ProcMax:Max;               // [us] expected time for one more packet
+  uint32_t Start=micros();
+  for( ; ; )
+  { if(RxFIFO.isEmpty()) break;
+    uint32_t Time=micros()-Start;
+    if(Budget==0 || Time+Need>Budget) { RX_BudgetStop++; break; } // no time for another packet: maybe in the next pass
+    if(!Radio_RxProcess()) break;
+    Time=micros()-Start-Time;
+    RX_ProcMax-=RX_ProcMax>>4;                                    // let the max. decay slowly
+    if(Time>RX_ProcMax) RX_ProcMax=Time;
+    Need = RX_ProcMax<Max ? RX_ProcMax:Max;
+    RX_Decoded++; }
+}
+
 void loop()
 {
   Button_Process();                                               // check for button short/long press
   if(Button_LowPower) { Sleep(); return; }                        // enter deep sleep when power-off requested
 
-  Radio_RxProcess();                                              // process received packets, if any
+  Radio_RxDrain();                                                // process received packets, if any, within the time budget
+#ifdef WITH_LDPC_OSD
+  if(GPS_Done && RxFIFO.Full()==0) Radio_OSD_Process(Radio_RxBudget(OSD_Slice)); // when GPS and RX are idle and no TX is due: try to recover a failed packet
+#endif
 
   CONS_Proc();                                                    // process input from the console
-  if(GPS_Process()==0) { GPS_Idle++; /* delay(1); */ }                  // process input from the GPS
-                  else { GPS_Idle=0; RxRssiSum+=2*Radio.Rssi(MODEM_FSK); RxRssiCount++; } // [0.5dBm]
+  int GPS_Count=GPS_Process();                                    // process input from the GPS
+  if(GPS_Count==0) { GPS_Idle++; /* delay(1); */ }
+              else { GPS_Idle=0; GPS_BurstEnd=millis(); RxRssiSum+=2*Radio.Rssi(MODEM_FSK); RxRssiCount++; } // [0.5dBm]
   if(GPS_Done)                                                    // if state is GPS not sending data
   { if(GPS_Idle<2)                                                // GPS (re)started sending data
     { GPS_Done=0;                                                 // change the state to GPS is sending data
-      GPS_PPS_ms = millis() - Parameters.PPSdelay;                // record the est. PPS time
-      // printf("GPS slot: start: %d [ms]\n\r", millis());
-      GPS_PPS_Time++; }
+      uint32_t Start = micros() - GPS_Count*GPS_ByteTime;         // [us] the first byte: the bytes taken were arriving for that long
+      GPS_BurstStart = millis() - (micros()-Start)/1000;          // [ms]
+      GPS_SecBurst = GPS_BurstStart-GPS_SecStart >= 1000-GPS_FixPeriod/2; // the burst after the PPS: the others follow every fix period
+      if(GPS_SecBurst)
+      { GPS_SecStart = GPS_BurstStart;
+        PPS.Process(Start);                                       // follow the early edge of the burst starts
+        if(PPS.isLocked()) Start=PPS.getTime();                   // estimated burst start, free of the loop latency
+        GPS_PPS_ms = millis() - (int32_t)(micros()-Start)/1000 - Parameters.PPSdelay; // record the est. PPS time: the estimate can be after the measurement
+        // printf("GPS slot: start: %d [ms]\n\r", millis());
+        GPS_PPS_Time++; }
+    }
   }
   else
   { if(GPS_Idle>10)                                               // GPS stopped sending data
     { // printf("GPS slot stop: %d [ms]\n\r", millis());
-      StartRFslot();                                              // start the RF slot
+      GPS_BurstLen = GPS_BurstEnd-GPS_BurstStart;                 // [ms] how long the GPS was sending
+#ifdef WITH_GPS_CASIC
+      if(GPS_Watch.BurstEnd() && GPS_Profile==GPS_ProfileBinary && GPS_ProfileReq>=GPS_Profiles)
+      { GPS_ProfileReq=GPS_ProfileNMEA; GPS_Fallbacks++; }       // NAK or no NAV-PV: back to NMEA positions, sent between the bursts
+#endif
+      if(GPS_BurstLen>GPS_BurstMax) GPS_BurstMax=GPS_BurstLen;
+      GPS_Next();                                                 // every burst is a fix
+      if(GPS_SecBurst)                                            // but the RF slots start once per second
+      { GPS_SlotDelay = millis()-GPS_PPS_ms;                      // [ms] RF slot start after the PPS
+        StartRFslot(); }                                          // start the RF slot
       GPS_Done=1; }
   }
 
   uint32_t SysTime = millis() - GPS_PPS_ms;
   if(RF_Slot==0)                                                  // 1st half of the second
-  { if(TxPkt0 && SysTime >= TxTime0)                              //
-    { int TxLen=0;
-#ifdef WITH_DIG_SIGN
-      if(SignKey.SignReady && SignTxPkt==TxPkt0) TxLen=OGN_Transmit(*TxPkt0, SignKey.Signature);
-                                            else TxLen=OGN_Transmit(*TxPkt0);
-#else
-      if(ADSL_TxPkt==TxPkt0 && ADSL_TxSlot==0) TxLen=ADSL_Transmit(ADSL_TxPosPacket);
-                                          else TxLen=OGN_Transmit(*TxPkt0);
-#endif
+  { if(TxPkt0 && TxPkt0==TxPosPrep0 && SysTime+TX_PrepLead >= TxTime0)
+    { TX_PrepPos(*TxPkt0, 0, TxTime0); TxPosPrep0=0; }           // position packet: extrapolated to the TX time
+    if(TxPkt0 && !TX_Stage[0].Armed && SysTime+TX_ArmLead >= TxTime0) TX_Arm(TX_Stage[0]); // radio configured ahead
+    if(TxPkt0 && SysTime >= TxTime0)                              //
+    { int TxLen=TX_Send(TX_Stage[0], SysTime-TxTime0);
       // Serial.printf("TX[0]:%4dms %08X [%d:%d] [%2d]\n",
       //          SysTime, TxPkt0->Packet.HeaderWord, SignKey.SignReady, SignTxPkt==TxPkt0, TxLen);
       TxPkt0=0; }
@@ -1129,15 +1576,11 @@ void loop()
       // printf("Slot #1: %d\r\n", SysTime);
     }
   } else                                                          // 2nd half of the second
-  { if(TxPkt1 && SysTime >= TxTime1)
-    { int TxLen=0;
-#ifdef WITH_DIG_SIGN
-      if(SignKey.SignReady && SignTxPkt==TxPkt1) TxLen=OGN_Transmit(*TxPkt1, SignKey.Signature);
-                                            else TxLen=OGN_Transmit(*TxPkt1);
-#else
-      if(ADSL_TxPkt==TxPkt1 && ADSL_TxSlot==1) TxLen=ADSL_Transmit(ADSL_TxPosPacket);
-                                          else TxLen=OGN_Transmit(*TxPkt1);
-#endif
+  { if(TxPkt1 && TxPkt1==TxPosPrep1 && SysTime+TX_PrepLead >= TxTime1)
+    { TX_PrepPos(*TxPkt1, 1, TxTime1); TxPosPrep1=0; }
+    if(TxPkt1 && !TX_Stage[1].Armed && SysTime+TX_ArmLead >= TxTime1) TX_Arm(TX_Stage[1]);
+    if(TxPkt1 && SysTime >= TxTime1)
+    { int TxLen=TX_Send(TX_Stage[1], SysTime-TxTime1);
       // Serial.printf("TX[1]:%4dms %08X [%d:%d] [%2d]\n",
       //          SysTime, TxPkt1->Packet.HeaderWord, SignKey.SignReady, SignTxPkt==TxPkt1, TxLen);
       TxPkt1=0; }
@@ -0,0 +1,70 @@
+#ifndef __CYCLES_H__
+#define __CYCLES_H__
+
+#include <stdint.h>
+
+#include "format.h"
+
+// CPU cycle counting to measure short code sections like the radio callbacks.
+// The Cortex-M0+ has no DWT cycle counter, thus the SysTick (counting down, reloaded every system tick) is used.
+// CPU_CyclesSince() is only right for sections shorter than one SysTick period. Without the SysTick, micros() is used.
+// Longer sections, like the radio configuration over SPI, are measured with a CPU_Timer.
+
+#ifndef CPU_MHz
+#define CPU_MHz 48                                      // [MHz] CPU clock: ASR6502 runs at 48MHz
+#endif
+
+#ifdef SysTick
+inline uint32_t CPU_Cycles(void) { return SysTick->VAL; }
+inline uint32_t CPU_CyclesSince(uint32_t Start)         // [cycles] elapsed since Start=CPU_Cycles()
+{ uint32_t Now=SysTick->VAL;
+  if(Start>=Now) return Start-Now;
+  return Start+(SysTick->LOAD+1)-Now; }                 // SysTick was reloaded in between
+inline uint32_t CPU_TickCycles(void) { return SysTick->LOAD+1; } // [cycles] SysTick period
+#else
+inline uint32_t CPU_Cycles(void) { return micros(); }
+inline uint32_t CPU_CyclesSince(uint32_t Start) { return (micros()-Start)*CPU_MHz; }
+inline uint32_t CPU_TickCycles(void) { return 0xFFFFFFFF; }
+#endif
+
+class CPU_Timer                                         // start of a code section which can be longer than the SysTick period
+{ public:
+   uint32_t Cycles;                                     // CPU_Cycles() at the start
+   uint32_t usTime;                                     // [us] micros() at the start: detects the SysTick wrapping more than once
+
+  public:
+   CPU_Timer() { Start(); }
+   void Start(void) { usTime=micros(); Cycles=CPU_Cycles(); }
+
+   uint32_t Elapsed(void) const                         // [cycles] since Start()
+   { uint32_t Short=CPU_CyclesSince(Cycles);
+     uint32_t Long=(micros()-usTime)*CPU_MHz;
+     if(Long>=CPU_TickCycles()/2) return Long;          // the SysTick count is ambiguous: take micros() with less resolution
+     return Short; }
+} ;
+
+class CycleStat                                         // number of calls, average and max. CPU cycles
+{ public:
+   uint32_t Count;
+   uint64_t Sum;                                        // 64-bit: a 32-bit sum overflows within hours
+   uint32_t Max;
+
+  public:
+   CycleStat() { Clear(); }
+   void Clear(void) { Count=0; Sum=0; Max=0; }
+
+   void Add(uint32_t Cycles)
+   { Count++; Sum+=Cycles; if(Cycles>Max) Max=Cycles; }
+
+   uint32_t Average(void) const { return Count ? (Sum+Count/2)/Count : 0; }
+
+   uint8_t Print(char *Out) const                       // print: count, average and max. [cycles]
+   { uint8_t Len=0;
+     Len+=Format_UnsDec(Out+Len, Count);
+     Out[Len++]='x'; Len+=Format_UnsDec(Out+Len, Average());
+     Out[Len++]='/'; Len+=Format_UnsDec(Out+Len, Max);
+     Len+=Format_String(Out+Len, "cyc");
+     Out[Len]=0; return Len; }
+} ;
+
+#endif // __CYCLES_H__
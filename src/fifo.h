@@ -3,6 +3,8 @@
 
 #include <stdint.h>
 
+#include "format.h"
+
 template <class Type, const size_t Size=8> // size must be (!) a power of 2 like 4, 8, 16, 32, etc.
  class FIFO
 { public:
@@ -75,6 +77,15 @@ template <class Type, const size_t Size=8> // size must be (!) a power of 2 like
    void flushReadBlock(size_t Len)       // flush the elements which were already read: to be used after getReadBlock()
    { ReadPtr+=Len; ReadPtr&=PtrMask; }
 
+   size_t getWriteBlock(Type *&Byte)     // get a pointer to the first free element and the number of consecutive elements which can be written
+   { Byte = Data+WritePtr;
+     size_t Space=Free();
+     size_t End=Size-WritePtr;
+     return Space<End ? Space:End; }
+
+   void flushWriteBlock(size_t Len)      // advance the write pointer after writing elements: to be used after getWriteBlock()
+   { WritePtr+=Len; WritePtr&=PtrMask; }
+
    bool isEmpty(void) const              // is the FIFO all empty ?
    { return ReadPtr==WritePtr; }
 
@@ -102,6 +113,86 @@ template <class Type, const size_t Size=8> // size must be (!) a power of 2 like
 */
 } ;
 
+// Single-producer single-consumer FIFO which can be written from an interrupt (or another thread) and read from the main loop.
+// The counters run freely and are published with acquire/release so the elements are complete when seen on the other side.
+// When full: the drop-newest policy refuses the new element, the drop-oldest policy overwrites the oldest one
+// and the consumer skips it: it copies an element out and checks the producer did not start to overwrite it meanwhile.
+// Counters: DropNew by the producer, DropOld by the consumer, HighWater by the producer.
+
+template <class Type, const uint32_t Size=8, const bool DropOldest=0> // size must be (!) a power of 2 like 4, 8, 16, 32, etc.
+ class SPSC_FIFO
+{ public:
+   static const uint32_t Len = Size;
+   static const uint32_t PtrMask = Size-1;
+
+   Type Data[Len];
+   uint32_t WriteStart;                  // [elements] started to be written: by the producer
+   uint32_t WriteCount;                  // [elements] written and complete: by the producer
+   uint32_t ReadCount;                   // [elements] read: by the consumer
+   uint32_t DropNew;                     // [elements] refused as the FIFO was full: drop-newest policy
+   uint32_t DropOld;                     // [elements] overwritten before being read: drop-oldest policy
+   uint32_t HighWater;                   // [elements] max. number of elements stored
+
+  public:
+   void Clear(void)                      // clear all stored data and the counters: not while the producer or consumer is active
+   { WriteStart=0; WriteCount=0; ReadCount=0; DropNew=0; DropOld=0; HighWater=0; }
+
+   uint32_t Full(void) const             // number of stored elements
+   { uint32_t Count = __atomic_load_n(&WriteCount, __ATOMIC_ACQUIRE) - __atomic_load_n(&ReadCount, __ATOMIC_ACQUIRE);
+     return Count>Size ? Size:Count; }
+
+   bool isEmpty(void) const { return Full()==0; }
+
+   // producer side
+
+   Type *getWrite(void)                  // get the next element to be written, null when full and dropping the newest
+   { uint32_t Write=WriteCount;
+     uint32_t Read=__atomic_load_n(&ReadCount, __ATOMIC_ACQUIRE);
+     if((Write-Read)>=Size && !DropOldest) { DropNew++; return 0; }
+     if(DropOldest)
+     { __atomic_store_n(&WriteStart, Write+1, __ATOMIC_RELAXED); // tell the consumer this element is being (over)written
+       __atomic_thread_fence(__ATOMIC_SEQ_CST); }
+     return Data+(Write&PtrMask); }
+
+   void Write(void)                      // publish the element obtained by getWrite()
+   { uint32_t Write=WriteCount+1;
+     __atomic_store_n(&WriteCount, Write, __ATOMIC_RELEASE);
+     uint32_t Count = Write-__atomic_load_n(&ReadCount, __ATOMIC_ACQUIRE);
+     if(Count>Size) Count=Size;
+     if(Count>HighWater) HighWater=Count; }
+
+   bool Write(const Type &Elem)          // write a single element, return false when dropped
+   { Type *Ptr=getWrite(); if(Ptr==0) return 0;
+     *Ptr=Elem; Write(); return 1; }
+
+   // consumer side
+
+   bool Read(Type &Elem)                 // copy out the oldest element, return false when empty
+   { for( ; ; )
+     { uint32_t Read=ReadCount;
+       uint32_t Write=__atomic_load_n(&WriteCount, __ATOMIC_ACQUIRE);
+       if(Write==Read) return 0;
+       if((Write-Read)>Size) { DropOld+=(Write-Size)-Read; Read=Write-Size; } // overwritten: skip to the oldest one still there
+       Elem=Data[Read&PtrMask];
+       if(!DropOldest) { __atomic_store_n(&ReadCount, Read+1, __ATOMIC_RELEASE); return 1; }
+       __atomic_thread_fence(__ATOMIC_SEQ_CST);
+       uint32_t Start=__atomic_load_n(&WriteStart, __ATOMIC_RELAXED);
+       if((Start-Read)>Size) { DropOld++; Read++; __atomic_store_n(&ReadCount, Read, __ATOMIC_RELEASE); continue; } // being overwritten while copied
+       __atomic_store_n(&ReadCount, Read+1, __ATOMIC_RELEASE);
+       return 1; }
+   }
+
+   uint8_t Print(char *Out) const        // print: stored/size, high-water mark, dropped new and old elements
+   { uint8_t Len=0;
+     Len+=Format_UnsDec(Out+Len, Full());
+     Out[Len++]='/'; Len+=Format_UnsDec(Out+Len, Size);
+     Len+=Format_String(Out+Len, " HW:"); Len+=Format_UnsDec(Out+Len, HighWater);
+     Len+=Format_String(Out+Len, " drop:");
+     Len+=Format_UnsDec(Out+Len, DropNew); Out[Len++]='/'; Len+=Format_UnsDec(Out+Len, DropOld);
+     Out[Len]=0; return Len; }
+
+} ;
+
 template <class Type, const uint8_t Size=8> // size must be (!) a power of 2 like 4, 8, 16, 32, etc.
  class Delay
 { public:
@@ -1,5 +1,6 @@
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "ldpc.h"
 
@@ -197,6 +198,65 @@ PROGMEM
  { 0x55CD3406, 0x5E1F7407, 0x63F2D35A, 0x5ACAFEA4, 0x7E48A8DF  }
 } ;
 
+#ifndef __AVR__
+// syndromes of single bit errors: (Syndrome<<16) | BitIndex, sorted for a binary search
+// bit 0 of the syndrome is parity check 0, 48 parity checks => upper 48 bits
+static const uint64_t LDPC_SyndromeColumn_n208k160[208]
+= {
+  0x00000000003F0000, 0x0000000007C1000B, 0x000000000C200098, 0x0000000080600021,
+  0x00000000F80100B2, 0x0000000112080008, 0x00000001209000B7, 0x0000000209080045,
+  0x0000000240500065, 0x000000040A1000A8, 0x000000081110004B, 0x0000001000A000CD,
+  0x0000001F0001007D, 0x0000002001200019, 0x000000222204000E, 0x000000244088003D,
+  0x000000288000004D, 0x0000003010000055, 0x000000400220009E, 0x000000414104005F,
+  0x00000042108200CF, 0x000000440400001B, 0x0000004820480029, 0x000000500800005C,
+  0x0000008010200012, 0x0000008082000030, 0x00000084210200CB, 0x00000088088400C2,
+  0x0000010020200096, 0x0000010104000009, 0x000001041044009B, 0x00000108420200BC,
+  0x000001100100009D, 0x0000020040200060, 0x00000210840200C4, 0x000003E00001005A,
+  0x00000402002000B4, 0x00000421084200CA, 0x00000490001000A3, 0x00000500800800CE,
+  0x0000060000800078, 0x0000080100200091, 0x000008100040003F, 0x00000880040800BE,
+  0x00000A0001000073, 0x0000100080800080, 0x0000100400200090, 0x00001020041000A9,
+  0x000010800040001A, 0x0000110008000024, 0x00002000140000A7, 0x0000200800200014,
+  0x00002040801000C5, 0x0000208040000054, 0x000021000080008A, 0x0000400024000031,
+  0x00004000810000A1, 0x0000401002000071, 0x000040810000003A, 0x0000410200000028,
+  0x00007C0000010025, 0x0000800180000053, 0x0000808200000095, 0x0000900001000011,
+  0x0000A010000800BF, 0x0000C200001000A0, 0x00010000440000B3, 0x000100102000006F,
+  0x0001020000400085, 0x000104000100009C, 0x000120000200001E, 0x0002000204000052,
+  0x000200048000000C, 0x0002020002000062, 0x000204001000001D, 0x0002090000100048,
+  0x00024000002000AD, 0x000400028000007A, 0x0004000804000076, 0x000400104000003E,
+  0x000404000200008C, 0x0004080000800044, 0x000410001000003C, 0x0008040020000050,
+  0x0008080002000004, 0x00081200000800BA, 0x0008200000400039, 0x000F800000010086,
+  0x0010020008000082, 0x0010040040000046, 0x0010200001000074, 0x00114000000800CC,
+  0x00121010000400C0, 0x00180000002000AB, 0x0020020010000061, 0x00200800080000C6,
+  0x002020002000002D, 0x00204000004000B8, 0x00208400040400B5, 0x0024000000200018,
+  0x004002002000006D, 0x004004040000007F, 0x0040100002000017, 0x00404000008000A2,
+  0x004080000020007E, 0x0041080080040038, 0x00480000010000C8, 0x008002010000008F,
+  0x008004080000006B, 0x008008001000003B, 0x0080100020000036, 0x0080200008000067,
+  0x0080800000400026, 0x0082000000800081, 0x0088000004000064, 0x0100044000000015,
+  0x0100080020000020, 0x0100100040000097, 0x0100400008000072, 0x010080000080009A,
+  0x0101000000200094, 0x0102000000400092, 0x0104220000040027, 0x01F00000000100A5,
+  0x020002020000004C, 0x020010010000006E, 0x0200200400000093, 0x02040000004000B9,
+  0x0210880000020037, 0x02220000000800BB, 0x024000000400008D, 0x028100000010000A,
+  0x0300000001000070, 0x0400020400000077, 0x040008004000007B, 0x040020010000000D,
+  0x0400400010000084, 0x040080000200006C, 0x0402000001000005, 0x0408000000800075,
+  0x041000000040000F, 0x04211000000200C3, 0x0444000000080041, 0x05000000001000BD,
+  0x0800020800000013, 0x0800080200000043, 0x0800104000000016, 0x0800400040000049,
+  0x080080000800002F, 0x0801000000800001, 0x0808000010000063, 0x08140000001000B6,
+  0x0820000001000066, 0x08422000000200B0, 0x0900000002000006, 0x1000080400000032,
+  0x100010020000002E, 0x10002020000000B1, 0x1000800010000003, 0x1001000008000057,
+  0x1002000020000007, 0x1010000000800042, 0x102800000010004E, 0x104000000040002A,
+  0x108440000002002B, 0x11000000000800AF, 0x200008080000001C, 0x200020020000005E,
+  0x2000400400000010, 0x200080002000006A, 0x200100001000004F, 0x2002000008000058,
+  0x200400000100007C, 0x2010000002000033, 0x2020000000800059, 0x20400000001000A6,
+  0x2080000000200088, 0x3E00000000010002, 0x400008200000001F, 0x4000100800000022,
+  0x4000404000000083, 0x4000800040000035, 0x400100010000005D, 0x4002008000000068,
+  0x4004000008000047, 0x4010000004000023, 0x40200000020000AC, 0x4040000010000056,
+  0x42000000002000AA, 0x448000000004004A, 0x48000000004000A4, 0x5000000001000051,
+  0x61080000000200C7, 0x800008400000002C, 0x80008004000000C9, 0x8001000200000034,
+  0x8002000040000099, 0x800400002000008B, 0x801000001000005B, 0x8020000080000040,
+  0x8040000008000087, 0x8100000004000079, 0x8208400000040089, 0x840000000020008E,
+  0x88800000000800C1, 0x9000000002000069, 0xA00000000040009F, 0xC0000000000100AE } ;
+#endif
+
 
 // ===================================================================================================================
 
@@ -675,7 +735,10 @@ void LDPC_Encode(const uint8_t *Data, uint8_t *Parity, const uint32_t ParityGen[
 }
 
 void LDPC_Encode(const uint8_t *Data, uint8_t *Parity)
-{ LDPC_Encode(Data, Parity, LDPC_ParityGen_n208k160); }
+{ uint32_t DataWord[5]; uint32_t ParWord[2];
+  memcpy(DataWord, Data, 20);                             // Data may not be aligned to 32-bit words
+  LDPC_Encode(DataWord, ParWord);
+  memcpy(Parity, ParWord, 6); }
 
 void LDPC_Encode(uint8_t *Data)
 { LDPC_Encode(Data, Data+20); }
@@ -695,8 +758,74 @@ static void LDPC_Encode(const uint32_t *Data, uint32_t *Parity, uint8_t DataWord
   // printf(" => %08X %08X\n", Parity[0], Parity[1] );
 }
 
-void LDPC_Encode(const uint32_t *Data, uint32_t *Parity) { LDPC_Encode(Data, Parity, 5, 48, (uint32_t *)LDPC_ParityGen_n208k160); }
-void LDPC_Encode(      uint32_t *Data)                   { LDPC_Encode(Data, Data+5, 5, 48, (uint32_t *)LDPC_ParityGen_n208k160); }
+void LDPC_Encode_ParityGen(const uint32_t *Data, uint32_t *Parity) { LDPC_Encode(Data, Parity, 5, 48, (uint32_t *)LDPC_ParityGen_n208k160); }
+
+#ifdef LDPC_ENCODE_BYTE_TABLE
+void LDPC_Encode_ByteTable(const uint32_t *Data, uint32_t *Parity)
+{ uint16_t Par0=0, Par1=0, Par2=0;
+  const uint16_t (*Table)[3] = LDPC_ParityByte_n208k160[0];
+  for(uint8_t Idx=0; Idx<5; Idx++)
+  { uint32_t Word=Data[Idx];
+    for(uint8_t Byte=0; Byte<4; Byte++)
+    { const uint16_t *Par = Table[Word&0xFF];
+      Par0^=Par[0]; Par1^=Par[1]; Par2^=Par[2];
+      Word>>=8; Table+=256; }
+  }
+  Parity[0] = ((uint32_t)Par1<<16) | Par0;
+  Parity[1] = Par2; }
+#endif
+
+#ifdef LDPC_ENCODE_NIBBLE_TABLE
+void LDPC_Encode_NibbleTable(const uint32_t *Data, uint32_t *Parity)
+{ uint16_t Par0=0, Par1=0, Par2=0;
+  const uint16_t (*Table)[3] = LDPC_ParityNibble_n208k160[0];
+  for(uint8_t Idx=0; Idx<5; Idx++)
+  { uint32_t Word=Data[Idx];
+    for(uint8_t Nibble=0; Nibble<8; Nibble++)
+    { const uint16_t *Par = Table[Word&0x0F];
+      Par0^=Par[0]; Par1^=Par[1]; Par2^=Par[2];
+      Word>>=4; Table+=16; }
+  }
+  Parity[0] = ((uint32_t)Par1<<16) | Par0;
+  Parity[1] = Par2; }
+#endif
+
+void LDPC_Encode(const uint32_t *Data, uint32_t *Parity)
+{
+#if defined(LDPC_ENCODE_BYTE_TABLE)
+  LDPC_Encode_ByteTable(Data, Parity);
+#elif defined(LDPC_ENCODE_NIBBLE_TABLE)
+  LDPC_Encode_NibbleTable(Data, Parity);
+#else
+  LDPC_Encode_ParityGen(Data, Parity);
+#endif
+}
+
+void LDPC_Encode(      uint32_t *Data) { LDPC_Encode(Data, Data+5); }
+
+// update the parity after some bits of one data word have been flipped: the code is linear
+// thus only the parity of the flipped bits needs to be added
+void LDPC_UpdateParity(uint32_t *Parity, uint8_t WordIdx, uint32_t Flip)
+{ uint16_t Par0=0, Par1=0, Par2=0;
+#if defined(LDPC_ENCODE_BYTE_TABLE)
+  const uint16_t (*Table)[3] = LDPC_ParityByte_n208k160[WordIdx*4];
+  for( ; Flip; Flip>>=8, Table+=256)
+  { const uint16_t *Par = Table[Flip&0xFF];
+    Par0^=Par[0]; Par1^=Par[1]; Par2^=Par[2]; }
+#elif defined(LDPC_ENCODE_NIBBLE_TABLE)
+  const uint16_t (*Table)[3] = LDPC_ParityNibble_n208k160[WordIdx*8];
+  for( ; Flip; Flip>>=4, Table+=16)
+  { const uint16_t *Par = Table[Flip&0x0F];
+    Par0^=Par[0]; Par1^=Par[1]; Par2^=Par[2]; }
+#else
+  uint32_t Mask=1;
+  for(uint8_t Row=0; Row<48; Row++)
+  { if(Count1s(LDPC_ParityGen_n208k160[Row][WordIdx]&Flip)&1)
+    { if(Row<16) Par0|=Mask; else if(Row<32) Par1|=Mask; else Par2|=Mask; }
+    Mask<<=1; if(Mask==0x10000) Mask=1; }
+#endif
+  Parity[0] ^= ((uint32_t)Par1<<16) | Par0;
+  Parity[1] ^= Par2; }
 
 #ifdef WITH_PPM
 void LDPC_Encode_n354k160(const uint32_t *Data, uint32_t *Parity) { LDPC_Encode(Data, Parity, 5, 194, (uint32_t *)LDPC_ParityGen_n354k160); }
@@ -728,6 +857,56 @@ uint8_t LDPC_Check(const uint8_t *Data) // 20 data bytes followed by 6 parity by
     { uint8_t And = Data[Idx]&Check[Idx]; Count+=Count1s(And); }
     if(Count&1) Errors++; }
   return Errors; }
+
+// calculate the syndrome: bit set for every failed parity check
+uint64_t LDPC_Syndrome(const uint32_t *Data) // 5 data words followed by 1.5 parity words
+{ uint64_t Syndrome=0; uint64_t Mask=1;
+  for(uint8_t Row=0; Row<48; Row++)
+  { const uint32_t *Check=LDPC_ParityCheck_n208k160[Row];
+    uint32_t Word=(Data[5]&Check[5]) ^ ((Data[6]&Check[6])&0xFFFF);
+    for(uint8_t Idx=0; Idx<5; Idx++)
+      Word^=Data[Idx]&Check[Idx];
+    if(Count1s(Word)&1) Syndrome|=Mask;
+    Mask<<=1; }
+  return Syndrome; }
+
+uint64_t LDPC_ColumnSyndrome(uint8_t Bit)                 // syndrome of a single bit error = column of the parity check matrix
+{ uint64_t Col=0; uint32_t Mask=(uint32_t)1<<(Bit&31); uint8_t Idx=Bit>>5;
+  for(uint8_t Row=0; Row<48; Row++)
+  { if(LDPC_ParityCheck_n208k160[Row][Idx]&Mask) Col|=(uint64_t)1<<Row; }
+  return Col; }
+
+static int16_t LDPC_SyndromeBit(uint64_t Syndrome) // find which single bit error gives this syndrome
+{ uint8_t Low=0; uint8_t High=208;
+  while(Low<High)
+  { uint8_t Mid=(Low+High)>>1;
+    uint64_t Col=LDPC_SyndromeColumn_n208k160[Mid]>>16;
+    if(Col==Syndrome) return LDPC_SyndromeColumn_n208k160[Mid]&0xFFFF;
+    if(Col<Syndrome) Low=Mid+1;
+                else High=Mid; }
+  return -1; }
+
+// correct one or two bit errors using the syndrome: return the number of bits corrected
+// or -1 if the syndrome does not correspond to a single/double error or the double error is ambiguous
+int8_t LDPC_CorrectSyndrome(uint32_t *Data, uint64_t Syndrome)
+{ if(Syndrome==0) return 0;
+  int16_t Bit=LDPC_SyndromeBit(Syndrome);
+  if(Bit>=0) { Data[Bit>>5]^=(uint32_t)1<<(Bit&31); return 1; }
+  uint8_t Row=0;                                         // a double error must have exactly one bit in the lowest failed check
+  while((Syndrome&((uint64_t)1<<Row))==0) Row++;
+  const uint8_t *CheckIndex = LDPC_ParityCheckIndex_n208k160[Row];
+  uint8_t CheckWeight = *CheckIndex++;
+  int16_t Bit1=-1, Bit2=-1;
+  for(uint8_t Idx=0; Idx<CheckWeight; Idx++)
+  { uint8_t BitIdx=CheckIndex[Idx];
+    Bit=LDPC_SyndromeBit(Syndrome^LDPC_ColumnSyndrome(BitIdx));
+    if(Bit<0) continue;
+    if(Bit1>=0) return -1;                               // more than one solution: ambiguous
+    Bit1=BitIdx; Bit2=Bit; }
+  if(Bit1<0) return -1;
+  Data[Bit1>>5]^=(uint32_t)1<<(Bit1&31);
+  Data[Bit2>>5]^=(uint32_t)1<<(Bit2&31);
+  return 2; }
 #ifdef WITH_PPM
 uint8_t LDPC_Check_n354k160(const uint32_t *Data, const uint32_t *Parity) // Data and Parity are 32-bit words
 { uint8_t Errors=0;
@@ -10,6 +10,20 @@
 #endif
 
 #include "bitcount.h"
+#include "format.h"
+
+#ifndef LDPC_DECODER_FLOODING
+#define LDPC_DECODER_LAYERED    // row-serial (layered) min-sum schedule: about 30% fewer iterations than the flooding one at 5-6dB
+#endif
+// #define LDPC_DECODER_INT8       // 8-bit soft bits and the input packed as 2-bit symbols: half the decoder RAM
+
+#ifndef __AVR__
+// #define LDPC_ENCODE_BYTE_TABLE      // parity from a 20x256 table: fastest encoder but takes 30kB of flash
+// #define LDPC_ENCODE_PARITYGEN       // parity from the generator matrix: no tables, slowest
+#if !defined(LDPC_ENCODE_BYTE_TABLE) && !defined(LDPC_ENCODE_NIBBLE_TABLE) && !defined(LDPC_ENCODE_PARITYGEN)
+#define LDPC_ENCODE_NIBBLE_TABLE       // parity from a 40x16 table: 3.75kB of flash
+#endif
+#endif
 
 #ifndef __AVR__
 // #include <stdio.h>
@@ -59,6 +73,16 @@ void LDPC_Encode(      uint8_t *Data);
 
 void LDPC_Encode(const uint32_t *Data, uint32_t *Parity);
 void LDPC_Encode(      uint32_t *Data);
+void LDPC_Encode_ParityGen(const uint32_t *Data, uint32_t *Parity);    // reference encoder: parity by the generator matrix
+void LDPC_UpdateParity(uint32_t *Parity, uint8_t WordIdx, uint32_t Flip); // patch the parity for bits flipped in one data word
+#ifdef LDPC_ENCODE_BYTE_TABLE
+extern const uint16_t LDPC_ParityByte_n208k160[20][256][3];            // in ldpc_table.cpp
+void LDPC_Encode_ByteTable(const uint32_t *Data, uint32_t *Parity);    // parity by XOR of a table entry for every data byte
+#endif
+#ifdef LDPC_ENCODE_NIBBLE_TABLE
+extern const uint16_t LDPC_ParityNibble_n208k160[40][16][3];           // in ldpc_table.cpp
+void LDPC_Encode_NibbleTable(const uint32_t *Data, uint32_t *Parity);  // parity by XOR of a table entry for every data nibble
+#endif
 #ifdef WITH_PPM
 void LDPC_Encode_n354k160(const uint32_t *Data, uint32_t *Parity);
 void LDPC_Encode_n354k160(      uint32_t *Data);
@@ -67,6 +91,10 @@ void LDPC_Encode_n354k160(      uint32_t *Data);
 uint8_t LDPC_Check(const uint32_t *Data, const uint32_t *Parity); // Data and Parity are 32-bit words
 uint8_t LDPC_Check(const uint32_t *Data);
 uint8_t LDPC_Check(const uint8_t  *Data);                         // 20 data bytes followed by 6 parity bytes
+
+uint64_t LDPC_Syndrome(const uint32_t *Data);                     // 48-bit syndrome: bit set for every failed parity check
+uint64_t LDPC_ColumnSyndrome(uint8_t Bit);                        // 48-bit syndrome of a single bit error
+int8_t LDPC_CorrectSyndrome(uint32_t *Data, uint64_t Syndrome);   // correct 1 or 2 bit errors, return -1 if not possible
 #ifdef WITH_PPM
 uint8_t LDPC_Check_n354k160(const uint32_t *Data, const uint32_t *Parity); // Data and Parity are 32-bit words
 uint8_t LDPC_Check_n354k160(const uint32_t *Data);
@@ -78,6 +106,48 @@ uint8_t LDPC_Check_n354k160(const uint32_t *Data);
 
 extern const uint8_t LDPC_ParityCheckIndex_n208k160[48][24];
 
+class LDPC_DecoderStat                                    // iteration-count statistics of the LDPC decoder
+{ public:
+   static const uint8_t HistSize = 8;                     // histogram bins: 1, 2, 3-4, 5-8, 9-16, 17-32, 33+ iterations, failed
+   uint32_t Frames;                                       // [frames] decoded by the iterative decoder
+   uint32_t IterSum;                                      // [iter] sum of iterations over all frames
+   uint16_t Hist[HistSize];                               // [frames] histogram of iterations needed to converge
+   uint32_t Syndrome[3];                                  // [frames] accepted by the syndrome check with 0, 1 or 2 bits corrected
+
+  public:
+   LDPC_DecoderStat() { Clear(); }
+
+   void Clear(void)
+   { Frames=0; IterSum=0;
+     for(uint8_t Idx=0; Idx<HistSize; Idx++) Hist[Idx]=0;
+     for(uint8_t Idx=0; Idx<3; Idx++) Syndrome[Idx]=0; }
+
+   void Add(uint8_t Iter, bool Fail)                      // add a decoded frame: number of iterations used and if it failed
+   { Frames++; IterSum+=Iter;
+     uint8_t Bin=HistSize-1;
+     if(!Fail)
+     { Bin=0; Iter--;
+       while(Iter && Bin<(HistSize-2)) { Iter>>=1; Bin++; } }
+     Hist[Bin]++; }
+
+   uint16_t AverageIter(void) const                       // [0.1 iter] average number of iterations per frame
+   { if(Frames==0) return 0;
+     return (10*IterSum+Frames/2)/Frames; }
+
+   uint8_t Print(char *Out) const                         // print: syndrome-corrected frames, iterative frames, average iterations and the histogram
+   { uint8_t Len=0;
+     for(uint8_t Idx=0; Idx<3; Idx++)
+     { Len+=Format_UnsDec(Out+Len, Syndrome[Idx]); Out[Len++]='/'; }
+     Len+=Format_UnsDec(Out+Len, Frames);
+     Out[Len++]=' ';
+     Len+=Format_UnsDec(Out+Len, AverageIter(), 2, 1);
+     Out[Len++]='i'; Out[Len++]=':';
+     for(uint8_t Idx=0; Idx<HistSize; Idx++)
+     { Out[Len++]=' '; Len+=Format_UnsDec(Out+Len, Hist[Idx]); }
+     Out[Len]=0; return Len; }
+
+} ;
+
 class LDPC_Decoder
 { public:
    const static uint8_t UserBits   = 160;                 // 5 32-bit bits = 20 bytes
@@ -88,12 +158,57 @@ class LDPC_Decoder
    const static uint8_t CodeWords  = (CodeBits+31)/32;    //
    const static uint8_t MaxCheckWeight = 24;
    // const static uint8_t MaxBitWeight   =  8;
+#ifdef LDPC_DECODER_INT8
+   typedef int8_t Ampl_t;                                 // 8-bit soft bits: half the RAM
+   const static int16_t InpAmpl = 16;                     // amplitude of the input bits: leave headroom against saturation
+   const static int16_t MaxAmpl = 127;                    // saturation level for the soft bits
+#else
+   typedef int16_t Ampl_t;
+   const static int16_t InpAmpl = 128;
+   const static int16_t MaxAmpl = 32767;
+#endif
+   const static int16_t MaxInput = MaxAmpl/4;             // limit for the input bits: the check messages still have to be able to flip them
 
   public:
 
+#ifdef LDPC_DECODER_INT8
+   uint8_t  InpSymb[CodeBits/4]; // a-priori bits as 2-bit symbols: 0 = erasure, 1 = one, 2 = zero
+#else
    int16_t  InpBit[CodeBits]; // a-priori bits
-   int16_t  ExtBit[CodeBits]; // extrinsic inf.
-   int16_t  OutBit[CodeBits]; // a-posteriori bits
+#endif
+#ifdef LDPC_DECODER_LAYERED
+   Ampl_t   CheckMin [ParityBits]; // smallest input amplitude seen by every parity check
+   Ampl_t   CheckMin2[ParityBits]; // 2nd smallest input amplitude
+   uint8_t  CheckMinBit[ParityBits]; // which bit of the parity check had the smallest amplitude
+   uint32_t CheckSign[ParityBits]; // sign of the message sent by the parity check to every of its bits
+#else
+   Ampl_t   ExtBit[CodeBits]; // extrinsic inf.
+#endif
+   Ampl_t   OutBit[CodeBits]; // a-posteriori bits
+
+   LDPC_DecoderStat Stat;     // iteration-count statistics
+
+   static Ampl_t Saturate(int32_t Ampl)                    // limit to the range of the soft bits
+   { if(Ampl>MaxAmpl) return MaxAmpl;
+     if(Ampl<(-MaxAmpl)) return -MaxAmpl;
+     return Ampl; }
+
+#ifdef LDPC_DECODER_INT8
+   int16_t getInput(uint8_t Bit) const                     // a-priori value of given bit
+   { uint8_t Symb = (InpSymb[Bit>>2]>>((Bit&3)<<1))&3;
+     if(Symb==1) return InpAmpl;
+     if(Symb==2) return -InpAmpl;
+     return 0; }
+
+   void setInput(uint8_t Bit, int16_t Inp)                 // set the a-priori value: only the sign or erasure is kept
+   { uint8_t Shift=(Bit&3)<<1;
+     uint8_t Symb = Inp>0 ? 1 : Inp<0 ? 2:0;
+     InpSymb[Bit>>2] = (InpSymb[Bit>>2]&~(3<<Shift)) | (Symb<<Shift);
+     OutBit[Bit] = Inp>0 ? InpAmpl : Inp<0 ? -InpAmpl:0; }
+#else
+   int16_t getInput(uint8_t Bit) const { return InpBit[Bit]; }
+   void setInput(uint8_t Bit, int16_t Inp) { OutBit[Bit] = InpBit[Bit] = Inp; }
+#endif
 
    void Input(const uint8_t *Data, const uint8_t *Err)
    { uint8_t Mask=1; uint8_t Idx=0; uint8_t DataByte=0; uint8_t ErrByte=0;
@@ -101,27 +216,38 @@ class LDPC_Decoder
      { if(Mask==1) { DataByte=Data[Idx];  ErrByte=Err[Idx]; }
        int16_t Inp;
        if(ErrByte&Mask) Inp=0;
-                   else Inp=(DataByte&Mask) ? +128:-128;
-       OutBit[Bit] = InpBit[Bit] = Inp; ExtBit[Bit]=0;
+                   else Inp=(DataByte&Mask) ? +InpAmpl:-InpAmpl;
+       setInput(Bit, Inp);
        Mask<<=1; if(Mask==0) { Idx++; Mask=1; }
      }
+     ClearChecks();
    }
 
    void Input(const uint32_t Data[CodeWords])
    { uint32_t Mask=1; uint8_t Idx=0; uint32_t Word=Data[Idx];
      for(uint8_t Bit=0; Bit<CodeBits; Bit++)
-     { OutBit[Bit] = InpBit[Bit] = (Word&Mask) ? +128:-128;
-       ExtBit[Bit]=0;
+     { setInput(Bit, (Word&Mask) ? +InpAmpl:-InpAmpl);
        Mask<<=1; if(Mask==0) { Word=Data[++Idx]; Mask=1; }
      }
+     ClearChecks();
+   }
+
+   void Input(const int8_t *Soft)                          // soft bits as small integers: e.g. the sum of a few copies of the frame
+   { for(uint8_t Bit=0; Bit<CodeBits; Bit++)
+       setInput(Bit, Saturate((int16_t)Soft[Bit]*InpAmpl));
+     ClearChecks();
    }
 
    void Input(const float *Data, float RefAmpl=1.0)
    { for(int Bit=0; Bit<CodeBits; Bit++)
-     { int Inp = floor(128*Data[Bit^7]/RefAmpl+0.5);
-       if(Inp>32767) Inp=32767; else if(Inp<(-32767)) Inp=(-32767);
-       OutBit[Bit] = InpBit[Bit] = Inp;
-       ExtBit[Bit]=0; }
+     { float Inp = Data[Bit^7]/RefAmpl;
+#ifdef LDPC_DECODER_INT8
+       if(Inp>(-0.5) && Inp<0.5) Inp=0;                   // quantize to three levels: weak bits become erasures
+#endif
+       Inp = floor(InpAmpl*Inp+0.5);
+       if(Inp>MaxInput) Inp=MaxInput; else if(Inp<(-MaxInput)) Inp=(-MaxInput); // limit before the conversion: a large float does not fit an integer
+       setInput(Bit, Inp); }
+     ClearChecks();
    }
 
    void Output(uint32_t Data[CodeWords])
@@ -140,6 +266,73 @@ class LDPC_Decoder
      } if(Mask>1) Data[Idx++]=Byte;
    }
 
+   uint8_t CountFails(void) const                          // count parity checks which fail on the a-posteriori bits
+   { uint8_t Count=0;
+     for(uint8_t Row=0; Row<ParityBits; Row++)
+     { const uint8_t *CheckIndex = LDPC_ParityCheckIndex_n208k160[Row];
+       uint8_t CheckWeight = *CheckIndex++;
+       uint8_t Parity=0;
+       for(uint8_t Bit=0; Bit<CheckWeight; Bit++)
+       { if(OutBit[CheckIndex[Bit]]>0) Parity^=1; }
+       Count+=Parity; }
+     return Count; }
+
+#ifdef LDPC_DECODER_LAYERED
+
+   void ClearChecks(void)                                  // clear the messages of the parity checks
+   { for(uint8_t Row=0; Row<ParityBits; Row++)
+     { CheckMin[Row]=0; CheckMin2[Row]=0; CheckMinBit[Row]=0; CheckSign[Row]=0; }
+   }
+
+   int8_t ProcessChecks(void)                              // one layered iteration: a-posteriori bits are updated right after every parity check
+   { uint8_t Count=0;
+     for(uint8_t Row=0; Row<ParityBits; Row++)
+     { int16_t Ret=ProcessCheck(Row);
+       if(Ret<=0) Count++; }
+     if(Count) return Count;
+     return CountFails(); }                                // all checks passed along the way: verify them on the final bits
+
+   static int16_t CheckAmpl(int16_t Ampl)                  // scale the smallest amplitude into the parity check message
+   { return (Ampl*3+2)>>2; }                               // normalized min-sum with factor 0.75
+
+   int16_t ProcessCheck(uint8_t Row)
+   { int16_t MinAmpl=MaxAmpl; uint8_t MinBit=0; int16_t MinAmpl2=MinAmpl;
+     uint32_t Word=0; uint32_t Mask=1;
+     const uint8_t *CheckIndex = LDPC_ParityCheckIndex_n208k160[Row];
+     uint8_t CheckWeight = *CheckIndex++;
+     int16_t  PrevMin  = CheckAmpl(CheckMin[Row]);         // message previously sent by this check
+     int16_t  PrevMin2 = CheckAmpl(CheckMin2[Row]);
+     uint8_t  PrevMinBit = CheckMinBit[Row];
+     uint32_t PrevSign = CheckSign[Row];
+     for(uint8_t Bit=0; Bit<CheckWeight; Bit++)
+     { uint8_t BitIdx=CheckIndex[Bit];
+       int16_t Prev = Bit==PrevMinBit ? PrevMin2 : PrevMin;
+       int16_t Ampl = Saturate(OutBit[BitIdx] - ((PrevSign&Mask) ? Prev:-Prev)); // remove the previous message of this check
+       OutBit[BitIdx]=Ampl;
+       if(Ampl>0) Word|=Mask;
+       Mask<<=1;
+       if(Ampl<0) Ampl=(-Ampl);
+       if(Ampl<MinAmpl) { MinAmpl2=MinAmpl; MinAmpl=Ampl; MinBit=Bit; }
+       else if(Ampl<MinAmpl2) { MinAmpl2=Ampl; }
+     }
+     uint8_t CheckFails = Count1s(Word)&1;
+     uint32_t Sign = CheckFails ? ~Word:Word;              // set bit => positive message to this bit
+     CheckMin[Row]=MinAmpl; CheckMin2[Row]=MinAmpl2; CheckMinBit[Row]=MinBit; CheckSign[Row]=Sign;
+     MinAmpl=CheckAmpl(MinAmpl); MinAmpl2=CheckAmpl(MinAmpl2);
+     Mask=1;
+     for(uint8_t Bit=0; Bit<CheckWeight; Bit++)
+     { uint8_t BitIdx=CheckIndex[Bit];
+       int16_t Ampl = Bit==MinBit ? MinAmpl2 : MinAmpl;
+       OutBit[BitIdx] = Saturate((int32_t)OutBit[BitIdx] + ((Sign&Mask) ? Ampl:-Ampl)); // add the new message
+       Mask<<=1; }
+     return CheckFails?-MinAmpl:MinAmpl; }
+
+#else // flooding schedule
+
+   void ClearChecks(void)                                  // clear the extrinsic information
+   { for(uint8_t Bit=0; Bit<CodeBits; Bit++)
+       ExtBit[Bit]=0; }
+
    int8_t ProcessChecks(void)
    { for(uint8_t Bit=0; Bit<CodeBits; Bit++)
        ExtBit[Bit]=0;
@@ -150,7 +343,7 @@ class LDPC_Decoder
      // printf("%d parity checks fail\n", Count);
      if(Count==0) return 0;
      for(uint8_t Bit=0; Bit<CodeBits; Bit++)
-     { OutBit[Bit] = InpBit[Bit] + (ExtBit[Bit]>>1); }
+     { OutBit[Bit] = Saturate(getInput(Bit) + (ExtBit[Bit]>>1)); }
      return Count; }
 
    int16_t ProcessCheck(uint8_t Row)
@@ -173,10 +366,12 @@ class LDPC_Decoder
      { uint8_t BitIdx=CheckIndex[Bit];
        int16_t Ampl = Bit==MinBit ? MinAmpl2 : MinAmpl;
        if(CheckFails) Ampl=(-Ampl);
-       ExtBit[BitIdx] += (Word&Mask) ? Ampl:-Ampl;
+       ExtBit[BitIdx] = Saturate((int32_t)ExtBit[BitIdx] + ((Word&Mask) ? Ampl:-Ampl));
        Mask<<=1; }
      return CheckFails?-MinAmpl:MinAmpl; }
 
+#endif // LDPC_DECODER_LAYERED
+
 } ;
 
 #ifndef ARDUINO
@@ -342,6 +537,169 @@ template <class Float=float>
      return Count; }
 
 } ;
+
+// Batch version of the LDPC_FloatDecoder for the ground-station side: Lanes codewords are decoded in lockstep.
+// The LLR are stored as struct-of-arrays: every code bit is a vector of Lanes floats, one per codeword,
+// thus the min-sum runs on SSE2/AVX2 registers through the GCC vector extensions,
+// on a CPU without vector units the compiler splits the vectors into scalar code.
+// The min-sum is branchless and gives exactly the same results as LDPC_FloatDecoder<float> for every lane.
+// Scope: this only vectorizes the flooding min-sum of a single thread. ldpc_batch at 3dB gives about 22k pkt/s
+// (SSE2, 3x the scalar decoder) and 51k pkt/s (AVX2, 4.6x) per core, far from millions: the float flooding iterations
+// at low SNR dominate. A faster ground-station decoder needs fixed-point lanes, the layered schedule and a refill
+// of converged lanes with new codewords, none of which is done here.
+
+#ifndef LDPC_BATCH_LANES
+#if defined(__AVX512F__)
+#define LDPC_BATCH_LANES 16                                   // lanes = floats in one vector register
+#elif defined(__AVX__)
+#define LDPC_BATCH_LANES 8
+#else
+#define LDPC_BATCH_LANES 4                                    // SSE2, NEON or plain scalar code
+#endif
+#endif
+
+class LDPC_FloatBatchDecoder
+{ public:
+
+   const static int Lanes=LDPC_BATCH_LANES;
+   typedef float   Vect __attribute__ ((vector_size (4*LDPC_BATCH_LANES)));   // LLR of a given bit for all lanes
+   typedef int32_t Mask __attribute__ ((vector_size (4*LDPC_BATCH_LANES)));   // per lane condition: -1 = true, 0 = false
+
+   const static int MaxCodeBits=512;
+   const static int MaxParityBits=256;
+   const static int MaxParityWeight=32;
+   int CodeBits;                                              // number of code bits
+   int ParityBits;                                            // number of parity bits
+   uint16_t ParityCheckIndex[MaxParityBits][MaxParityWeight]; // list of 1's in the ParityCheck matrix
+   uint8_t  ParityCheckRowWeight[MaxParityBits];              // number of 1's in ParityCheck rows
+
+   Vect InpBit[MaxCodeBits];                                  // a-priori bits
+   Vect ExtBit[MaxCodeBits];                                  // extrinsic inf.
+   Vect OutBit[MaxCodeBits];                                  // a-posteriori bits
+   Mask Active;                                               // lanes which did not yet pass all parity checks
+   Mask Fails;                                                // number of failed parity checks in the last iteration
+   int  Loops[Lanes];                                         // iteration at which the lane passed all checks, MaxIter+1 when it did not
+   float Feedback;
+
+  public:
+
+   LDPC_FloatBatchDecoder()
+   { CodeBits=0; ParityBits=0; Feedback=0.33; }
+
+   int Configure(int NewCodeBits, int NewParityBits, const uint32_t *PackedParityCheck )
+   { if(NewCodeBits>MaxCodeBits) return -1;
+     if(NewParityBits>MaxParityBits) return -1;
+     CodeBits=NewCodeBits; ParityBits=NewParityBits;
+     const uint32_t *Check=PackedParityCheck;
+     for(int ParBit=0; ParBit<ParityBits; ParBit++)
+     { int RowWeight=0;
+       uint32_t Word=0; uint32_t Mask=0;
+       for(int Bit=0; Bit<CodeBits; Bit++)
+       { if(Mask==0) { Mask=1; Word=(*Check++); }
+         if(Word&Mask)
+         { if(RowWeight>=MaxParityWeight) return -1;
+           ParityCheckIndex[ParBit][RowWeight++]=Bit; }
+         Mask<<=1;
+       }
+       ParityCheckRowWeight[ParBit]=RowWeight;
+     }
+     return 1; }
+
+   void Clear(void)                                           // clear all lanes, unused lanes then pass the checks in the first iteration
+   { Vect Zero = { };
+     for(int Bit=0; Bit<CodeBits; Bit++)
+     { OutBit[Bit] = InpBit[Bit] = ExtBit[Bit] = Zero; }
+   }
+
+   void Input(int Lane, const uint8_t *Data, const uint8_t *Err, float Ampl=1.0)  // bytes and the error pattern from the Manchester decoder
+   { uint8_t Mask=1; int Idx=0; uint8_t DataByte=0; uint8_t ErrByte=0;
+     for(int Bit=0; Bit<CodeBits; Bit++)
+     { if(Mask==1) { DataByte=Data[Idx];  ErrByte=Err[Idx]; }
+       float Inp;
+       if(ErrByte&Mask) Inp=0;
+                   else Inp=(DataByte&Mask) ? +Ampl:-Ampl;
+       OutBit[Bit][Lane] = InpBit[Bit][Lane] = Inp; ExtBit[Bit][Lane]=0;
+       Mask<<=1; if(Mask==0) { Idx++; Mask=1; }
+     }
+   }
+
+   void Input(int Lane, const uint32_t *Data, float Ampl=1.0)  // bits from a series of 32-bit words
+   { uint32_t Mask=0; int Idx=0; uint32_t Word=0;
+     for(int Bit=0; Bit<CodeBits; Bit++)
+     { if(Mask==0) { Word=Data[Idx++]; Mask=1; }
+       OutBit[Bit][Lane] = InpBit[Bit][Lane] = (Word&Mask) ? +Ampl:-Ampl; ExtBit[Bit][Lane]=0;
+       Mask<<=1;
+     }
+   }
+
+   void Input(int Lane, const float *Soft)                     // soft bits: positive for 1, negative for 0
+   { for(int Bit=0; Bit<CodeBits; Bit++)
+     { OutBit[Bit][Lane] = InpBit[Bit][Lane] = Soft[Bit]; ExtBit[Bit][Lane]=0; }
+   }
+
+   void Output(int Lane, uint8_t *Data) const                  // decoded bits of the given lane as a series of bytes
+   { uint8_t Mask=1; int Idx=0; uint8_t Byte=0;
+     for(int Bit=0; Bit<CodeBits; Bit++)
+     { if(OutBit[Bit][Lane]>0) Byte|=Mask;
+       Mask<<=1; if(Mask==0) { Data[Idx++]=Byte; Byte=0; Mask=1; }
+     } if(Mask>1) Data[Idx++]=Byte;
+   }
+
+   int Decode(int MaxIter=32)                                 // decode all lanes, return the number of lanes which failed
+   { Mask One = { }; One-=1;
+     Active=One;
+     for(int Lane=0; Lane<Lanes; Lane++)
+       Loops[Lane]=MaxIter+1;
+     for(int Iter=1; Iter<=MaxIter; Iter++)
+     { Mask Done = ProcessChecks();
+       int Left=0;
+       for(int Lane=0; Lane<Lanes; Lane++)
+       { if(Done[Lane]) Loops[Lane]=Iter;
+         if(Active[Lane]) Left++; }
+       if(Left==0) return 0; }
+     int Failed=0;
+     for(int Lane=0; Lane<Lanes; Lane++)
+       if(Active[Lane]) Failed++;
+     return Failed; }
+
+   Mask ProcessChecks(void)                                   // one flooding iteration, return the lanes which have just passed all checks
+   { Vect Zero = { };
+     for(int Bit=0; Bit<CodeBits; Bit++)
+       ExtBit[Bit]=Zero;
+     Fails = Mask { };
+     for(int Row=0; Row<ParityBits; Row++)
+       Fails -= ProcessCheck(Row);                            // mask is -1 for a failed check
+     Mask Done = Active & (Fails==0);                         // these lanes passed: keep their OutBit as they are
+     Active &= ~Done;
+     Vect Feed = Zero+Feedback;
+     for(int Bit=0; Bit<CodeBits; Bit++)                      // add Input+Extrinsic and store in Output for the lanes still active
+     { Vect Out = InpBit[Bit] + Feed*ExtBit[Bit];
+       OutBit[Bit] = Active ? Out : OutBit[Bit]; }
+     return Done; }
+
+   Mask ProcessCheck(int Row)                                 // return the lanes where the check failed or was undecided
+   { Vect MinAmpl = { }; MinAmpl+=std::numeric_limits<float>::max(); Vect MinAmpl2=MinAmpl;
+     Mask MinBit = { };
+     Mask Parity = { };
+     const uint16_t *CheckIndex = ParityCheckIndex[Row];
+     int CheckWeight = ParityCheckRowWeight[Row];
+     for(int Bit=0; Bit<CheckWeight; Bit++)                    // find 1st and 2nd smallest LL and the parity of the hard bits
+     { Vect Ampl = OutBit[CheckIndex[Bit]];
+       Parity ^= Ampl>0;
+       Ampl = Ampl<0 ? -Ampl : Ampl;
+       Mask Less = Ampl<MinAmpl;
+       MinAmpl2 = Less ? MinAmpl : (Ampl<MinAmpl2 ? Ampl : MinAmpl2);
+       MinAmpl  = Less ? Ampl : MinAmpl;
+       MinBit   = Less ? Bit : MinBit; }
+     for(int Bit=0; Bit<CheckWeight; Bit++)                    // add to the extrinsic inf. with the correct sign
+     { int BitIdx = CheckIndex[Bit];
+       Vect Ampl = MinBit==Bit ? MinAmpl2 : MinAmpl;
+       Mask Pos  = (OutBit[BitIdx]>0) ^ Parity;
+       ExtBit[BitIdx] += Pos ? Ampl : -Ampl; }
+     return Parity | (MinAmpl<=0); }
+
+} ;
+
 #endif // ARDUINO
 
 #ifdef WITH_PPM
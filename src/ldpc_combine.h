@@ -0,0 +1,131 @@
+#ifndef __LDPC_COMBINE_H__
+#define __LDPC_COMBINE_H__
+
+#include <stdint.h>
+#include <string.h>
+
+#include "format.h"
+#include "ldpc.h"
+
+// Soft combining of repeated receptions: frames the LDPC_Decoder failed on are kept, keyed by their hard address bits.
+// Header bits with Manchester errors are not known: they match anything, but enough known bits are required.
+// When another failed copy of the same packet arrives (the other time slot or through a relay) the soft bits of all copies
+// are added up and decoded again: diversity gain without extra airtime.
+// A relayed copy differs by the Relay bits in the header and by the FEC bits they affect:
+// the copies are aligned on the relay count of the first copy before they are added.
+
+#ifndef LDPC_COMBINE_MAX_AGE
+#define LDPC_COMBINE_MAX_AGE 4                          // [sec] keep failed frames for that long
+#endif
+
+template <uint8_t Entries=4>
+ class LDPC_Combiner
+{ public:
+   const static uint8_t  CodeBits   = LDPC_Decoder::CodeBits;
+   const static uint8_t  CodeBytes  = LDPC_Decoder::CodeBytes;
+   const static uint8_t  CodeWords  = LDPC_Decoder::CodeWords;
+   const static uint32_t KeyMask    = 0x0FFFFFFF;       // header bits 0..27: address, address-type, non-position and parity
+   const static uint32_t RelayMask  = 0x30000000;       // header bits 28..29: relay count
+   const static uint8_t  MaxCopies  = 8;                // do not add more copies than that
+   const static uint8_t  MinKeyBits = 20;               // known key bits required to match two frames
+
+   uint32_t Key   [Entries];                            // header bits which identify the packet
+   uint32_t KeyErr[Entries];                            // key bits which are not known: had Manchester errors in all copies
+   uint32_t Time  [Entries];                            // [sec] time slot of the last copy
+   uint32_t Relay [Entries];                            // relay bits of the first copy: the others are aligned to it
+   uint8_t  Copies[Entries];                            // number of copies added, 0 = free entry
+   int8_t   Soft  [Entries][CodeBits];                  // sum of the copies: +1 for one, -1 for zero, 0 for a Manchester error
+
+   uint32_t Frames;                                     // [frames] failed frames taken
+   uint32_t Combined;                                   // [frames] decoded again with other copies
+   uint32_t Recovered;                                  // [frames] recovered by the combining
+   LDPC_DecoderStat Stat;                               // iterations of the combined decodes: kept apart from the Decoder.Stat
+
+  public:
+   LDPC_Combiner() { Clear(); Frames=0; Combined=0; Recovered=0; Stat.Clear(); }
+
+   void Clear(void)
+   { for(uint8_t Idx=0; Idx<Entries; Idx++) Copies[Idx]=0; }
+
+   void Remove(uint8_t Idx) { Copies[Idx]=0; }
+
+   void cleanTime(uint32_t Now)                         // remove frames older than the max. age
+   { for(uint8_t Idx=0; Idx<Entries; Idx++)
+       if(Copies[Idx] && (Now-Time[Idx])>LDPC_COMBINE_MAX_AGE) Copies[Idx]=0; }
+
+   int8_t Add(const uint8_t *Data, const uint8_t *Err, uint32_t Now) // add a failed frame, return the entry or -1 when not taken
+   { uint32_t Word[CodeWords], ErrWord[CodeWords];
+     Word[CodeWords-1]=0; ErrWord[CodeWords-1]=0;
+     memcpy(Word, Data, CodeBytes); memcpy(ErrWord, Err, CodeBytes);
+     uint32_t FrameKey = Word[0]&KeyMask;
+     uint32_t FrameErr = ErrWord[0]&KeyMask;
+     if(Count1s(FrameErr)>(28-MinKeyBits)) return -1;  // too many Manchester errors in the header: the key is not reliable
+     if(FrameErr==0 && (Count1s(FrameKey)&1)) return -1; // bad address parity
+     cleanTime(Now);
+     int8_t Idx=Find(FrameKey, FrameErr);
+     if(Idx<0)                                          // first copy: take a free or the oldest entry
+     { Idx=0;
+       for(uint8_t Ent=0; Ent<Entries; Ent++)
+       { if(Copies[Ent]==0) { Idx=Ent; break; }
+         if((int32_t)(Time[Ent]-Time[Idx])<0) Idx=Ent; }
+       Key[Idx]=FrameKey; KeyErr[Idx]=FrameErr; Copies[Idx]=0;
+       Relay[Idx]=Word[0]&RelayMask;
+       memset(Soft[Idx], 0, CodeBits); }
+     else
+     { if(Copies[Idx]>=MaxCopies) return Idx;
+       Key[Idx] = (Key[Idx]&~KeyErr[Idx]) | (FrameKey&KeyErr[Idx]); // fill the key bits which were not known
+       KeyErr[Idx] &= FrameErr; }
+     if(ErrWord[0]&RelayMask) Word[0] = (Word[0]&~RelayMask) | Relay[Idx]; // relay count not known: assume the same
+     uint32_t Flip = (Word[0]&RelayMask)^Relay[Idx];    // align a copy with another relay count
+     if(Flip) { Word[0]^=Flip; LDPC_UpdateParity(Word+LDPC_Decoder::UserWords, 0, Flip); }
+     int8_t *Sum = Soft[Idx];
+     for(uint8_t Bit=0; Bit<CodeBits; Bit++)
+     { uint32_t Mask = (uint32_t)1<<(Bit&31);
+       if(ErrWord[Bit>>5]&Mask) continue;
+       Sum[Bit] += (Word[Bit>>5]&Mask) ? 1:-1; }
+     Copies[Idx]++; Time[Idx]=Now; Frames++;
+     return Idx; }
+
+   uint8_t Decode(uint8_t Idx, LDPC_Decoder &Decoder, uint8_t *Packet, uint8_t Iter=32) // decode the sum of the copies
+   { Combined++;
+     Decoder.Input(Soft[Idx]);
+     uint8_t Check=0; uint8_t Loops=0;
+     for( ; Loops<Iter; )
+     { Check=Decoder.ProcessChecks(); Loops++;
+       if(Check==0) break; }
+     Stat.Add(Loops, Check!=0);
+     Decoder.Output(Packet);
+     return Check; }                                    // the packet comes out with the relay count of the first copy
+
+   uint8_t ErrCount(uint8_t Idx, const uint8_t *Packet) const // bit errors against the sum of the copies: zero sums plus bits decoded against the sum
+   { const int8_t *Sum = Soft[Idx];
+     uint8_t Count=0;
+     for(uint8_t Bit=0; Bit<CodeBits; Bit++)
+     { bool One = (Packet[Bit>>3]>>(Bit&7))&1;
+       if(One ? Sum[Bit]<=0 : Sum[Bit]>=0) Count++; }
+     return Count; }
+
+   uint8_t Print(char *Out) const                       // print: frames, combined, recovered, average iterations, entries in use
+   { uint8_t Len=0;
+     Len+=Format_UnsDec(Out+Len, Frames);
+     Out[Len++]=' '; Len+=Format_UnsDec(Out+Len, Combined);
+     Out[Len++]='/'; Len+=Format_UnsDec(Out+Len, Recovered);
+     Out[Len++]=' '; Len+=Format_UnsDec(Out+Len, Stat.AverageIter(), 2, 1); Out[Len++]='i';
+     uint8_t Used=0;
+     for(uint8_t Idx=0; Idx<Entries; Idx++) if(Copies[Idx]) Used++;
+     Out[Len++]=' '; Len+=Format_UnsDec(Out+Len, Used);
+     Out[Len++]='/'; Len+=Format_UnsDec(Out+Len, (uint16_t)Entries);
+     Out[Len]=0; return Len; }
+
+  private:
+   int8_t Find(uint32_t FrameKey, uint32_t FrameErr) const // find an entry with matching known key bits
+   { for(uint8_t Idx=0; Idx<Entries; Idx++)
+     { if(Copies[Idx]==0) continue;
+       uint32_t Known = KeyMask & ~(KeyErr[Idx]|FrameErr);
+       if(Count1s(Known)<MinKeyBits) continue;
+       if(((Key[Idx]^FrameKey)&Known)==0) return Idx; }
+     return -1; }
+
+} ;
+
+#endif // __LDPC_COMBINE_H__
@@ -0,0 +1,195 @@
+#ifndef __LDPC_OSD_H__
+#define __LDPC_OSD_H__
+
+#include <stdint.h>
+#include <string.h>
+
+#include "format.h"
+#include "ldpc.h"
+
+// Ordered-statistics decoder (OSD) for the n208k160 code: a fallback for packets where the min-sum LDPC_Decoder fails.
+// The bits are sorted by reliability, the parity check matrix is reduced on the 48 least reliable independent bits,
+// the 160 most reliable bits are taken as they are (OSD-0), then flipped one by one (OSD-1)
+// and by pairs among the least reliable of them (OSD-2). The codeword closest to the received one wins.
+// The OSD always gives some codeword: isReliable() tells if the winner is far enough ahead of the runner-up to be trusted.
+// The frames min-sum fails on carry 9 or more Manchester errors, thus an OSD result is accepted on isReliable() and the address parity,
+// not on RxErr<10: in AWGN 2-7dB (ldpc_ber_osd) 2331 frames recovered out of 300000, 8 of them wrong, 2-6e-5 per frame.
+// The work is split into small steps so it can be run in the idle time and stopped any time.
+
+#ifndef LDPC_OSD_PAIR_BITS
+#define LDPC_OSD_PAIR_BITS 24                           // OSD-2 over that many least reliable bits of the most reliable basis
+#endif
+
+class LDPC_OSD
+{ public:
+   const static uint8_t CodeBits   = 208;
+   const static uint8_t ParityBits =  48;
+   const static uint8_t CodeWords  = (CodeBits+31)/32;
+   const static uint8_t CodeBytes  = (CodeBits+ 7)/ 8;
+   const static uint8_t PairBits   = LDPC_OSD_PAIR_BITS;
+
+   const static uint8_t StateIdle  = 0;
+   const static uint8_t StateSort  = 1;                 // sort bits by reliability
+   const static uint8_t StateElim  = 2;                 // reduce the parity check matrix on the least reliable bits
+   const static uint8_t StateOSD1  = 3;                 // try single bit flips
+   const static uint8_t StateOSD2  = 4;                 // try pairs of bit flips
+   const static uint8_t StateDone  = 5;                 // result is ready
+   const static uint8_t StateFail  = 6;                 // decoding failed
+
+   uint8_t  State;
+   uint8_t  Pos;                                        // position in the sorted bits being processed
+   uint8_t  Pivots;                                     // number of pivots found so far
+   uint8_t  Pairs;                                      // number of bits collected for OSD-2
+   uint8_t  PairIdx;                                    // first bit of the pair being processed
+   uint32_t Hard[CodeWords];                            // hard decisions, later the decoded codeword
+   uint32_t IsPivot[CodeWords];                         // which bits are the pivots
+   uint64_t Syndrome;                                   // syndrome of the hard decisions expressed in pivots
+   uint64_t Basis[ParityBits];                          // reduced parity check columns indexed by their highest bit
+   uint64_t Comb[ParityBits];                           // which pivots make every basis vector
+   uint64_t Valid;                                      // which basis vectors are set
+   uint8_t  PivotBit[ParityBits];                       // codeword bit of every pivot
+   uint16_t Rel[CodeBits];                              // reliability of every bit
+   uint8_t  Order[CodeBits];                            // bits sorted by reliability, least reliable first
+   uint64_t PairComb[PairBits];                         // pivot combinations of the OSD-2 bits
+   uint8_t  PairBit[PairBits];                          // codeword bits for OSD-2
+   uint32_t BestCost;                                   // smallest cost found so far
+   uint32_t NextCost;                                   // 2nd smallest cost: the runner-up candidate
+   uint64_t BestComb;                                   // pivots to be flipped for the best candidate
+   int16_t  BestFlip[2];                                // most reliable bits to be flipped for the best candidate
+
+   uint32_t Frames;                                     // [frames] given to the OSD decoder
+   uint32_t Recovered;                                  // [frames] recovered and accepted
+   uint32_t Rejected;                                   // [frames] decoded but not reliable enough
+   uint32_t Skipped;                                    // [frames] not taken as the decoder was busy
+   uint32_t Timeout;                                    // [frames] given up as the CPU budget was exceeded
+   uint32_t CPU_Time;                                   // [us] CPU time used
+
+  public:
+   LDPC_OSD() { State=StateIdle; Frames=0; Recovered=0; Rejected=0; Skipped=0; Timeout=0; CPU_Time=0; }
+
+   bool isBusy(void) const { return State>StateIdle && State<StateDone; }
+
+   void Clear(void) { State=StateIdle; }
+
+   void Input(const LDPC_Decoder &Decoder)              // take the bits of a frame where LDPC_Decoder failed
+   { for(uint8_t Idx=0; Idx<CodeWords; Idx++)
+       Hard[Idx]=0;
+     for(uint8_t Bit=0; Bit<CodeBits; Bit++)
+     { int32_t Ampl=(int32_t)Decoder.OutBit[Bit]+4*(int32_t)Decoder.getInput(Bit); // a-posteriori with more weight to the input
+       if(Ampl>0) Hard[Bit>>5] |= (uint32_t)1<<(Bit&31);
+            else Ampl=(-Ampl);
+       if(Ampl>0xFFFF) Ampl=0xFFFF;
+       Rel[Bit]=Ampl; }
+     Frames++;
+     State=StateSort; }
+
+   uint8_t Process(void)                                // do a single step, return the state
+   { if(State==StateSort) { Sort(); return State; }
+     if(State==StateElim) { Eliminate(); return State; }
+     if(State==StateOSD1) { OSD1(); return State; }
+     if(State==StateOSD2) { OSD2(); return State; }
+     return State; }
+
+   void Output(uint8_t *Data) const { memcpy(Data, Hard, CodeBytes); } // get the decoded codeword
+
+   bool isReliable(uint8_t Erasures, uint8_t Flips) const // Erasures: Manchester errors in the frame, Flips: other bits changed by the OSD
+   { if(Erasures+8*Flips>40) return 0;                  // a wrong codeword is easy to reach through many erasures or flips
+     uint32_t Margin = NextCost-BestCost;               // the runner-up has to be well behind, more so with more erasures
+     return Margin >= (uint32_t)LDPC_Decoder::InpAmpl*(48+Erasures)/8; }
+
+   uint8_t Print(char *Out) const                       // print: frames, recovered/rejected, skipped, timeout, CPU time
+   { uint8_t Len=0;
+     Len+=Format_UnsDec(Out+Len, Frames);
+     Out[Len++]='/'; Len+=Format_UnsDec(Out+Len, Recovered);
+     Out[Len++]='/'; Len+=Format_UnsDec(Out+Len, Rejected);
+     Out[Len++]=' '; Len+=Format_UnsDec(Out+Len, Skipped);
+     Out[Len++]=' '; Len+=Format_UnsDec(Out+Len, Timeout);
+     Out[Len++]=' '; Len+=Format_UnsDec(Out+Len, (CPU_Time+500)/1000); Out[Len++]='m'; Out[Len++]='s';
+     Out[Len]=0; return Len; }
+
+  private:
+
+   static uint8_t TopBit(uint64_t Word) { return 63-__builtin_clzll(Word); }
+
+   uint64_t Reduce(uint64_t Col, uint64_t &Mask) const  // reduce a column with the basis: return what is left
+   { while(Col)
+     { uint8_t Bit=TopBit(Col);
+       if((Valid&((uint64_t)1<<Bit))==0) break;
+       Col^=Basis[Bit]; Mask^=Comb[Bit]; }
+     return Col; }
+
+   uint32_t Cost(uint64_t Mask) const                   // cost of flipping the given pivots
+   { uint32_t Sum=0;
+     for( ; Mask; Mask&=Mask-1)
+       Sum+=Rel[PivotBit[__builtin_ctzll(Mask)]];
+     return Sum; }
+
+   void Sort(void)                                      // insertion sort of the bits by reliability
+   { for(uint8_t Idx=0; Idx<CodeBits; Idx++)
+     { uint8_t Bit=Idx; uint16_t R=Rel[Bit];
+       uint8_t Ins=Idx;
+       for( ; Ins>0 && Rel[Order[Ins-1]]>R; Ins--)
+         Order[Ins]=Order[Ins-1];
+       Order[Ins]=Bit; }
+     for(uint8_t Idx=0; Idx<CodeWords; Idx++)
+       IsPivot[Idx]=0;
+     Valid=0; Pivots=0; Pos=0; State=StateElim; }
+
+   void Eliminate(void)                                 // take the next least reliable bit
+   { if(Pos>=CodeBits) { State=StateFail; return; }     // should not happen: parity checks are independent
+     uint8_t Bit=Order[Pos++];
+     uint64_t Mask=0;
+     uint64_t Col=Reduce(LDPC_ColumnSyndrome(Bit), Mask);
+     if(Col==0) return;                                 // dependent on the pivots found so far
+     uint8_t Top=TopBit(Col);
+     Basis[Top]=Col; Comb[Top]=Mask^((uint64_t)1<<Pivots); Valid|=(uint64_t)1<<Top;
+     PivotBit[Pivots++]=Bit; IsPivot[Bit>>5] |= (uint32_t)1<<(Bit&31);
+     if(Pivots<ParityBits) return;
+     Mask=0;
+     if(Reduce(LDPC_Syndrome(Hard), Mask)) { State=StateFail; return; }
+     Syndrome=Mask;                                     // OSD-0: flip the pivots to satisfy all parity checks
+     NextCost=0xFFFFFFFF; BestCost=Cost(Syndrome); BestComb=Syndrome; BestFlip[0]=BestFlip[1]=(-1);
+     Pos=0; Pairs=0; State=StateOSD1; }
+
+   void OSD1(void)                                      // try to flip the next most reliable bit
+   { uint8_t Bit;
+     for( ; ; )
+     { if(Pos>=CodeBits) { PairIdx=0; State = Pairs>1 ? StateOSD2:StateDone; if(State==StateDone) Correct(); return; }
+       Bit=Order[Pos++];
+       if((IsPivot[Bit>>5]&((uint32_t)1<<(Bit&31)))==0) break; }
+     uint64_t Mask=0; Reduce(LDPC_ColumnSyndrome(Bit), Mask);
+     if(Pairs<PairBits) { PairComb[Pairs]=Mask; PairBit[Pairs++]=Bit; }
+     Mask^=Syndrome;
+     uint32_t Sum=Rel[Bit];
+     if(Sum>=NextCost) return;
+     Sum+=Cost(Mask);
+     if(Sum>=NextCost) return;
+     if(Sum>=BestCost) { NextCost=Sum; return; }        // new runner-up
+     NextCost=BestCost; BestCost=Sum; BestComb=Mask; BestFlip[0]=Bit; BestFlip[1]=(-1); }
+
+   void OSD2(void)                                      // try all pairs starting with the next bit
+   { uint8_t Bit1=PairBit[PairIdx];
+     uint64_t Mask1=Syndrome^PairComb[PairIdx];
+     for(uint8_t Idx=PairIdx+1; Idx<Pairs; Idx++)
+     { uint8_t Bit2=PairBit[Idx];
+       uint32_t Sum=Rel[Bit1]+Rel[Bit2];
+       if(Sum>=NextCost) continue;
+       uint64_t Mask=Mask1^PairComb[Idx];
+       Sum+=Cost(Mask);
+       if(Sum>=NextCost) continue;
+       if(Sum>=BestCost) { NextCost=Sum; continue; }
+       NextCost=BestCost; BestCost=Sum; BestComb=Mask; BestFlip[0]=Bit1; BestFlip[1]=Bit2; }
+     PairIdx++;
+     if(PairIdx>=(Pairs-1)) { State=StateDone; Correct(); } }
+
+   void Flip(uint8_t Bit) { Hard[Bit>>5] ^= (uint32_t)1<<(Bit&31); }
+
+   void Correct(void)                                   // apply the best candidate to the hard decisions
+   { for(uint64_t Mask=BestComb; Mask; Mask&=Mask-1)
+       Flip(PivotBit[__builtin_ctzll(Mask)]);
+     for(uint8_t Idx=0; Idx<2; Idx++)
+       if(BestFlip[Idx]>=0) Flip(BestFlip[Idx]); }
+
+} ;
+
+#endif // __LDPC_OSD_H__
@@ -0,0 +1,1578 @@
+// parity tables for the table-driven LDPC encoder of the n208k160 code
+// produced by ldpc_test/ldpc_table.cc: do not edit
+
+#include <stdint.h>
+
+#include "ldpc.h"
+
+#ifdef LDPC_ENCODE_BYTE_TABLE
+// parity of every data byte value at every of the 20 byte positions
+const uint16_t LDPC_ParityByte_n208k160[20][256][3] = {
+ {  // byte 0
+  { 0x0000, 0x0000, 0x0000 }, { 0x5A03, 0x1588, 0x5E04 }, { 0x1426, 0xB814, 0xCA2F }, { 0x4E25, 0xAD9C, 0x942B },
+  { 0xBE44, 0xFEF4, 0xC474 }, { 0xE447, 0xEB7C, 0x9A70 }, { 0xAA62, 0x46E0, 0x0E5B }, { 0xF061, 0x5368, 0x505F },
+  { 0x7250, 0xBA66, 0x7B8C }, { 0x2853, 0xAFEE, 0x2588 }, { 0x6676, 0x0272, 0xB1A3 }, { 0x3C75, 0x17FA, 0xEFA7 },
+  { 0xCC14, 0x4492, 0xBFF8 }, { 0x9617, 0x511A, 0xE1FC }, { 0xD832, 0xFC86, 0x75D7 }, { 0x8231, 0xE90E, 0x2BD3 },
+  { 0xCD74, 0xE8A2, 0x1D8B }, { 0x9777, 0xFD2A, 0x438F }, { 0xD952, 0x50B6, 0xD7A4 }, { 0x8351, 0x453E, 0x89A0 },
+  { 0x7330, 0x1656, 0xD9FF }, { 0x2933, 0x03DE, 0x87FB }, { 0x6716, 0xAE42, 0x13D0 }, { 0x3D15, 0xBBCA, 0x4DD4 },
+  { 0xBF24, 0x52C4, 0x6607 }, { 0xE527, 0x474C, 0x3803 }, { 0xAB02, 0xEAD0, 0xAC28 }, { 0xF101, 0xFF58, 0xF22C },
+  { 0x0160, 0xAC30, 0xA273 }, { 0x5B63, 0xB9B8, 0xFC77 }, { 0x1546, 0x1424, 0x685C }, { 0x4F45, 0x01AC, 0x3658 },
+  { 0x24E0, 0xC74C, 0x0ADA }, { 0x7EE3, 0xD2C4, 0x54DE }, { 0x30C6, 0x7F58, 0xC0F5 }, { 0x6AC5, 0x6AD0, 0x9EF1 },
+  { 0x9AA4, 0x39B8, 0xCEAE }, { 0xC0A7, 0x2C30, 0x90AA }, { 0x8E82, 0x81AC, 0x0481 }, { 0xD481, 0x9424, 0x5A85 },
+  { 0x56B0, 0x7D2A, 0x7156 }, { 0x0CB3, 0x68A2, 0x2F52 }, { 0x4296, 0xC53E, 0xBB79 }, { 0x1895, 0xD0B6, 0xE57D },
+  { 0xE8F4, 0x83DE, 0xB522 }, { 0xB2F7, 0x9656, 0xEB26 }, { 0xFCD2, 0x3BCA, 0x7F0D }, { 0xA6D1, 0x2E42, 0x2109 },
+  { 0xE994, 0x2FEE, 0x1751 }, { 0xB397, 0x3A66, 0x4955 }, { 0xFDB2, 0x97FA, 0xDD7E }, { 0xA7B1, 0x8272, 0x837A },
+  { 0x57D0, 0xD11A, 0xD325 }, { 0x0DD3, 0xC492, 0x8D21 }, { 0x43F6, 0x690E, 0x190A }, { 0x19F5, 0x7C86, 0x470E },
+  { 0x9BC4, 0x9588, 0x6CDD }, { 0xC1C7, 0x8000, 0x32D9 }, { 0x8FE2, 0x2D9C, 0xA6F2 }, { 0xD5E1, 0x3814, 0xF8F6 },
+  { 0x2580, 0x6B7C, 0xA8A9 }, { 0x7F83, 0x7EF4, 0xF6AD }, { 0x31A6, 0xD368, 0x6286 }, { 0x6BA5, 0xC6E0, 0x3C82 },
+  { 0x4F8E, 0xE2CC, 0x0748 }, { 0x158D, 0xF744, 0x594C }, { 0x5BA8, 0x5AD8, 0xCD67 }, { 0x01AB, 0x4F50, 0x9363 },
+  { 0xF1CA, 0x1C38, 0xC33C }, { 0xABC9, 0x09B0, 0x9D38 }, { 0xE5EC, 0xA42C, 0x0913 }, { 0xBFEF, 0xB1A4, 0x5717 },
+  { 0x3DDE, 0x58AA, 0x7CC4 }, { 0x67DD, 0x4D22, 0x22C0 }, { 0x29F8, 0xE0BE, 0xB6EB }, { 0x73FB, 0xF536, 0xE8EF },
+  { 0x839A, 0xA65E, 0xB8B0 }, { 0xD999, 0xB3D6, 0xE6B4 }, { 0x97BC, 0x1E4A, 0x729F }, { 0xCDBF, 0x0BC2, 0x2C9B },
+  { 0x82FA, 0x0A6E, 0x1AC3 }, { 0xD8F9, 0x1FE6, 0x44C7 }, { 0x96DC, 0xB27A, 0xD0EC }, { 0xCCDF, 0xA7F2, 0x8EE8 },
+  { 0x3CBE, 0xF49A, 0xDEB7 }, { 0x66BD, 0xE112, 0x80B3 }, { 0x2898, 0x4C8E, 0x1498 }, { 0x729B, 0x5906, 0x4A9C },
+  { 0xF0AA, 0xB008, 0x614F }, { 0xAAA9, 0xA580, 0x3F4B }, { 0xE48C, 0x081C, 0xAB60 }, { 0xBE8F, 0x1D94, 0xF564 },
+  { 0x4EEE, 0x4EFC, 0xA53B }, { 0x14ED, 0x5B74, 0xFB3F }, { 0x5AC8, 0xF6E8, 0x6F14 }, { 0x00CB, 0xE360, 0x3110 },
+  { 0x6B6E, 0x2580, 0x0D92 }, { 0x316D, 0x3008, 0x5396 }, { 0x7F48, 0x9D94, 0xC7BD }, { 0x254B, 0x881C, 0x99B9 },
+  { 0xD52A, 0xDB74, 0xC9E6 }, { 0x8F29, 0xCEFC, 0x97E2 }, { 0xC10C, 0x6360, 0x03C9 }, { 0x9B0F, 0x76E8, 0x5DCD },
+  { 0x193E, 0x9FE6, 0x761E }, { 0x433D, 0x8A6E, 0x281A }, { 0x0D18, 0x27F2, 0xBC31 }, { 0x571B, 0x327A, 0xE235 },
+  { 0xA77A, 0x6112, 0xB26A }, { 0xFD79, 0x749A, 0xEC6E }, { 0xB35C, 0xD906, 0x7845 }, { 0xE95F, 0xCC8E, 0x2641 },
+  { 0xA61A, 0xCD22, 0x1019 }, { 0xFC19, 0xD8AA, 0x4E1D }, { 0xB23C, 0x7536, 0xDA36 }, { 0xE83F, 0x60BE, 0x8432 },
+  { 0x185E, 0x33D6, 0xD46D }, { 0x425D, 0x265E, 0x8A69 }, { 0x0C78, 0x8BC2, 0x1E42 }, { 0x567B, 0x9E4A, 0x4046 },
+  { 0xD44A, 0x7744, 0x6B95 }, { 0x8E49, 0x62CC, 0x3591 }, { 0xC06C, 0xCF50, 0xA1BA }, { 0x9A6F, 0xDAD8, 0xFFBE },
+  { 0x6A0E, 0x89B0, 0xAFE1 }, { 0x300D, 0x9C38, 0xF1E5 }, { 0x7E28, 0x31A4, 0x65CE }, { 0x242B, 0x242C, 0x3BCA },
+  { 0xB943, 0xCB41, 0x08D0 }, { 0xE340, 0xDEC9, 0x56D4 }, { 0xAD65, 0x7355, 0xC2FF }, { 0xF766, 0x66DD, 0x9CFB },
+  { 0x0707, 0x35B5, 0xCCA4 }, { 0x5D04, 0x203D, 0x92A0 }, { 0x1321, 0x8DA1, 0x068B }, { 0x4922, 0x9829, 0x588F },
+  { 0xCB13, 0x7127, 0x735C }, { 0x9110, 0x64AF, 0x2D58 }, { 0xDF35, 0xC933, 0xB973 }, { 0x8536, 0xDCBB, 0xE777 },
+  { 0x7557, 0x8FD3, 0xB728 }, { 0x2F54, 0x9A5B, 0xE92C }, { 0x6171, 0x37C7, 0x7D07 }, { 0x3B72, 0x224F, 0x2303 },
+  { 0x7437, 0x23E3, 0x155B }, { 0x2E34, 0x366B, 0x4B5F }, { 0x6011, 0x9BF7, 0xDF74 }, { 0x3A12, 0x8E7F, 0x8170 },
+  { 0xCA73, 0xDD17, 0xD12F }, { 0x9070, 0xC89F, 0x8F2B }, { 0xDE55, 0x6503, 0x1B00 }, { 0x8456, 0x708B, 0x4504 },
+  { 0x0667, 0x9985, 0x6ED7 }, { 0x5C64, 0x8C0D, 0x30D3 }, { 0x1241, 0x2191, 0xA4F8 }, { 0x4842, 0x3419, 0xFAFC },
+  { 0xB823, 0x6771, 0xAAA3 }, { 0xE220, 0x72F9, 0xF4A7 }, { 0xAC05, 0xDF65, 0x608C }, { 0xF606, 0xCAED, 0x3E88 },
+  { 0x9DA3, 0x0C0D, 0x020A }, { 0xC7A0, 0x1985, 0x5C0E }, { 0x8985, 0xB419, 0xC825 }, { 0xD386, 0xA191, 0x9621 },
+  { 0x23E7, 0xF2F9, 0xC67E }, { 0x79E4, 0xE771, 0x987A }, { 0x37C1, 0x4AED, 0x0C51 }, { 0x6DC2, 0x5F65, 0x5255 },
+  { 0xEFF3, 0xB66B, 0x7986 }, { 0xB5F0, 0xA3E3, 0x2782 }, { 0xFBD5, 0x0E7F, 0xB3A9 }, { 0xA1D6, 0x1BF7, 0xEDAD },
+  { 0x51B7, 0x489F, 0xBDF2 }, { 0x0BB4, 0x5D17, 0xE3F6 }, { 0x4591, 0xF08B, 0x77DD }, { 0x1F92, 0xE503, 0x29D9 },
+  { 0x50D7, 0xE4AF, 0x1F81 }, { 0x0AD4, 0xF127, 0x4185 }, { 0x44F1, 0x5CBB, 0xD5AE }, { 0x1EF2, 0x4933, 0x8BAA },
+  { 0xEE93, 0x1A5B, 0xDBF5 }, { 0xB490, 0x0FD3, 0x85F1 }, { 0xFAB5, 0xA24F, 0x11DA }, { 0xA0B6, 0xB7C7, 0x4FDE },
+  { 0x2287, 0x5EC9, 0x640D }, { 0x7884, 0x4B41, 0x3A09 }, { 0x36A1, 0xE6DD, 0xAE22 }, { 0x6CA2, 0xF355, 0xF026 },
+  { 0x9CC3, 0xA03D, 0xA079 }, { 0xC6C0, 0xB5B5, 0xFE7D }, { 0x88E5, 0x1829, 0x6A56 }, { 0xD2E6, 0x0DA1, 0x3452 },
+  { 0xF6CD, 0x298D, 0x0F98 }, { 0xACCE, 0x3C05, 0x519C }, { 0xE2EB, 0x9199, 0xC5B7 }, { 0xB8E8, 0x8411, 0x9BB3 },
+  { 0x4889, 0xD779, 0xCBEC }, { 0x128A, 0xC2F1, 0x95E8 }, { 0x5CAF, 0x6F6D, 0x01C3 }, { 0x06AC, 0x7AE5, 0x5FC7 },
+  { 0x849D, 0x93EB, 0x7414 }, { 0xDE9E, 0x8663, 0x2A10 }, { 0x90BB, 0x2BFF, 0xBE3B }, { 0xCAB8, 0x3E77, 0xE03F },
+  { 0x3AD9, 0x6D1F, 0xB060 }, { 0x60DA, 0x7897, 0xEE64 }, { 0x2EFF, 0xD50B, 0x7A4F }, { 0x74FC, 0xC083, 0x244B },
+  { 0x3BB9, 0xC12F, 0x1213 }, { 0x61BA, 0xD4A7, 0x4C17 }, { 0x2F9F, 0x793B, 0xD83C }, { 0x759C, 0x6CB3, 0x8638 },
+  { 0x85FD, 0x3FDB, 0xD667 }, { 0xDFFE, 0x2A53, 0x8863 }, { 0x91DB, 0x87CF, 0x1C48 }, { 0xCBD8, 0x9247, 0x424C },
+  { 0x49E9, 0x7B49, 0x699F }, { 0x13EA, 0x6EC1, 0x379B }, { 0x5DCF, 0xC35D, 0xA3B0 }, { 0x07CC, 0xD6D5, 0xFDB4 },
+  { 0xF7AD, 0x85BD, 0xADEB }, { 0xADAE, 0x9035, 0xF3EF }, { 0xE38B, 0x3DA9, 0x67C4 }, { 0xB988, 0x2821, 0x39C0 },
+  { 0xD22D, 0xEEC1, 0x0542 }, { 0x882E, 0xFB49, 0x5B46 }, { 0xC60B, 0x56D5, 0xCF6D }, { 0x9C08, 0x435D, 0x9169 },
+  { 0x6C69, 0x1035, 0xC136 }, { 0x366A, 0x05BD, 0x9F32 }, { 0x784F, 0xA821, 0x0B19 }, { 0x224C, 0xBDA9, 0x551D },
+  { 0xA07D, 0x54A7, 0x7ECE }, { 0xFA7E, 0x412F, 0x20CA }, { 0xB45B, 0xECB3, 0xB4E1 }, { 0xEE58, 0xF93B, 0xEAE5 },
+  { 0x1E39, 0xAA53, 0xBABA }, { 0x443A, 0xBFDB, 0xE4BE }, { 0x0A1F, 0x1247, 0x7095 }, { 0x501C, 0x07CF, 0x2E91 },
+  { 0x1F59, 0x0663, 0x18C9 }, { 0x455A, 0x13EB, 0x46CD }, { 0x0B7F, 0xBE77, 0xD2E6 }, { 0x517C, 0xABFF, 0x8CE2 },
+  { 0xA11D, 0xF897, 0xDCBD }, { 0xFB1E, 0xED1F, 0x82B9 }, { 0xB53B, 0x4083, 0x1692 }, { 0xEF38, 0x550B, 0x4896 },
+  { 0x6D09, 0xBC05, 0x6345 }, { 0x370A, 0xA98D, 0x3D41 }, { 0x792F, 0x0411, 0xA96A }, { 0x232C, 0x1199, 0xF76E },
+  { 0xD34D, 0x42F1, 0xA731 }, { 0x894E, 0x5779, 0xF935 }, { 0xC76B, 0xFAE5, 0x6D1E }, { 0x9D68, 0xEF6D, 0x331A }
+ },
+ {  // byte 1
+  { 0x0000, 0x0000, 0x0000 }, { 0xB396, 0xB1AB, 0x680C }, { 0x2AFB, 0x802C, 0x5E93 }, { 0x996D, 0x3187, 0x369F },
+  { 0xA8D6, 0xC892, 0xBEE2 }, { 0x1B40, 0x7939, 0xD6EE }, { 0x822D, 0x48BE, 0xE071 }, { 0x31BB, 0xF915, 0x887D },
+  { 0xCC06, 0xB88A, 0x4F0D }, { 0x7F90, 0x0921, 0x2701 }, { 0xE6FD, 0x38A6, 0x119E }, { 0x556B, 0x890D, 0x7992 },
+  { 0x64D0, 0x7018, 0xF1EF }, { 0xD746, 0xC1B3, 0x99E3 }, { 0x4E2B, 0xF034, 0xAF7C }, { 0xFDBD, 0x419F, 0xC770 },
+  { 0x79F8, 0x4110, 0xA0E2 }, { 0xCA6E, 0xF0BB, 0xC8EE }, { 0x5303, 0xC13C, 0xFE71 }, { 0xE095, 0x7097, 0x967D },
+  { 0xD12E, 0x8982, 0x1E00 }, { 0x62B8, 0x3829, 0x760C }, { 0xFBD5, 0x09AE, 0x4093 }, { 0x4843, 0xB805, 0x289F },
+  { 0xB5FE, 0xF99A, 0xEFEF }, { 0x0668, 0x4831, 0x87E3 }, { 0x9F05, 0x79B6, 0xB17C }, { 0x2C93, 0xC81D, 0xD970 },
+  { 0x1D28, 0x3108, 0x510D }, { 0xAEBE, 0x80A3, 0x3901 }, { 0x37D3, 0xB124, 0x0F9E }, { 0x8445, 0x008F, 0x6792 },
+  { 0x41E0, 0x1099, 0xE9AF }, { 0xF276, 0xA132, 0x81A3 }, { 0x6B1B, 0x90B5, 0xB73C }, { 0xD88D, 0x211E, 0xDF30 },
+  { 0xE936, 0xD80B, 0x574D }, { 0x5AA0, 0x69A0, 0x3F41 }, { 0xC3CD, 0x5827, 0x09DE }, { 0x705B, 0xE98C, 0x61D2 },
+  { 0x8DE6, 0xA813, 0xA6A2 }, { 0x3E70, 0x19B8, 0xCEAE }, { 0xA71D, 0x283F, 0xF831 }, { 0x148B, 0x9994, 0x903D },
+  { 0x2530, 0x6081, 0x1840 }, { 0x96A6, 0xD12A, 0x704C }, { 0x0FCB, 0xE0AD, 0x46D3 }, { 0xBC5D, 0x5106, 0x2EDF },
+  { 0x3818, 0x5189, 0x494D }, { 0x8B8E, 0xE022, 0x2141 }, { 0x12E3, 0xD1A5, 0x17DE }, { 0xA175, 0x600E, 0x7FD2 },
+  { 0x90CE, 0x991B, 0xF7AF }, { 0x2358, 0x28B0, 0x9FA3 }, { 0xBA35, 0x1937, 0xA93C }, { 0x09A3, 0xA89C, 0xC130 },
+  { 0xF41E, 0xE903, 0x0640 }, { 0x4788, 0x58A8, 0x6E4C }, { 0xDEE5, 0x692F, 0x58D3 }, { 0x6D73, 0xD884, 0x30DF },
+  { 0x5CC8, 0x2191, 0xB8A2 }, { 0xEF5E, 0x903A, 0xD0AE }, { 0x7633, 0xA1BD, 0xE631 }, { 0xC5A5, 0x1016, 0x8E3D },
+  { 0x91B0, 0xDA57, 0x6246 }, { 0x2226, 0x6BFC, 0x0A4A }, { 0xBB4B, 0x5A7B, 0x3CD5 }, { 0x08DD, 0xEBD0, 0x54D9 },
+  { 0x3966, 0x12C5, 0xDCA4 }, { 0x8AF0, 0xA36E, 0xB4A8 }, { 0x139D, 0x92E9, 0x8237 }, { 0xA00B, 0x2342, 0xEA3B },
+  { 0x5DB6, 0x62DD, 0x2D4B }, { 0xEE20, 0xD376, 0x4547 }, { 0x774D, 0xE2F1, 0x73D8 }, { 0xC4DB, 0x535A, 0x1BD4 },
+  { 0xF560, 0xAA4F, 0x93A9 }, { 0x46F6, 0x1BE4, 0xFBA5 }, { 0xDF9B, 0x2A63, 0xCD3A }, { 0x6C0D, 0x9BC8, 0xA536 },
+  { 0xE848, 0x9B47, 0xC2A4 }, { 0x5BDE, 0x2AEC, 0xAAA8 }, { 0xC2B3, 0x1B6B, 0x9C37 }, { 0x7125, 0xAAC0, 0xF43B },
+  { 0x409E, 0x53D5, 0x7C46 }, { 0xF308, 0xE27E, 0x144A }, { 0x6A65, 0xD3F9, 0x22D5 }, { 0xD9F3, 0x6252, 0x4AD9 },
+  { 0x244E, 0x23CD, 0x8DA9 }, { 0x97D8, 0x9266, 0xE5A5 }, { 0x0EB5, 0xA3E1, 0xD33A }, { 0xBD23, 0x124A, 0xBB36 },
+  { 0x8C98, 0xEB5F, 0x334B }, { 0x3F0E, 0x5AF4, 0x5B47 }, { 0xA663, 0x6B73, 0x6DD8 }, { 0x15F5, 0xDAD8, 0x05D4 },
+  { 0xD050, 0xCACE, 0x8BE9 }, { 0x63C6, 0x7B65, 0xE3E5 }, { 0xFAAB, 0x4AE2, 0xD57A }, { 0x493D, 0xFB49, 0xBD76 },
+  { 0x7886, 0x025C, 0x350B }, { 0xCB10, 0xB3F7, 0x5D07 }, { 0x527D, 0x8270, 0x6B98 }, { 0xE1EB, 0x33DB, 0x0394 },
+  { 0x1C56, 0x7244, 0xC4E4 }, { 0xAFC0, 0xC3EF, 0xACE8 }, { 0x36AD, 0xF268, 0x9A77 }, { 0x853B, 0x43C3, 0xF27B },
+  { 0xB480, 0xBAD6, 0x7A06 }, { 0x0716, 0x0B7D, 0x120A }, { 0x9E7B, 0x3AFA, 0x2495 }, { 0x2DED, 0x8B51, 0x4C99 },
+  { 0xA9A8, 0x8BDE, 0x2B0B }, { 0x1A3E, 0x3A75, 0x4307 }, { 0x8353, 0x0BF2, 0x7598 }, { 0x30C5, 0xBA59, 0x1D94 },
+  { 0x017E, 0x434C, 0x95E9 }, { 0xB2E8, 0xF2E7, 0xFDE5 }, { 0x2B85, 0xC360, 0xCB7A }, { 0x9813, 0x72CB, 0xA376 },
+  { 0x65AE, 0x3354, 0x6406 }, { 0xD638, 0x82FF, 0x0C0A }, { 0x4F55, 0xB378, 0x3A95 }, { 0xFCC3, 0x02D3, 0x5299 },
+  { 0xCD78, 0xFBC6, 0xDAE4 }, { 0x7EEE, 0x4A6D, 0xB2E8 }, { 0xE783, 0x7BEA, 0x8477 }, { 0x5415, 0xCA41, 0xEC7B },
+  { 0x3814, 0xD429, 0x405C }, { 0x8B82, 0x6582, 0x2850 }, { 0x12EF, 0x5405, 0x1ECF }, { 0xA179, 0xE5AE, 0x76C3 },
+  { 0x90C2, 0x1CBB, 0xFEBE }, { 0x2354, 0xAD10, 0x96B2 }, { 0xBA39, 0x9C97, 0xA02D }, { 0x09AF, 0x2D3C, 0xC821 },
+  { 0xF412, 0x6CA3, 0x0F51 }, { 0x4784, 0xDD08, 0x675D }, { 0xDEE9, 0xEC8F, 0x51C2 }, { 0x6D7F, 0x5D24, 0x39CE },
+  { 0x5CC4, 0xA431, 0xB1B3 }, { 0xEF52, 0x159A, 0xD9BF }, { 0x763F, 0x241D, 0xEF20 }, { 0xC5A9, 0x95B6, 0x872C },
+  { 0x41EC, 0x9539, 0xE0BE }, { 0xF27A, 0x2492, 0x88B2 }, { 0x6B17, 0x1515, 0xBE2D }, { 0xD881, 0xA4BE, 0xD621 },
+  { 0xE93A, 0x5DAB, 0x5E5C }, { 0x5AAC, 0xEC00, 0x3650 }, { 0xC3C1, 0xDD87, 0x00CF }, { 0x7057, 0x6C2C, 0x68C3 },
+  { 0x8DEA, 0x2DB3, 0xAFB3 }, { 0x3E7C, 0x9C18, 0xC7BF }, { 0xA711, 0xAD9F, 0xF120 }, { 0x1487, 0x1C34, 0x992C },
+  { 0x253C, 0xE521, 0x1151 }, { 0x96AA, 0x548A, 0x795D }, { 0x0FC7, 0x650D, 0x4FC2 }, { 0xBC51, 0xD4A6, 0x27CE },
+  { 0x79F4, 0xC4B0, 0xA9F3 }, { 0xCA62, 0x751B, 0xC1FF }, { 0x530F, 0x449C, 0xF760 }, { 0xE099, 0xF537, 0x9F6C },
+  { 0xD122, 0x0C22, 0x1711 }, { 0x62B4, 0xBD89, 0x7F1D }, { 0xFBD9, 0x8C0E, 0x4982 }, { 0x484F, 0x3DA5, 0x218E },
+  { 0xB5F2, 0x7C3A, 0xE6FE }, { 0x0664, 0xCD91, 0x8EF2 }, { 0x9F09, 0xFC16, 0xB86D }, { 0x2C9F, 0x4DBD, 0xD061 },
+  { 0x1D24, 0xB4A8, 0x581C }, { 0xAEB2, 0x0503, 0x3010 }, { 0x37DF, 0x3484, 0x068F }, { 0x8449, 0x852F, 0x6E83 },
+  { 0x000C, 0x85A0, 0x0911 }, { 0xB39A, 0x340B, 0x611D }, { 0x2AF7, 0x058C, 0x5782 }, { 0x9961, 0xB427, 0x3F8E },
+  { 0xA8DA, 0x4D32, 0xB7F3 }, { 0x1B4C, 0xFC99, 0xDFFF }, { 0x8221, 0xCD1E, 0xE960 }, { 0x31B7, 0x7CB5, 0x816C },
+  { 0xCC0A, 0x3D2A, 0x461C }, { 0x7F9C, 0x8C81, 0x2E10 }, { 0xE6F1, 0xBD06, 0x188F }, { 0x5567, 0x0CAD, 0x7083 },
+  { 0x64DC, 0xF5B8, 0xF8FE }, { 0xD74A, 0x4413, 0x90F2 }, { 0x4E27, 0x7594, 0xA66D }, { 0xFDB1, 0xC43F, 0xCE61 },
+  { 0xA9A4, 0x0E7E, 0x221A }, { 0x1A32, 0xBFD5, 0x4A16 }, { 0x835F, 0x8E52, 0x7C89 }, { 0x30C9, 0x3FF9, 0x1485 },
+  { 0x0172, 0xC6EC, 0x9CF8 }, { 0xB2E4, 0x7747, 0xF4F4 }, { 0x2B89, 0x46C0, 0xC26B }, { 0x981F, 0xF76B, 0xAA67 },
+  { 0x65A2, 0xB6F4, 0x6D17 }, { 0xD634, 0x075F, 0x051B }, { 0x4F59, 0x36D8, 0x3384 }, { 0xFCCF, 0x8773, 0x5B88 },
+  { 0xCD74, 0x7E66, 0xD3F5 }, { 0x7EE2, 0xCFCD, 0xBBF9 }, { 0xE78F, 0xFE4A, 0x8D66 }, { 0x5419, 0x4FE1, 0xE56A },
+  { 0xD05C, 0x4F6E, 0x82F8 }, { 0x63CA, 0xFEC5, 0xEAF4 }, { 0xFAA7, 0xCF42, 0xDC6B }, { 0x4931, 0x7EE9, 0xB467 },
+  { 0x788A, 0x87FC, 0x3C1A }, { 0xCB1C, 0x3657, 0x5416 }, { 0x5271, 0x07D0, 0x6289 }, { 0xE1E7, 0xB67B, 0x0A85 },
+  { 0x1C5A, 0xF7E4, 0xCDF5 }, { 0xAFCC, 0x464F, 0xA5F9 }, { 0x36A1, 0x77C8, 0x9366 }, { 0x8537, 0xC663, 0xFB6A },
+  { 0xB48C, 0x3F76, 0x7317 }, { 0x071A, 0x8EDD, 0x1B1B }, { 0x9E77, 0xBF5A, 0x2D84 }, { 0x2DE1, 0x0EF1, 0x4588 },
+  { 0xE844, 0x1EE7, 0xCBB5 }, { 0x5BD2, 0xAF4C, 0xA3B9 }, { 0xC2BF, 0x9ECB, 0x9526 }, { 0x7129, 0x2F60, 0xFD2A },
+  { 0x4092, 0xD675, 0x7557 }, { 0xF304, 0x67DE, 0x1D5B }, { 0x6A69, 0x5659, 0x2BC4 }, { 0xD9FF, 0xE7F2, 0x43C8 },
+  { 0x2442, 0xA66D, 0x84B8 }, { 0x97D4, 0x17C6, 0xECB4 }, { 0x0EB9, 0x2641, 0xDA2B }, { 0xBD2F, 0x97EA, 0xB227 },
+  { 0x8C94, 0x6EFF, 0x3A5A }, { 0x3F02, 0xDF54, 0x5256 }, { 0xA66F, 0xEED3, 0x64C9 }, { 0x15F9, 0x5F78, 0x0CC5 },
+  { 0x91BC, 0x5FF7, 0x6B57 }, { 0x222A, 0xEE5C, 0x035B }, { 0xBB47, 0xDFDB, 0x35C4 }, { 0x08D1, 0x6E70, 0x5DC8 },
+  { 0x396A, 0x9765, 0xD5B5 }, { 0x8AFC, 0x26CE, 0xBDB9 }, { 0x1391, 0x1749, 0x8B26 }, { 0xA007, 0xA6E2, 0xE32A },
+  { 0x5DBA, 0xE77D, 0x245A }, { 0xEE2C, 0x56D6, 0x4C56 }, { 0x7741, 0x6751, 0x7AC9 }, { 0xC4D7, 0xD6FA, 0x12C5 },
+  { 0xF56C, 0x2FEF, 0x9AB8 }, { 0x46FA, 0x9E44, 0xF2B4 }, { 0xDF97, 0xAFC3, 0xC42B }, { 0x6C01, 0x1E68, 0xAC27 }
+ },
+ {  // byte 2
+  { 0x0000, 0x0000, 0x0000 }, { 0xA78D, 0x177B, 0xF0A4 }, { 0xE998, 0xB0A7, 0x570C }, { 0x4E15, 0xA7DC, 0xA7A8 },
+  { 0x44DA, 0xED1D, 0xAAF8 }, { 0xE357, 0xFA66, 0x5A5C }, { 0xAD42, 0x5DBA, 0xFDF4 }, { 0x0ACF, 0x4AC1, 0x0D50 },
+  { 0x8A23, 0x8F7F, 0x9A36 }, { 0x2DAE, 0x9804, 0x6A92 }, { 0x63BB, 0x3FD8, 0xCD3A }, { 0xC436, 0x28A3, 0x3D9E },
+  { 0xCEF9, 0x6262, 0x30CE }, { 0x6974, 0x7519, 0xC06A }, { 0x2761, 0xD2C5, 0x67C2 }, { 0x80EC, 0xC5BE, 0x9766 },
+  { 0x5822, 0xBB68, 0x410B }, { 0xFFAF, 0xAC13, 0xB1AF }, { 0xB1BA, 0x0BCF, 0x1607 }, { 0x1637, 0x1CB4, 0xE6A3 },
+  { 0x1CF8, 0x5675, 0xEBF3 }, { 0xBB75, 0x410E, 0x1B57 }, { 0xF560, 0xE6D2, 0xBCFF }, { 0x52ED, 0xF1A9, 0x4C5B },
+  { 0xD201, 0x3417, 0xDB3D }, { 0x758C, 0x236C, 0x2B99 }, { 0x3B99, 0x84B0, 0x8C31 }, { 0x9C14, 0x93CB, 0x7C95 },
+  { 0x96DB, 0xD90A, 0x71C5 }, { 0x3156, 0xCE71, 0x8161 }, { 0x7F43, 0x69AD, 0x26C9 }, { 0xD8CE, 0x7ED6, 0xD66D },
+  { 0xBEA3, 0x3C07, 0x7A2F }, { 0x192E, 0x2B7C, 0x8A8B }, { 0x573B, 0x8CA0, 0x2D23 }, { 0xF0B6, 0x9BDB, 0xDD87 },
+  { 0xFA79, 0xD11A, 0xD0D7 }, { 0x5DF4, 0xC661, 0x2073 }, { 0x13E1, 0x61BD, 0x87DB }, { 0xB46C, 0x76C6, 0x777F },
+  { 0x3480, 0xB378, 0xE019 }, { 0x930D, 0xA403, 0x10BD }, { 0xDD18, 0x03DF, 0xB715 }, { 0x7A95, 0x14A4, 0x47B1 },
+  { 0x705A, 0x5E65, 0x4AE1 }, { 0xD7D7, 0x491E, 0xBA45 }, { 0x99C2, 0xEEC2, 0x1DED }, { 0x3E4F, 0xF9B9, 0xED49 },
+  { 0xE681, 0x876F, 0x3B24 }, { 0x410C, 0x9014, 0xCB80 }, { 0x0F19, 0x37C8, 0x6C28 }, { 0xA894, 0x20B3, 0x9C8C },
+  { 0xA25B, 0x6A72, 0x91DC }, { 0x05D6, 0x7D09, 0x6178 }, { 0x4BC3, 0xDAD5, 0xC6D0 }, { 0xEC4E, 0xCDAE, 0x3674 },
+  { 0x6CA2, 0x0810, 0xA112 }, { 0xCB2F, 0x1F6B, 0x51B6 }, { 0x853A, 0xB8B7, 0xF61E }, { 0x22B7, 0xAFCC, 0x06BA },
+  { 0x2878, 0xE50D, 0x0BEA }, { 0x8FF5, 0xF276, 0xFB4E }, { 0xC1E0, 0x55AA, 0x5CE6 }, { 0x666D, 0x42D1, 0xAC42 },
+  { 0xF9AC, 0x8AF3, 0xAD03 }, { 0x5E21, 0x9D88, 0x5DA7 }, { 0x1034, 0x3A54, 0xFA0F }, { 0xB7B9, 0x2D2F, 0x0AAB },
+  { 0xBD76, 0x67EE, 0x07FB }, { 0x1AFB, 0x7095, 0xF75F }, { 0x54EE, 0xD749, 0x50F7 }, { 0xF363, 0xC032, 0xA053 },
+  { 0x738F, 0x058C, 0x3735 }, { 0xD402, 0x12F7, 0xC791 }, { 0x9A17, 0xB52B, 0x6039 }, { 0x3D9A, 0xA250, 0x909D },
+  { 0x3755, 0xE891, 0x9DCD }, { 0x90D8, 0xFFEA, 0x6D69 }, { 0xDECD, 0x5836, 0xCAC1 }, { 0x7940, 0x4F4D, 0x3A65 },
+  { 0xA18E, 0x319B, 0xEC08 }, { 0x0603, 0x26E0, 0x1CAC }, { 0x4816, 0x813C, 0xBB04 }, { 0xEF9B, 0x9647, 0x4BA0 },
+  { 0xE554, 0xDC86, 0x46F0 }, { 0x42D9, 0xCBFD, 0xB654 }, { 0x0CCC, 0x6C21, 0x11FC }, { 0xAB41, 0x7B5A, 0xE158 },
+  { 0x2BAD, 0xBEE4, 0x763E }, { 0x8C20, 0xA99F, 0x869A }, { 0xC235, 0x0E43, 0x2132 }, { 0x65B8, 0x1938, 0xD196 },
+  { 0x6F77, 0x53F9, 0xDCC6 }, { 0xC8FA, 0x4482, 0x2C62 }, { 0x86EF, 0xE35E, 0x8BCA }, { 0x2162, 0xF425, 0x7B6E },
+  { 0x470F, 0xB6F4, 0xD72C }, { 0xE082, 0xA18F, 0x2788 }, { 0xAE97, 0x0653, 0x8020 }, { 0x091A, 0x1128, 0x7084 },
+  { 0x03D5, 0x5BE9, 0x7DD4 }, { 0xA458, 0x4C92, 0x8D70 }, { 0xEA4D, 0xEB4E, 0x2AD8 }, { 0x4DC0, 0xFC35, 0xDA7C },
+  { 0xCD2C, 0x398B, 0x4D1A }, { 0x6AA1, 0x2EF0, 0xBDBE }, { 0x24B4, 0x892C, 0x1A16 }, { 0x8339, 0x9E57, 0xEAB2 },
+  { 0x89F6, 0xD496, 0xE7E2 }, { 0x2E7B, 0xC3ED, 0x1746 }, { 0x606E, 0x6431, 0xB0EE }, { 0xC7E3, 0x734A, 0x404A },
+  { 0x1F2D, 0x0D9C, 0x9627 }, { 0xB8A0, 0x1AE7, 0x6683 }, { 0xF6B5, 0xBD3B, 0xC12B }, { 0x5138, 0xAA40, 0x318F },
+  { 0x5BF7, 0xE081, 0x3CDF }, { 0xFC7A, 0xF7FA, 0xCC7B }, { 0xB26F, 0x5026, 0x6BD3 }, { 0x15E2, 0x475D, 0x9B77 },
+  { 0x950E, 0x82E3, 0x0C11 }, { 0x3283, 0x9598, 0xFCB5 }, { 0x7C96, 0x3244, 0x5B1D }, { 0xDB1B, 0x253F, 0xABB9 },
+  { 0xD1D4, 0x6FFE, 0xA6E9 }, { 0x7659, 0x7885, 0x564D }, { 0x384C, 0xDF59, 0xF1E5 }, { 0x9FC1, 0xC822, 0x0141 },
+  { 0xC5FB, 0x27F3, 0x9CAB }, { 0x6276, 0x3088, 0x6C0F }, { 0x2C63, 0x9754, 0xCBA7 }, { 0x8BEE, 0x802F, 0x3B03 },
+  { 0x8121, 0xCAEE, 0x3653 }, { 0x26AC, 0xDD95, 0xC6F7 }, { 0x68B9, 0x7A49, 0x615F }, { 0xCF34, 0x6D32, 0x91FB },
+  { 0x4FD8, 0xA88C, 0x069D }, { 0xE855, 0xBFF7, 0xF639 }, { 0xA640, 0x182B, 0x5191 }, { 0x01CD, 0x0F50, 0xA135 },
+  { 0x0B02, 0x4591, 0xAC65 }, { 0xAC8F, 0x52EA, 0x5CC1 }, { 0xE29A, 0xF536, 0xFB69 }, { 0x4517, 0xE24D, 0x0BCD },
+  { 0x9DD9, 0x9C9B, 0xDDA0 }, { 0x3A54, 0x8BE0, 0x2D04 }, { 0x7441, 0x2C3C, 0x8AAC }, { 0xD3CC, 0x3B47, 0x7A08 },
+  { 0xD903, 0x7186, 0x7758 }, { 0x7E8E, 0x66FD, 0x87FC }, { 0x309B, 0xC121, 0x2054 }, { 0x9716, 0xD65A, 0xD0F0 },
+  { 0x17FA, 0x13E4, 0x4796 }, { 0xB077, 0x049F, 0xB732 }, { 0xFE62, 0xA343, 0x109A }, { 0x59EF, 0xB438, 0xE03E },
+  { 0x5320, 0xFEF9, 0xED6E }, { 0xF4AD, 0xE982, 0x1DCA }, { 0xBAB8, 0x4E5E, 0xBA62 }, { 0x1D35, 0x5925, 0x4AC6 },
+  { 0x7B58, 0x1BF4, 0xE684 }, { 0xDCD5, 0x0C8F, 0x1620 }, { 0x92C0, 0xAB53, 0xB188 }, { 0x354D, 0xBC28, 0x412C },
+  { 0x3F82, 0xF6E9, 0x4C7C }, { 0x980F, 0xE192, 0xBCD8 }, { 0xD61A, 0x464E, 0x1B70 }, { 0x7197, 0x5135, 0xEBD4 },
+  { 0xF17B, 0x948B, 0x7CB2 }, { 0x56F6, 0x83F0, 0x8C16 }, { 0x18E3, 0x242C, 0x2BBE }, { 0xBF6E, 0x3357, 0xDB1A },
+  { 0xB5A1, 0x7996, 0xD64A }, { 0x122C, 0x6EED, 0x26EE }, { 0x5C39, 0xC931, 0x8146 }, { 0xFBB4, 0xDE4A, 0x71E2 },
+  { 0x237A, 0xA09C, 0xA78F }, { 0x84F7, 0xB7E7, 0x572B }, { 0xCAE2, 0x103B, 0xF083 }, { 0x6D6F, 0x0740, 0x0027 },
+  { 0x67A0, 0x4D81, 0x0D77 }, { 0xC02D, 0x5AFA, 0xFDD3 }, { 0x8E38, 0xFD26, 0x5A7B }, { 0x29B5, 0xEA5D, 0xAADF },
+  { 0xA959, 0x2FE3, 0x3DB9 }, { 0x0ED4, 0x3898, 0xCD1D }, { 0x40C1, 0x9F44, 0x6AB5 }, { 0xE74C, 0x883F, 0x9A11 },
+  { 0xED83, 0xC2FE, 0x9741 }, { 0x4A0E, 0xD585, 0x67E5 }, { 0x041B, 0x7259, 0xC04D }, { 0xA396, 0x6522, 0x30E9 },
+  { 0x3C57, 0xAD00, 0x31A8 }, { 0x9BDA, 0xBA7B, 0xC10C }, { 0xD5CF, 0x1DA7, 0x66A4 }, { 0x7242, 0x0ADC, 0x9600 },
+  { 0x788D, 0x401D, 0x9B50 }, { 0xDF00, 0x5766, 0x6BF4 }, { 0x9115, 0xF0BA, 0xCC5C }, { 0x3698, 0xE7C1, 0x3CF8 },
+  { 0xB674, 0x227F, 0xAB9E }, { 0x11F9, 0x3504, 0x5B3A }, { 0x5FEC, 0x92D8, 0xFC92 }, { 0xF861, 0x85A3, 0x0C36 },
+  { 0xF2AE, 0xCF62, 0x0166 }, { 0x5523, 0xD819, 0xF1C2 }, { 0x1B36, 0x7FC5, 0x566A }, { 0xBCBB, 0x68BE, 0xA6CE },
+  { 0x6475, 0x1668, 0x70A3 }, { 0xC3F8, 0x0113, 0x8007 }, { 0x8DED, 0xA6CF, 0x27AF }, { 0x2A60, 0xB1B4, 0xD70B },
+  { 0x20AF, 0xFB75, 0xDA5B }, { 0x8722, 0xEC0E, 0x2AFF }, { 0xC937, 0x4BD2, 0x8D57 }, { 0x6EBA, 0x5CA9, 0x7DF3 },
+  { 0xEE56, 0x9917, 0xEA95 }, { 0x49DB, 0x8E6C, 0x1A31 }, { 0x07CE, 0x29B0, 0xBD99 }, { 0xA043, 0x3ECB, 0x4D3D },
+  { 0xAA8C, 0x740A, 0x406D }, { 0x0D01, 0x6371, 0xB0C9 }, { 0x4314, 0xC4AD, 0x1761 }, { 0xE499, 0xD3D6, 0xE7C5 },
+  { 0x82F4, 0x9107, 0x4B87 }, { 0x2579, 0x867C, 0xBB23 }, { 0x6B6C, 0x21A0, 0x1C8B }, { 0xCCE1, 0x36DB, 0xEC2F },
+  { 0xC62E, 0x7C1A, 0xE17F }, { 0x61A3, 0x6B61, 0x11DB }, { 0x2FB6, 0xCCBD, 0xB673 }, { 0x883B, 0xDBC6, 0x46D7 },
+  { 0x08D7, 0x1E78, 0xD1B1 }, { 0xAF5A, 0x0903, 0x2115 }, { 0xE14F, 0xAEDF, 0x86BD }, { 0x46C2, 0xB9A4, 0x7619 },
+  { 0x4C0D, 0xF365, 0x7B49 }, { 0xEB80, 0xE41E, 0x8BED }, { 0xA595, 0x43C2, 0x2C45 }, { 0x0218, 0x54B9, 0xDCE1 },
+  { 0xDAD6, 0x2A6F, 0x0A8C }, { 0x7D5B, 0x3D14, 0xFA28 }, { 0x334E, 0x9AC8, 0x5D80 }, { 0x94C3, 0x8DB3, 0xAD24 },
+  { 0x9E0C, 0xC772, 0xA074 }, { 0x3981, 0xD009, 0x50D0 }, { 0x7794, 0x77D5, 0xF778 }, { 0xD019, 0x60AE, 0x07DC },
+  { 0x50F5, 0xA510, 0x90BA }, { 0xF778, 0xB26B, 0x601E }, { 0xB96D, 0x15B7, 0xC7B6 }, { 0x1EE0, 0x02CC, 0x3712 },
+  { 0x142F, 0x480D, 0x3A42 }, { 0xB3A2, 0x5F76, 0xCAE6 }, { 0xFDB7, 0xF8AA, 0x6D4E }, { 0x5A3A, 0xEFD1, 0x9DEA }
+ },
+ {  // byte 3
+  { 0x0000, 0x0000, 0x0000 }, { 0xAE30, 0x423E, 0xBB63 }, { 0xD874, 0xF52A, 0x41DE }, { 0x7644, 0xB714, 0xFABD },
+  { 0xB68E, 0xFD3A, 0xE17C }, { 0x18BE, 0xBF04, 0x5A1F }, { 0x6EFA, 0x0810, 0xA0A2 }, { 0xC0CA, 0x4A2E, 0x1BC1 },
+  { 0x12E2, 0xD185, 0x47E7 }, { 0xBCD2, 0x93BB, 0xFC84 }, { 0xCA96, 0x24AF, 0x0639 }, { 0x64A6, 0x6691, 0xBD5A },
+  { 0xA46C, 0x2CBF, 0xA69B }, { 0x0A5C, 0x6E81, 0x1DF8 }, { 0x7C18, 0xD995, 0xE745 }, { 0xD228, 0x9BAB, 0x5C26 },
+  { 0xC5B0, 0xF8BA, 0xCDAB }, { 0x6B80, 0xBA84, 0x76C8 }, { 0x1DC4, 0x0D90, 0x8C75 }, { 0xB3F4, 0x4FAE, 0x3716 },
+  { 0x733E, 0x0580, 0x2CD7 }, { 0xDD0E, 0x47BE, 0x97B4 }, { 0xAB4A, 0xF0AA, 0x6D09 }, { 0x057A, 0xB294, 0xD66A },
+  { 0xD752, 0x293F, 0x8A4C }, { 0x7962, 0x6B01, 0x312F }, { 0x0F26, 0xDC15, 0xCB92 }, { 0xA116, 0x9E2B, 0x70F1 },
+  { 0x61DC, 0xD405, 0x6B30 }, { 0xCFEC, 0x963B, 0xD053 }, { 0xB9A8, 0x212F, 0x2AEE }, { 0x1798, 0x6311, 0x918D },
+  { 0x50F4, 0x5E49, 0x50D7 }, { 0xFEC4, 0x1C77, 0xEBB4 }, { 0x8880, 0xAB63, 0x1109 }, { 0x26B0, 0xE95D, 0xAA6A },
+  { 0xE67A, 0xA373, 0xB1AB }, { 0x484A, 0xE14D, 0x0AC8 }, { 0x3E0E, 0x5659, 0xF075 }, { 0x903E, 0x1467, 0x4B16 },
+  { 0x4216, 0x8FCC, 0x1730 }, { 0xEC26, 0xCDF2, 0xAC53 }, { 0x9A62, 0x7AE6, 0x56EE }, { 0x3452, 0x38D8, 0xED8D },
+  { 0xF498, 0x72F6, 0xF64C }, { 0x5AA8, 0x30C8, 0x4D2F }, { 0x2CEC, 0x87DC, 0xB792 }, { 0x82DC, 0xC5E2, 0x0CF1 },
+  { 0x9544, 0xA6F3, 0x9D7C }, { 0x3B74, 0xE4CD, 0x261F }, { 0x4D30, 0x53D9, 0xDCA2 }, { 0xE300, 0x11E7, 0x67C1 },
+  { 0x23CA, 0x5BC9, 0x7C00 }, { 0x8DFA, 0x19F7, 0xC763 }, { 0xFBBE, 0xAEE3, 0x3DDE }, { 0x558E, 0xECDD, 0x86BD },
+  { 0x87A6, 0x7776, 0xDA9B }, { 0x2996, 0x3548, 0x61F8 }, { 0x5FD2, 0x825C, 0x9B45 }, { 0xF1E2, 0xC062, 0x2026 },
+  { 0x3128, 0x8A4C, 0x3BE7 }, { 0x9F18, 0xC872, 0x8084 }, { 0xE95C, 0x7F66, 0x7A39 }, { 0x476C, 0x3D58, 0xC15A },
+  { 0xB13F, 0x1FD7, 0xD727 }, { 0x1F0F, 0x5DE9, 0x6C44 }, { 0x694B, 0xEAFD, 0x96F9 }, { 0xC77B, 0xA8C3, 0x2D9A },
+  { 0x07B1, 0xE2ED, 0x365B }, { 0xA981, 0xA0D3, 0x8D38 }, { 0xDFC5, 0x17C7, 0x7785 }, { 0x71F5, 0x55F9, 0xCCE6 },
+  { 0xA3DD, 0xCE52, 0x90C0 }, { 0x0DED, 0x8C6C, 0x2BA3 }, { 0x7BA9, 0x3B78, 0xD11E }, { 0xD599, 0x7946, 0x6A7D },
+  { 0x1553, 0x3368, 0x71BC }, { 0xBB63, 0x7156, 0xCADF }, { 0xCD27, 0xC642, 0x3062 }, { 0x6317, 0x847C, 0x8B01 },
+  { 0x748F, 0xE76D, 0x1A8C }, { 0xDABF, 0xA553, 0xA1EF }, { 0xACFB, 0x1247, 0x5B52 }, { 0x02CB, 0x5079, 0xE031 },
+  { 0xC201, 0x1A57, 0xFBF0 }, { 0x6C31, 0x5869, 0x4093 }, { 0x1A75, 0xEF7D, 0xBA2E }, { 0xB445, 0xAD43, 0x014D },
+  { 0x666D, 0x36E8, 0x5D6B }, { 0xC85D, 0x74D6, 0xE608 }, { 0xBE19, 0xC3C2, 0x1CB5 }, { 0x1029, 0x81FC, 0xA7D6 },
+  { 0xD0E3, 0xCBD2, 0xBC17 }, { 0x7ED3, 0x89EC, 0x0774 }, { 0x0897, 0x3EF8, 0xFDC9 }, { 0xA6A7, 0x7CC6, 0x46AA },
+  { 0xE1CB, 0x419E, 0x87F0 }, { 0x4FFB, 0x03A0, 0x3C93 }, { 0x39BF, 0xB4B4, 0xC62E }, { 0x978F, 0xF68A, 0x7D4D },
+  { 0x5745, 0xBCA4, 0x668C }, { 0xF975, 0xFE9A, 0xDDEF }, { 0x8F31, 0x498E, 0x2752 }, { 0x2101, 0x0BB0, 0x9C31 },
+  { 0xF329, 0x901B, 0xC017 }, { 0x5D19, 0xD225, 0x7B74 }, { 0x2B5D, 0x6531, 0x81C9 }, { 0x856D, 0x270F, 0x3AAA },
+  { 0x45A7, 0x6D21, 0x216B }, { 0xEB97, 0x2F1F, 0x9A08 }, { 0x9DD3, 0x980B, 0x60B5 }, { 0x33E3, 0xDA35, 0xDBD6 },
+  { 0x247B, 0xB924, 0x4A5B }, { 0x8A4B, 0xFB1A, 0xF138 }, { 0xFC0F, 0x4C0E, 0x0B85 }, { 0x523F, 0x0E30, 0xB0E6 },
+  { 0x92F5, 0x441E, 0xAB27 }, { 0x3CC5, 0x0620, 0x1044 }, { 0x4A81, 0xB134, 0xEAF9 }, { 0xE4B1, 0xF30A, 0x519A },
+  { 0x3699, 0x68A1, 0x0DBC }, { 0x98A9, 0x2A9F, 0xB6DF }, { 0xEEED, 0x9D8B, 0x4C62 }, { 0x40DD, 0xDFB5, 0xF701 },
+  { 0x8017, 0x959B, 0xECC0 }, { 0x2E27, 0xD7A5, 0x57A3 }, { 0x5863, 0x60B1, 0xAD1E }, { 0xF653, 0x228F, 0x167D },
+  { 0xF3C2, 0x01AE, 0x37C1 }, { 0x5DF2, 0x4390, 0x8CA2 }, { 0x2BB6, 0xF484, 0x761F }, { 0x8586, 0xB6BA, 0xCD7C },
+  { 0x454C, 0xFC94, 0xD6BD }, { 0xEB7C, 0xBEAA, 0x6DDE }, { 0x9D38, 0x09BE, 0x9763 }, { 0x3308, 0x4B80, 0x2C00 },
+  { 0xE120, 0xD02B, 0x7026 }, { 0x4F10, 0x9215, 0xCB45 }, { 0x3954, 0x2501, 0x31F8 }, { 0x9764, 0x673F, 0x8A9B },
+  { 0x57AE, 0x2D11, 0x915A }, { 0xF99E, 0x6F2F, 0x2A39 }, { 0x8FDA, 0xD83B, 0xD084 }, { 0x21EA, 0x9A05, 0x6BE7 },
+  { 0x3672, 0xF914, 0xFA6A }, { 0x9842, 0xBB2A, 0x4109 }, { 0xEE06, 0x0C3E, 0xBBB4 }, { 0x4036, 0x4E00, 0x00D7 },
+  { 0x80FC, 0x042E, 0x1B16 }, { 0x2ECC, 0x4610, 0xA075 }, { 0x5888, 0xF104, 0x5AC8 }, { 0xF6B8, 0xB33A, 0xE1AB },
+  { 0x2490, 0x2891, 0xBD8D }, { 0x8AA0, 0x6AAF, 0x06EE }, { 0xFCE4, 0xDDBB, 0xFC53 }, { 0x52D4, 0x9F85, 0x4730 },
+  { 0x921E, 0xD5AB, 0x5CF1 }, { 0x3C2E, 0x9795, 0xE792 }, { 0x4A6A, 0x2081, 0x1D2F }, { 0xE45A, 0x62BF, 0xA64C },
+  { 0xA336, 0x5FE7, 0x6716 }, { 0x0D06, 0x1DD9, 0xDC75 }, { 0x7B42, 0xAACD, 0x26C8 }, { 0xD572, 0xE8F3, 0x9DAB },
+  { 0x15B8, 0xA2DD, 0x866A }, { 0xBB88, 0xE0E3, 0x3D09 }, { 0xCDCC, 0x57F7, 0xC7B4 }, { 0x63FC, 0x15C9, 0x7CD7 },
+  { 0xB1D4, 0x8E62, 0x20F1 }, { 0x1FE4, 0xCC5C, 0x9B92 }, { 0x69A0, 0x7B48, 0x612F }, { 0xC790, 0x3976, 0xDA4C },
+  { 0x075A, 0x7358, 0xC18D }, { 0xA96A, 0x3166, 0x7AEE }, { 0xDF2E, 0x8672, 0x8053 }, { 0x711E, 0xC44C, 0x3B30 },
+  { 0x6686, 0xA75D, 0xAABD }, { 0xC8B6, 0xE563, 0x11DE }, { 0xBEF2, 0x5277, 0xEB63 }, { 0x10C2, 0x1049, 0x5000 },
+  { 0xD008, 0x5A67, 0x4BC1 }, { 0x7E38, 0x1859, 0xF0A2 }, { 0x087C, 0xAF4D, 0x0A1F }, { 0xA64C, 0xED73, 0xB17C },
+  { 0x7464, 0x76D8, 0xED5A }, { 0xDA54, 0x34E6, 0x5639 }, { 0xAC10, 0x83F2, 0xAC84 }, { 0x0220, 0xC1CC, 0x17E7 },
+  { 0xC2EA, 0x8BE2, 0x0C26 }, { 0x6CDA, 0xC9DC, 0xB745 }, { 0x1A9E, 0x7EC8, 0x4DF8 }, { 0xB4AE, 0x3CF6, 0xF69B },
+  { 0x42FD, 0x1E79, 0xE0E6 }, { 0xECCD, 0x5C47, 0x5B85 }, { 0x9A89, 0xEB53, 0xA138 }, { 0x34B9, 0xA96D, 0x1A5B },
+  { 0xF473, 0xE343, 0x019A }, { 0x5A43, 0xA17D, 0xBAF9 }, { 0x2C07, 0x1669, 0x4044 }, { 0x8237, 0x5457, 0xFB27 },
+  { 0x501F, 0xCFFC, 0xA701 }, { 0xFE2F, 0x8DC2, 0x1C62 }, { 0x886B, 0x3AD6, 0xE6DF }, { 0x265B, 0x78E8, 0x5DBC },
+  { 0xE691, 0x32C6, 0x467D }, { 0x48A1, 0x70F8, 0xFD1E }, { 0x3EE5, 0xC7EC, 0x07A3 }, { 0x90D5, 0x85D2, 0xBCC0 },
+  { 0x874D, 0xE6C3, 0x2D4D }, { 0x297D, 0xA4FD, 0x962E }, { 0x5F39, 0x13E9, 0x6C93 }, { 0xF109, 0x51D7, 0xD7F0 },
+  { 0x31C3, 0x1BF9, 0xCC31 }, { 0x9FF3, 0x59C7, 0x7752 }, { 0xE9B7, 0xEED3, 0x8DEF }, { 0x4787, 0xACED, 0x368C },
+  { 0x95AF, 0x3746, 0x6AAA }, { 0x3B9F, 0x7578, 0xD1C9 }, { 0x4DDB, 0xC26C, 0x2B74 }, { 0xE3EB, 0x8052, 0x9017 },
+  { 0x2321, 0xCA7C, 0x8BD6 }, { 0x8D11, 0x8842, 0x30B5 }, { 0xFB55, 0x3F56, 0xCA08 }, { 0x5565, 0x7D68, 0x716B },
+  { 0x1209, 0x4030, 0xB031 }, { 0xBC39, 0x020E, 0x0B52 }, { 0xCA7D, 0xB51A, 0xF1EF }, { 0x644D, 0xF724, 0x4A8C },
+  { 0xA487, 0xBD0A, 0x514D }, { 0x0AB7, 0xFF34, 0xEA2E }, { 0x7CF3, 0x4820, 0x1093 }, { 0xD2C3, 0x0A1E, 0xABF0 },
+  { 0x00EB, 0x91B5, 0xF7D6 }, { 0xAEDB, 0xD38B, 0x4CB5 }, { 0xD89F, 0x649F, 0xB608 }, { 0x76AF, 0x26A1, 0x0D6B },
+  { 0xB665, 0x6C8F, 0x16AA }, { 0x1855, 0x2EB1, 0xADC9 }, { 0x6E11, 0x99A5, 0x5774 }, { 0xC021, 0xDB9B, 0xEC17 },
+  { 0xD7B9, 0xB88A, 0x7D9A }, { 0x7989, 0xFAB4, 0xC6F9 }, { 0x0FCD, 0x4DA0, 0x3C44 }, { 0xA1FD, 0x0F9E, 0x8727 },
+  { 0x6137, 0x45B0, 0x9CE6 }, { 0xCF07, 0x078E, 0x2785 }, { 0xB943, 0xB09A, 0xDD38 }, { 0x1773, 0xF2A4, 0x665B },
+  { 0xC55B, 0x690F, 0x3A7D }, { 0x6B6B, 0x2B31, 0x811E }, { 0x1D2F, 0x9C25, 0x7BA3 }, { 0xB31F, 0xDE1B, 0xC0C0 },
+  { 0x73D5, 0x9435, 0xDB01 }, { 0xDDE5, 0xD60B, 0x6062 }, { 0xABA1, 0x611F, 0x9ADF }, { 0x0591, 0x2321, 0x21BC }
+ },
+ {  // byte 4
+  { 0x0000, 0x0000, 0x0000 }, { 0x4D5D, 0x9274, 0xE2F4 }, { 0x999C, 0xAAF2, 0xBD29 }, { 0xD4C1, 0x3886, 0x5FDD },
+  { 0x5B4E, 0x2EFD, 0x87BC }, { 0x1613, 0xBC89, 0x6548 }, { 0xC2D2, 0x840F, 0x3A95 }, { 0x8F8F, 0x167B, 0xD861 },
+  { 0xC56F, 0x7DAB, 0x6CCE }, { 0x8832, 0xEFDF, 0x8E3A }, { 0x5CF3, 0xD759, 0xD1E7 }, { 0x11AE, 0x452D, 0x3313 },
+  { 0x9E21, 0x5356, 0xEB72 }, { 0xD37C, 0xC122, 0x0986 }, { 0x07BD, 0xF9A4, 0x565B }, { 0x4AE0, 0x6BD0, 0xB4AF },
+  { 0xEE8E, 0xA74F, 0x6A18 }, { 0xA3D3, 0x353B, 0x88EC }, { 0x7712, 0x0DBD, 0xD731 }, { 0x3A4F, 0x9FC9, 0x35C5 },
+  { 0xB5C0, 0x89B2, 0xEDA4 }, { 0xF89D, 0x1BC6, 0x0F50 }, { 0x2C5C, 0x2340, 0x508D }, { 0x6101, 0xB134, 0xB279 },
+  { 0x2BE1, 0xDAE4, 0x06D6 }, { 0x66BC, 0x4890, 0xE422 }, { 0xB27D, 0x7016, 0xBBFF }, { 0xFF20, 0xE262, 0x590B },
+  { 0x70AF, 0xF419, 0x816A }, { 0x3DF2, 0x666D, 0x639E }, { 0xE933, 0x5EEB, 0x3C43 }, { 0xA46E, 0xCC9F, 0xDEB7 },
+  { 0x69B6, 0x3504, 0x585F }, { 0x24EB, 0xA770, 0xBAAB }, { 0xF02A, 0x9FF6, 0xE576 }, { 0xBD77, 0x0D82, 0x0782 },
+  { 0x32F8, 0x1BF9, 0xDFE3 }, { 0x7FA5, 0x898D, 0x3D17 }, { 0xAB64, 0xB10B, 0x62CA }, { 0xE639, 0x237F, 0x803E },
+  { 0xACD9, 0x48AF, 0x3491 }, { 0xE184, 0xDADB, 0xD665 }, { 0x3545, 0xE25D, 0x89B8 }, { 0x7818, 0x7029, 0x6B4C },
+  { 0xF797, 0x6652, 0xB32D }, { 0xBACA, 0xF426, 0x51D9 }, { 0x6E0B, 0xCCA0, 0x0E04 }, { 0x2356, 0x5ED4, 0xECF0 },
+  { 0x8738, 0x924B, 0x3247 }, { 0xCA65, 0x003F, 0xD0B3 }, { 0x1EA4, 0x38B9, 0x8F6E }, { 0x53F9, 0xAACD, 0x6D9A },
+  { 0xDC76, 0xBCB6, 0xB5FB }, { 0x912B, 0x2EC2, 0x570F }, { 0x45EA, 0x1644, 0x08D2 }, { 0x08B7, 0x8430, 0xEA26 },
+  { 0x4257, 0xEFE0, 0x5E89 }, { 0x0F0A, 0x7D94, 0xBC7D }, { 0xDBCB, 0x4512, 0xE3A0 }, { 0x9696, 0xD766, 0x0154 },
+  { 0x1919, 0xC11D, 0xD935 }, { 0x5444, 0x5369, 0x3BC1 }, { 0x8085, 0x6BEF, 0x641C }, { 0xCDD8, 0xF99B, 0x86E8 },
+  { 0xD465, 0xB88A, 0x6F9D }, { 0x9938, 0x2AFE, 0x8D69 }, { 0x4DF9, 0x1278, 0xD2B4 }, { 0x00A4, 0x800C, 0x3040 },
+  { 0x8F2B, 0x9677, 0xE821 }, { 0xC276, 0x0403, 0x0AD5 }, { 0x16B7, 0x3C85, 0x5508 }, { 0x5BEA, 0xAEF1, 0xB7FC },
+  { 0x110A, 0xC521, 0x0353 }, { 0x5C57, 0x5755, 0xE1A7 }, { 0x8896, 0x6FD3, 0xBE7A }, { 0xC5CB, 0xFDA7, 0x5C8E },
+  { 0x4A44, 0xEBDC, 0x84EF }, { 0x0719, 0x79A8, 0x661B }, { 0xD3D8, 0x412E, 0x39C6 }, { 0x9E85, 0xD35A, 0xDB32 },
+  { 0x3AEB, 0x1FC5, 0x0585 }, { 0x77B6, 0x8DB1, 0xE771 }, { 0xA377, 0xB537, 0xB8AC }, { 0xEE2A, 0x2743, 0x5A58 },
+  { 0x61A5, 0x3138, 0x8239 }, { 0x2CF8, 0xA34C, 0x60CD }, { 0xF839, 0x9BCA, 0x3F10 }, { 0xB564, 0x09BE, 0xDDE4 },
+  { 0xFF84, 0x626E, 0x694B }, { 0xB2D9, 0xF01A, 0x8BBF }, { 0x6618, 0xC89C, 0xD462 }, { 0x2B45, 0x5AE8, 0x3696 },
+  { 0xA4CA, 0x4C93, 0xEEF7 }, { 0xE997, 0xDEE7, 0x0C03 }, { 0x3D56, 0xE661, 0x53DE }, { 0x700B, 0x7415, 0xB12A },
+  { 0xBDD3, 0x8D8E, 0x37C2 }, { 0xF08E, 0x1FFA, 0xD536 }, { 0x244F, 0x277C, 0x8AEB }, { 0x6912, 0xB508, 0x681F },
+  { 0xE69D, 0xA373, 0xB07E }, { 0xABC0, 0x3107, 0x528A }, { 0x7F01, 0x0981, 0x0D57 }, { 0x325C, 0x9BF5, 0xEFA3 },
+  { 0x78BC, 0xF025, 0x5B0C }, { 0x35E1, 0x6251, 0xB9F8 }, { 0xE120, 0x5AD7, 0xE625 }, { 0xAC7D, 0xC8A3, 0x04D1 },
+  { 0x23F2, 0xDED8, 0xDCB0 }, { 0x6EAF, 0x4CAC, 0x3E44 }, { 0xBA6E, 0x742A, 0x6199 }, { 0xF733, 0xE65E, 0x836D },
+  { 0x535D, 0x2AC1, 0x5DDA }, { 0x1E00, 0xB8B5, 0xBF2E }, { 0xCAC1, 0x8033, 0xE0F3 }, { 0x879C, 0x1247, 0x0207 },
+  { 0x0813, 0x043C, 0xDA66 }, { 0x454E, 0x9648, 0x3892 }, { 0x918F, 0xAECE, 0x674F }, { 0xDCD2, 0x3CBA, 0x85BB },
+  { 0x9632, 0x576A, 0x3114 }, { 0xDB6F, 0xC51E, 0xD3E0 }, { 0x0FAE, 0xFD98, 0x8C3D }, { 0x42F3, 0x6FEC, 0x6EC9 },
+  { 0xCD7C, 0x7997, 0xB6A8 }, { 0x8021, 0xEBE3, 0x545C }, { 0x54E0, 0xD365, 0x0B81 }, { 0x19BD, 0x4111, 0xE975 },
+  { 0xD286, 0x1067, 0x4A15 }, { 0x9FDB, 0x8213, 0xA8E1 }, { 0x4B1A, 0xBA95, 0xF73C }, { 0x0647, 0x28E1, 0x15C8 },
+  { 0x89C8, 0x3E9A, 0xCDA9 }, { 0xC495, 0xACEE, 0x2F5D }, { 0x1054, 0x9468, 0x7080 }, { 0x5D09, 0x061C, 0x9274 },
+  { 0x17E9, 0x6DCC, 0x26DB }, { 0x5AB4, 0xFFB8, 0xC42F }, { 0x8E75, 0xC73E, 0x9BF2 }, { 0xC328, 0x554A, 0x7906 },
+  { 0x4CA7, 0x4331, 0xA167 }, { 0x01FA, 0xD145, 0x4393 }, { 0xD53B, 0xE9C3, 0x1C4E }, { 0x9866, 0x7BB7, 0xFEBA },
+  { 0x3C08, 0xB728, 0x200D }, { 0x7155, 0x255C, 0xC2F9 }, { 0xA594, 0x1DDA, 0x9D24 }, { 0xE8C9, 0x8FAE, 0x7FD0 },
+  { 0x6746, 0x99D5, 0xA7B1 }, { 0x2A1B, 0x0BA1, 0x4545 }, { 0xFEDA, 0x3327, 0x1A98 }, { 0xB387, 0xA153, 0xF86C },
+  { 0xF967, 0xCA83, 0x4CC3 }, { 0xB43A, 0x58F7, 0xAE37 }, { 0x60FB, 0x6071, 0xF1EA }, { 0x2DA6, 0xF205, 0x131E },
+  { 0xA229, 0xE47E, 0xCB7F }, { 0xEF74, 0x760A, 0x298B }, { 0x3BB5, 0x4E8C, 0x7656 }, { 0x76E8, 0xDCF8, 0x94A2 },
+  { 0xBB30, 0x2563, 0x124A }, { 0xF66D, 0xB717, 0xF0BE }, { 0x22AC, 0x8F91, 0xAF63 }, { 0x6FF1, 0x1DE5, 0x4D97 },
+  { 0xE07E, 0x0B9E, 0x95F6 }, { 0xAD23, 0x99EA, 0x7702 }, { 0x79E2, 0xA16C, 0x28DF }, { 0x34BF, 0x3318, 0xCA2B },
+  { 0x7E5F, 0x58C8, 0x7E84 }, { 0x3302, 0xCABC, 0x9C70 }, { 0xE7C3, 0xF23A, 0xC3AD }, { 0xAA9E, 0x604E, 0x2159 },
+  { 0x2511, 0x7635, 0xF938 }, { 0x684C, 0xE441, 0x1BCC }, { 0xBC8D, 0xDCC7, 0x4411 }, { 0xF1D0, 0x4EB3, 0xA6E5 },
+  { 0x55BE, 0x822C, 0x7852 }, { 0x18E3, 0x1058, 0x9AA6 }, { 0xCC22, 0x28DE, 0xC57B }, { 0x817F, 0xBAAA, 0x278F },
+  { 0x0EF0, 0xACD1, 0xFFEE }, { 0x43AD, 0x3EA5, 0x1D1A }, { 0x976C, 0x0623, 0x42C7 }, { 0xDA31, 0x9457, 0xA033 },
+  { 0x90D1, 0xFF87, 0x149C }, { 0xDD8C, 0x6DF3, 0xF668 }, { 0x094D, 0x5575, 0xA9B5 }, { 0x4410, 0xC701, 0x4B41 },
+  { 0xCB9F, 0xD17A, 0x9320 }, { 0x86C2, 0x430E, 0x71D4 }, { 0x5203, 0x7B88, 0x2E09 }, { 0x1F5E, 0xE9FC, 0xCCFD },
+  { 0x06E3, 0xA8ED, 0x2588 }, { 0x4BBE, 0x3A99, 0xC77C }, { 0x9F7F, 0x021F, 0x98A1 }, { 0xD222, 0x906B, 0x7A55 },
+  { 0x5DAD, 0x8610, 0xA234 }, { 0x10F0, 0x1464, 0x40C0 }, { 0xC431, 0x2CE2, 0x1F1D }, { 0x896C, 0xBE96, 0xFDE9 },
+  { 0xC38C, 0xD546, 0x4946 }, { 0x8ED1, 0x4732, 0xABB2 }, { 0x5A10, 0x7FB4, 0xF46F }, { 0x174D, 0xEDC0, 0x169B },
+  { 0x98C2, 0xFBBB, 0xCEFA }, { 0xD59F, 0x69CF, 0x2C0E }, { 0x015E, 0x5149, 0x73D3 }, { 0x4C03, 0xC33D, 0x9127 },
+  { 0xE86D, 0x0FA2, 0x4F90 }, { 0xA530, 0x9DD6, 0xAD64 }, { 0x71F1, 0xA550, 0xF2B9 }, { 0x3CAC, 0x3724, 0x104D },
+  { 0xB323, 0x215F, 0xC82C }, { 0xFE7E, 0xB32B, 0x2AD8 }, { 0x2ABF, 0x8BAD, 0x7505 }, { 0x67E2, 0x19D9, 0x97F1 },
+  { 0x2D02, 0x7209, 0x235E }, { 0x605F, 0xE07D, 0xC1AA }, { 0xB49E, 0xD8FB, 0x9E77 }, { 0xF9C3, 0x4A8F, 0x7C83 },
+  { 0x764C, 0x5CF4, 0xA4E2 }, { 0x3B11, 0xCE80, 0x4616 }, { 0xEFD0, 0xF606, 0x19CB }, { 0xA28D, 0x6472, 0xFB3F },
+  { 0x6F55, 0x9DE9, 0x7DD7 }, { 0x2208, 0x0F9D, 0x9F23 }, { 0xF6C9, 0x371B, 0xC0FE }, { 0xBB94, 0xA56F, 0x220A },
+  { 0x341B, 0xB314, 0xFA6B }, { 0x7946, 0x2160, 0x189F }, { 0xAD87, 0x19E6, 0x4742 }, { 0xE0DA, 0x8B92, 0xA5B6 },
+  { 0xAA3A, 0xE042, 0x1119 }, { 0xE767, 0x7236, 0xF3ED }, { 0x33A6, 0x4AB0, 0xAC30 }, { 0x7EFB, 0xD8C4, 0x4EC4 },
+  { 0xF174, 0xCEBF, 0x96A5 }, { 0xBC29, 0x5CCB, 0x7451 }, { 0x68E8, 0x644D, 0x2B8C }, { 0x25B5, 0xF639, 0xC978 },
+  { 0x81DB, 0x3AA6, 0x17CF }, { 0xCC86, 0xA8D2, 0xF53B }, { 0x1847, 0x9054, 0xAAE6 }, { 0x551A, 0x0220, 0x4812 },
+  { 0xDA95, 0x145B, 0x9073 }, { 0x97C8, 0x862F, 0x7287 }, { 0x4309, 0xBEA9, 0x2D5A }, { 0x0E54, 0x2CDD, 0xCFAE },
+  { 0x44B4, 0x470D, 0x7B01 }, { 0x09E9, 0xD579, 0x99F5 }, { 0xDD28, 0xEDFF, 0xC628 }, { 0x9075, 0x7F8B, 0x24DC },
+  { 0x1FFA, 0x69F0, 0xFCBD }, { 0x52A7, 0xFB84, 0x1E49 }, { 0x8666, 0xC302, 0x4194 }, { 0xCB3B, 0x5176, 0xA360 }
+ },
+ {  // byte 5
+  { 0x0000, 0x0000, 0x0000 }, { 0x17AC, 0xE2DC, 0x464A }, { 0x2619, 0x82C0, 0x0435 }, { 0x31B5, 0x601C, 0x427F },
+  { 0xC4F6, 0xA371, 0x91AB }, { 0xD35A, 0x41AD, 0xD7E1 }, { 0xE2EF, 0x21B1, 0x959E }, { 0xF543, 0xC36D, 0xD3D4 },
+  { 0x7C64, 0x968A, 0x7F95 }, { 0x6BC8, 0x7456, 0x39DF }, { 0x5A7D, 0x144A, 0x7BA0 }, { 0x4DD1, 0xF696, 0x3DEA },
+  { 0xB892, 0x35FB, 0xEE3E }, { 0xAF3E, 0xD727, 0xA874 }, { 0x9E8B, 0xB73B, 0xEA0B }, { 0x8927, 0x55E7, 0xAC41 },
+  { 0x09D1, 0x7119, 0xC29D }, { 0x1E7D, 0x93C5, 0x84D7 }, { 0x2FC8, 0xF3D9, 0xC6A8 }, { 0x3864, 0x1105, 0x80E2 },
+  { 0xCD27, 0xD268, 0x5336 }, { 0xDA8B, 0x30B4, 0x157C }, { 0xEB3E, 0x50A8, 0x5703 }, { 0xFC92, 0xB274, 0x1149 },
+  { 0x75B5, 0xE793, 0xBD08 }, { 0x6219, 0x054F, 0xFB42 }, { 0x53AC, 0x6553, 0xB93D }, { 0x4400, 0x878F, 0xFF77 },
+  { 0xB143, 0x44E2, 0x2CA3 }, { 0xA6EF, 0xA63E, 0x6AE9 }, { 0x975A, 0xC622, 0x2896 }, { 0x80F6, 0x24FE, 0x6EDC },
+  { 0x2A8E, 0xC1B0, 0xA561 }, { 0x3D22, 0x236C, 0xE32B }, { 0x0C97, 0x4370, 0xA154 }, { 0x1B3B, 0xA1AC, 0xE71E },
+  { 0xEE78, 0x62C1, 0x34CA }, { 0xF9D4, 0x801D, 0x7280 }, { 0xC861, 0xE001, 0x30FF }, { 0xDFCD, 0x02DD, 0x76B5 },
+  { 0x56EA, 0x573A, 0xDAF4 }, { 0x4146, 0xB5E6, 0x9CBE }, { 0x70F3, 0xD5FA, 0xDEC1 }, { 0x675F, 0x3726, 0x988B },
+  { 0x921C, 0xF44B, 0x4B5F }, { 0x85B0, 0x1697, 0x0D15 }, { 0xB405, 0x768B, 0x4F6A }, { 0xA3A9, 0x9457, 0x0920 },
+  { 0x235F, 0xB0A9, 0x67FC }, { 0x34F3, 0x5275, 0x21B6 }, { 0x0546, 0x3269, 0x63C9 }, { 0x12EA, 0xD0B5, 0x2583 },
+  { 0xE7A9, 0x13D8, 0xF657 }, { 0xF005, 0xF104, 0xB01D }, { 0xC1B0, 0x9118, 0xF262 }, { 0xD61C, 0x73C4, 0xB428 },
+  { 0x5F3B, 0x2623, 0x1869 }, { 0x4897, 0xC4FF, 0x5E23 }, { 0x7922, 0xA4E3, 0x1C5C }, { 0x6E8E, 0x463F, 0x5A16 },
+  { 0x9BCD, 0x8552, 0x89C2 }, { 0x8C61, 0x678E, 0xCF88 }, { 0xBDD4, 0x0792, 0x8DF7 }, { 0xAA78, 0xE54E, 0xCBBD },
+  { 0x2129, 0xB1A7, 0xF63E }, { 0x3685, 0x537B, 0xB074 }, { 0x0730, 0x3367, 0xF20B }, { 0x109C, 0xD1BB, 0xB441 },
+  { 0xE5DF, 0x12D6, 0x6795 }, { 0xF273, 0xF00A, 0x21DF }, { 0xC3C6, 0x9016, 0x63A0 }, { 0xD46A, 0x72CA, 0x25EA },
+  { 0x5D4D, 0x272D, 0x89AB }, { 0x4AE1, 0xC5F1, 0xCFE1 }, { 0x7B54, 0xA5ED, 0x8D9E }, { 0x6CF8, 0x4731, 0xCBD4 },
+  { 0x99BB, 0x845C, 0x1800 }, { 0x8E17, 0x6680, 0x5E4A }, { 0xBFA2, 0x069C, 0x1C35 }, { 0xA80E, 0xE440, 0x5A7F },
+  { 0x28F8, 0xC0BE, 0x34A3 }, { 0x3F54, 0x2262, 0x72E9 }, { 0x0EE1, 0x427E, 0x3096 }, { 0x194D, 0xA0A2, 0x76DC },
+  { 0xEC0E, 0x63CF, 0xA508 }, { 0xFBA2, 0x8113, 0xE342 }, { 0xCA17, 0xE10F, 0xA13D }, { 0xDDBB, 0x03D3, 0xE777 },
+  { 0x549C, 0x5634, 0x4B36 }, { 0x4330, 0xB4E8, 0x0D7C }, { 0x7285, 0xD4F4, 0x4F03 }, { 0x6529, 0x3628, 0x0949 },
+  { 0x906A, 0xF545, 0xDA9D }, { 0x87C6, 0x1799, 0x9CD7 }, { 0xB673, 0x7785, 0xDEA8 }, { 0xA1DF, 0x9559, 0x98E2 },
+  { 0x0BA7, 0x7017, 0x535F }, { 0x1C0B, 0x92CB, 0x1515 }, { 0x2DBE, 0xF2D7, 0x576A }, { 0x3A12, 0x100B, 0x1120 },
+  { 0xCF51, 0xD366, 0xC2F4 }, { 0xD8FD, 0x31BA, 0x84BE }, { 0xE948, 0x51A6, 0xC6C1 }, { 0xFEE4, 0xB37A, 0x808B },
+  { 0x77C3, 0xE69D, 0x2CCA }, { 0x606F, 0x0441, 0x6A80 }, { 0x51DA, 0x645D, 0x28FF }, { 0x4676, 0x8681, 0x6EB5 },
+  { 0xB335, 0x45EC, 0xBD61 }, { 0xA499, 0xA730, 0xFB2B }, { 0x952C, 0xC72C, 0xB954 }, { 0x8280, 0x25F0, 0xFF1E },
+  { 0x0276, 0x010E, 0x91C2 }, { 0x15DA, 0xE3D2, 0xD788 }, { 0x246F, 0x83CE, 0x95F7 }, { 0x33C3, 0x6112, 0xD3BD },
+  { 0xC680, 0xA27F, 0x0069 }, { 0xD12C, 0x40A3, 0x4623 }, { 0xE099, 0x20BF, 0x045C }, { 0xF735, 0xC263, 0x4216 },
+  { 0x7E12, 0x9784, 0xEE57 }, { 0x69BE, 0x7558, 0xA81D }, { 0x580B, 0x1544, 0xEA62 }, { 0x4FA7, 0xF798, 0xAC28 },
+  { 0xBAE4, 0x34F5, 0x7FFC }, { 0xAD48, 0xD629, 0x39B6 }, { 0x9CFD, 0xB635, 0x7BC9 }, { 0x8B51, 0x54E9, 0x3D83 },
+  { 0x4B37, 0x3FC8, 0x6C0F }, { 0x5C9B, 0xDD14, 0x2A45 }, { 0x6D2E, 0xBD08, 0x683A }, { 0x7A82, 0x5FD4, 0x2E70 },
+  { 0x8FC1, 0x9CB9, 0xFDA4 }, { 0x986D, 0x7E65, 0xBBEE }, { 0xA9D8, 0x1E79, 0xF991 }, { 0xBE74, 0xFCA5, 0xBFDB },
+  { 0x3753, 0xA942, 0x139A }, { 0x20FF, 0x4B9E, 0x55D0 }, { 0x114A, 0x2B82, 0x17AF }, { 0x06E6, 0xC95E, 0x51E5 },
+  { 0xF3A5, 0x0A33, 0x8231 }, { 0xE409, 0xE8EF, 0xC47B }, { 0xD5BC, 0x88F3, 0x8604 }, { 0xC210, 0x6A2F, 0xC04E },
+  { 0x42E6, 0x4ED1, 0xAE92 }, { 0x554A, 0xAC0D, 0xE8D8 }, { 0x64FF, 0xCC11, 0xAAA7 }, { 0x7353, 0x2ECD, 0xECED },
+  { 0x8610, 0xEDA0, 0x3F39 }, { 0x91BC, 0x0F7C, 0x7973 }, { 0xA009, 0x6F60, 0x3B0C }, { 0xB7A5, 0x8DBC, 0x7D46 },
+  { 0x3E82, 0xD85B, 0xD107 }, { 0x292E, 0x3A87, 0x974D }, { 0x189B, 0x5A9B, 0xD532 }, { 0x0F37, 0xB847, 0x9378 },
+  { 0xFA74, 0x7B2A, 0x40AC }, { 0xEDD8, 0x99F6, 0x06E6 }, { 0xDC6D, 0xF9EA, 0x4499 }, { 0xCBC1, 0x1B36, 0x02D3 },
+  { 0x61B9, 0xFE78, 0xC96E }, { 0x7615, 0x1CA4, 0x8F24 }, { 0x47A0, 0x7CB8, 0xCD5B }, { 0x500C, 0x9E64, 0x8B11 },
+  { 0xA54F, 0x5D09, 0x58C5 }, { 0xB2E3, 0xBFD5, 0x1E8F }, { 0x8356, 0xDFC9, 0x5CF0 }, { 0x94FA, 0x3D15, 0x1ABA },
+  { 0x1DDD, 0x68F2, 0xB6FB }, { 0x0A71, 0x8A2E, 0xF0B1 }, { 0x3BC4, 0xEA32, 0xB2CE }, { 0x2C68, 0x08EE, 0xF484 },
+  { 0xD92B, 0xCB83, 0x2750 }, { 0xCE87, 0x295F, 0x611A }, { 0xFF32, 0x4943, 0x2365 }, { 0xE89E, 0xAB9F, 0x652F },
+  { 0x6868, 0x8F61, 0x0BF3 }, { 0x7FC4, 0x6DBD, 0x4DB9 }, { 0x4E71, 0x0DA1, 0x0FC6 }, { 0x59DD, 0xEF7D, 0x498C },
+  { 0xAC9E, 0x2C10, 0x9A58 }, { 0xBB32, 0xCECC, 0xDC12 }, { 0x8A87, 0xAED0, 0x9E6D }, { 0x9D2B, 0x4C0C, 0xD827 },
+  { 0x140C, 0x19EB, 0x7466 }, { 0x03A0, 0xFB37, 0x322C }, { 0x3215, 0x9B2B, 0x7053 }, { 0x25B9, 0x79F7, 0x3619 },
+  { 0xD0FA, 0xBA9A, 0xE5CD }, { 0xC756, 0x5846, 0xA387 }, { 0xF6E3, 0x385A, 0xE1F8 }, { 0xE14F, 0xDA86, 0xA7B2 },
+  { 0x6A1E, 0x8E6F, 0x9A31 }, { 0x7DB2, 0x6CB3, 0xDC7B }, { 0x4C07, 0x0CAF, 0x9E04 }, { 0x5BAB, 0xEE73, 0xD84E },
+  { 0xAEE8, 0x2D1E, 0x0B9A }, { 0xB944, 0xCFC2, 0x4DD0 }, { 0x88F1, 0xAFDE, 0x0FAF }, { 0x9F5D, 0x4D02, 0x49E5 },
+  { 0x167A, 0x18E5, 0xE5A4 }, { 0x01D6, 0xFA39, 0xA3EE }, { 0x3063, 0x9A25, 0xE191 }, { 0x27CF, 0x78F9, 0xA7DB },
+  { 0xD28C, 0xBB94, 0x740F }, { 0xC520, 0x5948, 0x3245 }, { 0xF495, 0x3954, 0x703A }, { 0xE339, 0xDB88, 0x3670 },
+  { 0x63CF, 0xFF76, 0x58AC }, { 0x7463, 0x1DAA, 0x1EE6 }, { 0x45D6, 0x7DB6, 0x5C99 }, { 0x527A, 0x9F6A, 0x1AD3 },
+  { 0xA739, 0x5C07, 0xC907 }, { 0xB095, 0xBEDB, 0x8F4D }, { 0x8120, 0xDEC7, 0xCD32 }, { 0x968C, 0x3C1B, 0x8B78 },
+  { 0x1FAB, 0x69FC, 0x2739 }, { 0x0807, 0x8B20, 0x6173 }, { 0x39B2, 0xEB3C, 0x230C }, { 0x2E1E, 0x09E0, 0x6546 },
+  { 0xDB5D, 0xCA8D, 0xB692 }, { 0xCCF1, 0x2851, 0xF0D8 }, { 0xFD44, 0x484D, 0xB2A7 }, { 0xEAE8, 0xAA91, 0xF4ED },
+  { 0x4090, 0x4FDF, 0x3F50 }, { 0x573C, 0xAD03, 0x791A }, { 0x6689, 0xCD1F, 0x3B65 }, { 0x7125, 0x2FC3, 0x7D2F },
+  { 0x8466, 0xECAE, 0xAEFB }, { 0x93CA, 0x0E72, 0xE8B1 }, { 0xA27F, 0x6E6E, 0xAACE }, { 0xB5D3, 0x8CB2, 0xEC84 },
+  { 0x3CF4, 0xD955, 0x40C5 }, { 0x2B58, 0x3B89, 0x068F }, { 0x1AED, 0x5B95, 0x44F0 }, { 0x0D41, 0xB949, 0x02BA },
+  { 0xF802, 0x7A24, 0xD16E }, { 0xEFAE, 0x98F8, 0x9724 }, { 0xDE1B, 0xF8E4, 0xD55B }, { 0xC9B7, 0x1A38, 0x9311 },
+  { 0x4941, 0x3EC6, 0xFDCD }, { 0x5EED, 0xDC1A, 0xBB87 }, { 0x6F58, 0xBC06, 0xF9F8 }, { 0x78F4, 0x5EDA, 0xBFB2 },
+  { 0x8DB7, 0x9DB7, 0x6C66 }, { 0x9A1B, 0x7F6B, 0x2A2C }, { 0xABAE, 0x1F77, 0x6853 }, { 0xBC02, 0xFDAB, 0x2E19 },
+  { 0x3525, 0xA84C, 0x8258 }, { 0x2289, 0x4A90, 0xC412 }, { 0x133C, 0x2A8C, 0x866D }, { 0x0490, 0xC850, 0xC027 },
+  { 0xF1D3, 0x0B3D, 0x13F3 }, { 0xE67F, 0xE9E1, 0x55B9 }, { 0xD7CA, 0x89FD, 0x17C6 }, { 0xC066, 0x6B21, 0x518C }
+ },
+ {  // byte 6
+  { 0x0000, 0x0000, 0x0000 }, { 0xBD87, 0x76FB, 0xCC6C }, { 0x6142, 0xF014, 0xD3ED }, { 0xDCC5, 0x86EF, 0x1F81 },
+  { 0x287E, 0x44BE, 0xB7B3 }, { 0x95F9, 0x3245, 0x7BDF }, { 0x493C, 0xB4AA, 0x645E }, { 0xF4BB, 0xC251, 0xA832 },
+  { 0x78B3, 0x0530, 0xA1A3 }, { 0xC534, 0x73CB, 0x6DCF }, { 0x19F1, 0xF524, 0x724E }, { 0xA476, 0x83DF, 0xBE22 },
+  { 0x50CD, 0x418E, 0x1610 }, { 0xED4A, 0x3775, 0xDA7C }, { 0x318F, 0xB19A, 0xC5FD }, { 0x8C08, 0xC761, 0x0991 },
+  { 0x2989, 0x1408, 0xC225 }, { 0x940E, 0x62F3, 0x0E49 }, { 0x48CB, 0xE41C, 0x11C8 }, { 0xF54C, 0x92E7, 0xDDA4 },
+  { 0x01F7, 0x50B6, 0x7596 }, { 0xBC70, 0x264D, 0xB9FA }, { 0x60B5, 0xA0A2, 0xA67B }, { 0xDD32, 0xD659, 0x6A17 },
+  { 0x513A, 0x1138, 0x6386 }, { 0xECBD, 0x67C3, 0xAFEA }, { 0x3078, 0xE12C, 0xB06B }, { 0x8DFF, 0x97D7, 0x7C07 },
+  { 0x7944, 0x5586, 0xD435 }, { 0xC4C3, 0x237D, 0x1859 }, { 0x1806, 0xA592, 0x07D8 }, { 0xA581, 0xD369, 0xCBB4 },
+  { 0xB250, 0x5523, 0x60D4 }, { 0x0FD7, 0x23D8, 0xACB8 }, { 0xD312, 0xA537, 0xB339 }, { 0x6E95, 0xD3CC, 0x7F55 },
+  { 0x9A2E, 0x119D, 0xD767 }, { 0x27A9, 0x6766, 0x1B0B }, { 0xFB6C, 0xE189, 0x048A }, { 0x46EB, 0x9772, 0xC8E6 },
+  { 0xCAE3, 0x5013, 0xC177 }, { 0x7764, 0x26E8, 0x0D1B }, { 0xABA1, 0xA007, 0x129A }, { 0x1626, 0xD6FC, 0xDEF6 },
+  { 0xE29D, 0x14AD, 0x76C4 }, { 0x5F1A, 0x6256, 0xBAA8 }, { 0x83DF, 0xE4B9, 0xA529 }, { 0x3E58, 0x9242, 0x6945 },
+  { 0x9BD9, 0x412B, 0xA2F1 }, { 0x265E, 0x37D0, 0x6E9D }, { 0xFA9B, 0xB13F, 0x711C }, { 0x471C, 0xC7C4, 0xBD70 },
+  { 0xB3A7, 0x0595, 0x1542 }, { 0x0E20, 0x736E, 0xD92E }, { 0xD2E5, 0xF581, 0xC6AF }, { 0x6F62, 0x837A, 0x0AC3 },
+  { 0xE36A, 0x441B, 0x0352 }, { 0x5EED, 0x32E0, 0xCF3E }, { 0x8228, 0xB40F, 0xD0BF }, { 0x3FAF, 0xC2F4, 0x1CD3 },
+  { 0xCB14, 0x00A5, 0xB4E1 }, { 0x7693, 0x765E, 0x788D }, { 0xAA56, 0xF0B1, 0x670C }, { 0x17D1, 0x864A, 0xAB60 },
+  { 0xFD33, 0x83E2, 0x2711 }, { 0x40B4, 0xF519, 0xEB7D }, { 0x9C71, 0x73F6, 0xF4FC }, { 0x21F6, 0x050D, 0x3890 },
+  { 0xD54D, 0xC75C, 0x90A2 }, { 0x68CA, 0xB1A7, 0x5CCE }, { 0xB40F, 0x3748, 0x434F }, { 0x0988, 0x41B3, 0x8F23 },
+  { 0x8580, 0x86D2, 0x86B2 }, { 0x3807, 0xF029, 0x4ADE }, { 0xE4C2, 0x76C6, 0x555F }, { 0x5945, 0x003D, 0x9933 },
+  { 0xADFE, 0xC26C, 0x3101 }, { 0x1079, 0xB497, 0xFD6D }, { 0xCCBC, 0x3278, 0xE2EC }, { 0x713B, 0x4483, 0x2E80 },
+  { 0xD4BA, 0x97EA, 0xE534 }, { 0x693D, 0xE111, 0x2958 }, { 0xB5F8, 0x67FE, 0x36D9 }, { 0x087F, 0x1105, 0xFAB5 },
+  { 0xFCC4, 0xD354, 0x5287 }, { 0x4143, 0xA5AF, 0x9EEB }, { 0x9D86, 0x2340, 0x816A }, { 0x2001, 0x55BB, 0x4D06 },
+  { 0xAC09, 0x92DA, 0x4497 }, { 0x118E, 0xE421, 0x88FB }, { 0xCD4B, 0x62CE, 0x977A }, { 0x70CC, 0x1435, 0x5B16 },
+  { 0x8477, 0xD664, 0xF324 }, { 0x39F0, 0xA09F, 0x3F48 }, { 0xE535, 0x2670, 0x20C9 }, { 0x58B2, 0x508B, 0xECA5 },
+  { 0x4F63, 0xD6C1, 0x47C5 }, { 0xF2E4, 0xA03A, 0x8BA9 }, { 0x2E21, 0x26D5, 0x9428 }, { 0x93A6, 0x502E, 0x5844 },
+  { 0x671D, 0x927F, 0xF076 }, { 0xDA9A, 0xE484, 0x3C1A }, { 0x065F, 0x626B, 0x239B }, { 0xBBD8, 0x1490, 0xEFF7 },
+  { 0x37D0, 0xD3F1, 0xE666 }, { 0x8A57, 0xA50A, 0x2A0A }, { 0x5692, 0x23E5, 0x358B }, { 0xEB15, 0x551E, 0xF9E7 },
+  { 0x1FAE, 0x974F, 0x51D5 }, { 0xA229, 0xE1B4, 0x9DB9 }, { 0x7EEC, 0x675B, 0x8238 }, { 0xC36B, 0x11A0, 0x4E54 },
+  { 0x66EA, 0xC2C9, 0x85E0 }, { 0xDB6D, 0xB432, 0x498C }, { 0x07A8, 0x32DD, 0x560D }, { 0xBA2F, 0x4426, 0x9A61 },
+  { 0x4E94, 0x8677, 0x3253 }, { 0xF313, 0xF08C, 0xFE3F }, { 0x2FD6, 0x7663, 0xE1BE }, { 0x9251, 0x0098, 0x2DD2 },
+  { 0x1E59, 0xC7F9, 0x2443 }, { 0xA3DE, 0xB102, 0xE82F }, { 0x7F1B, 0x37ED, 0xF7AE }, { 0xC29C, 0x4116, 0x3BC2 },
+  { 0x3627, 0x8347, 0x93F0 }, { 0x8BA0, 0xF5BC, 0x5F9C }, { 0x5765, 0x7353, 0x401D }, { 0xEAE2, 0x05A8, 0x8C71 },
+  { 0x74CC, 0x7B45, 0x5B8D }, { 0xC94B, 0x0DBE, 0x97E1 }, { 0x158E, 0x8B51, 0x8860 }, { 0xA809, 0xFDAA, 0x440C },
+  { 0x5CB2, 0x3FFB, 0xEC3E }, { 0xE135, 0x4900, 0x2052 }, { 0x3DF0, 0xCFEF, 0x3FD3 }, { 0x8077, 0xB914, 0xF3BF },
+  { 0x0C7F, 0x7E75, 0xFA2E }, { 0xB1F8, 0x088E, 0x3642 }, { 0x6D3D, 0x8E61, 0x29C3 }, { 0xD0BA, 0xF89A, 0xE5AF },
+  { 0x2401, 0x3ACB, 0x4D9D }, { 0x9986, 0x4C30, 0x81F1 }, { 0x4543, 0xCADF, 0x9E70 }, { 0xF8C4, 0xBC24, 0x521C },
+  { 0x5D45, 0x6F4D, 0x99A8 }, { 0xE0C2, 0x19B6, 0x55C4 }, { 0x3C07, 0x9F59, 0x4A45 }, { 0x8180, 0xE9A2, 0x8629 },
+  { 0x753B, 0x2BF3, 0x2E1B }, { 0xC8BC, 0x5D08, 0xE277 }, { 0x1479, 0xDBE7, 0xFDF6 }, { 0xA9FE, 0xAD1C, 0x319A },
+  { 0x25F6, 0x6A7D, 0x380B }, { 0x9871, 0x1C86, 0xF467 }, { 0x44B4, 0x9A69, 0xEBE6 }, { 0xF933, 0xEC92, 0x278A },
+  { 0x0D88, 0x2EC3, 0x8FB8 }, { 0xB00F, 0x5838, 0x43D4 }, { 0x6CCA, 0xDED7, 0x5C55 }, { 0xD14D, 0xA82C, 0x9039 },
+  { 0xC69C, 0x2E66, 0x3B59 }, { 0x7B1B, 0x589D, 0xF735 }, { 0xA7DE, 0xDE72, 0xE8B4 }, { 0x1A59, 0xA889, 0x24D8 },
+  { 0xEEE2, 0x6AD8, 0x8CEA }, { 0x5365, 0x1C23, 0x4086 }, { 0x8FA0, 0x9ACC, 0x5F07 }, { 0x3227, 0xEC37, 0x936B },
+  { 0xBE2F, 0x2B56, 0x9AFA }, { 0x03A8, 0x5DAD, 0x5696 }, { 0xDF6D, 0xDB42, 0x4917 }, { 0x62EA, 0xADB9, 0x857B },
+  { 0x9651, 0x6FE8, 0x2D49 }, { 0x2BD6, 0x1913, 0xE125 }, { 0xF713, 0x9FFC, 0xFEA4 }, { 0x4A94, 0xE907, 0x32C8 },
+  { 0xEF15, 0x3A6E, 0xF97C }, { 0x5292, 0x4C95, 0x3510 }, { 0x8E57, 0xCA7A, 0x2A91 }, { 0x33D0, 0xBC81, 0xE6FD },
+  { 0xC76B, 0x7ED0, 0x4ECF }, { 0x7AEC, 0x082B, 0x82A3 }, { 0xA629, 0x8EC4, 0x9D22 }, { 0x1BAE, 0xF83F, 0x514E },
+  { 0x97A6, 0x3F5E, 0x58DF }, { 0x2A21, 0x49A5, 0x94B3 }, { 0xF6E4, 0xCF4A, 0x8B32 }, { 0x4B63, 0xB9B1, 0x475E },
+  { 0xBFD8, 0x7BE0, 0xEF6C }, { 0x025F, 0x0D1B, 0x2300 }, { 0xDE9A, 0x8BF4, 0x3C81 }, { 0x631D, 0xFD0F, 0xF0ED },
+  { 0x89FF, 0xF8A7, 0x7C9C }, { 0x3478, 0x8E5C, 0xB0F0 }, { 0xE8BD, 0x08B3, 0xAF71 }, { 0x553A, 0x7E48, 0x631D },
+  { 0xA181, 0xBC19, 0xCB2F }, { 0x1C06, 0xCAE2, 0x0743 }, { 0xC0C3, 0x4C0D, 0x18C2 }, { 0x7D44, 0x3AF6, 0xD4AE },
+  { 0xF14C, 0xFD97, 0xDD3F }, { 0x4CCB, 0x8B6C, 0x1153 }, { 0x900E, 0x0D83, 0x0ED2 }, { 0x2D89, 0x7B78, 0xC2BE },
+  { 0xD932, 0xB929, 0x6A8C }, { 0x64B5, 0xCFD2, 0xA6E0 }, { 0xB870, 0x493D, 0xB961 }, { 0x05F7, 0x3FC6, 0x750D },
+  { 0xA076, 0xECAF, 0xBEB9 }, { 0x1DF1, 0x9A54, 0x72D5 }, { 0xC134, 0x1CBB, 0x6D54 }, { 0x7CB3, 0x6A40, 0xA138 },
+  { 0x8808, 0xA811, 0x090A }, { 0x358F, 0xDEEA, 0xC566 }, { 0xE94A, 0x5805, 0xDAE7 }, { 0x54CD, 0x2EFE, 0x168B },
+  { 0xD8C5, 0xE99F, 0x1F1A }, { 0x6542, 0x9F64, 0xD376 }, { 0xB987, 0x198B, 0xCCF7 }, { 0x0400, 0x6F70, 0x009B },
+  { 0xF0BB, 0xAD21, 0xA8A9 }, { 0x4D3C, 0xDBDA, 0x64C5 }, { 0x91F9, 0x5D35, 0x7B44 }, { 0x2C7E, 0x2BCE, 0xB728 },
+  { 0x3BAF, 0xAD84, 0x1C48 }, { 0x8628, 0xDB7F, 0xD024 }, { 0x5AED, 0x5D90, 0xCFA5 }, { 0xE76A, 0x2B6B, 0x03C9 },
+  { 0x13D1, 0xE93A, 0xABFB }, { 0xAE56, 0x9FC1, 0x6797 }, { 0x7293, 0x192E, 0x7816 }, { 0xCF14, 0x6FD5, 0xB47A },
+  { 0x431C, 0xA8B4, 0xBDEB }, { 0xFE9B, 0xDE4F, 0x7187 }, { 0x225E, 0x58A0, 0x6E06 }, { 0x9FD9, 0x2E5B, 0xA26A },
+  { 0x6B62, 0xEC0A, 0x0A58 }, { 0xD6E5, 0x9AF1, 0xC634 }, { 0x0A20, 0x1C1E, 0xD9B5 }, { 0xB7A7, 0x6AE5, 0x15D9 },
+  { 0x1226, 0xB98C, 0xDE6D }, { 0xAFA1, 0xCF77, 0x1201 }, { 0x7364, 0x4998, 0x0D80 }, { 0xCEE3, 0x3F63, 0xC1EC },
+  { 0x3A58, 0xFD32, 0x69DE }, { 0x87DF, 0x8BC9, 0xA5B2 }, { 0x5B1A, 0x0D26, 0xBA33 }, { 0xE69D, 0x7BDD, 0x765F },
+  { 0x6A95, 0xBCBC, 0x7FCE }, { 0xD712, 0xCA47, 0xB3A2 }, { 0x0BD7, 0x4CA8, 0xAC23 }, { 0xB650, 0x3A53, 0x604F },
+  { 0x42EB, 0xF802, 0xC87D }, { 0xFF6C, 0x8EF9, 0x0411 }, { 0x23A9, 0x0816, 0x1B90 }, { 0x9E2E, 0x7EED, 0xD7FC }
+ },
+ {  // byte 7
+  { 0x0000, 0x0000, 0x0000 }, { 0x0715, 0x9C89, 0x6D44 }, { 0xDEB4, 0x581A, 0xF067 }, { 0xD9A1, 0xC493, 0x9D23 },
+  { 0x017A, 0x5AF5, 0xE3E6 }, { 0x066F, 0xC67C, 0x8EA2 }, { 0xDFCE, 0x02EF, 0x1381 }, { 0xD8DB, 0x9E66, 0x7EC5 },
+  { 0x7E3E, 0xF7D8, 0xCE3D }, { 0x792B, 0x6B51, 0xA379 }, { 0xA08A, 0xAFC2, 0x3E5A }, { 0xA79F, 0x334B, 0x531E },
+  { 0x7F44, 0xAD2D, 0x2DDB }, { 0x7851, 0x31A4, 0x409F }, { 0xA1F0, 0xF537, 0xDDBC }, { 0xA6E5, 0x69BE, 0xB0F8 },
+  { 0x6C75, 0x0971, 0x80B3 }, { 0x6B60, 0x95F8, 0xEDF7 }, { 0xB2C1, 0x516B, 0x70D4 }, { 0xB5D4, 0xCDE2, 0x1D90 },
+  { 0x6D0F, 0x5384, 0x6355 }, { 0x6A1A, 0xCF0D, 0x0E11 }, { 0xB3BB, 0x0B9E, 0x9332 }, { 0xB4AE, 0x9717, 0xFE76 },
+  { 0x124B, 0xFEA9, 0x4E8E }, { 0x155E, 0x6220, 0x23CA }, { 0xCCFF, 0xA6B3, 0xBEE9 }, { 0xCBEA, 0x3A3A, 0xD3AD },
+  { 0x1331, 0xA45C, 0xAD68 }, { 0x1424, 0x38D5, 0xC02C }, { 0xCD85, 0xFC46, 0x5D0F }, { 0xCA90, 0x60CF, 0x304B },
+  { 0x4B9C, 0xDA4C, 0x7B45 }, { 0x4C89, 0x46C5, 0x1601 }, { 0x9528, 0x8256, 0x8B22 }, { 0x923D, 0x1EDF, 0xE666 },
+  { 0x4AE6, 0x80B9, 0x98A3 }, { 0x4DF3, 0x1C30, 0xF5E7 }, { 0x9452, 0xD8A3, 0x68C4 }, { 0x9347, 0x442A, 0x0580 },
+  { 0x35A2, 0x2D94, 0xB578 }, { 0x32B7, 0xB11D, 0xD83C }, { 0xEB16, 0x758E, 0x451F }, { 0xEC03, 0xE907, 0x285B },
+  { 0x34D8, 0x7761, 0x569E }, { 0x33CD, 0xEBE8, 0x3BDA }, { 0xEA6C, 0x2F7B, 0xA6F9 }, { 0xED79, 0xB3F2, 0xCBBD },
+  { 0x27E9, 0xD33D, 0xFBF6 }, { 0x20FC, 0x4FB4, 0x96B2 }, { 0xF95D, 0x8B27, 0x0B91 }, { 0xFE48, 0x17AE, 0x66D5 },
+  { 0x2693, 0x89C8, 0x1810 }, { 0x2186, 0x1541, 0x7554 }, { 0xF827, 0xD1D2, 0xE877 }, { 0xFF32, 0x4D5B, 0x8533 },
+  { 0x59D7, 0x24E5, 0x35CB }, { 0x5EC2, 0xB86C, 0x588F }, { 0x8763, 0x7CFF, 0xC5AC }, { 0x8076, 0xE076, 0xA8E8 },
+  { 0x58AD, 0x7E10, 0xD62D }, { 0x5FB8, 0xE299, 0xBB69 }, { 0x8619, 0x260A, 0x264A }, { 0x810C, 0xBA83, 0x4B0E },
+  { 0xEA12, 0x6576, 0xBA79 }, { 0xED07, 0xF9FF, 0xD73D }, { 0x34A6, 0x3D6C, 0x4A1E }, { 0x33B3, 0xA1E5, 0x275A },
+  { 0xEB68, 0x3F83, 0x599F }, { 0xEC7D, 0xA30A, 0x34DB }, { 0x35DC, 0x6799, 0xA9F8 }, { 0x32C9, 0xFB10, 0xC4BC },
+  { 0x942C, 0x92AE, 0x7444 }, { 0x9339, 0x0E27, 0x1900 }, { 0x4A98, 0xCAB4, 0x8423 }, { 0x4D8D, 0x563D, 0xE967 },
+  { 0x9556, 0xC85B, 0x97A2 }, { 0x9243, 0x54D2, 0xFAE6 }, { 0x4BE2, 0x9041, 0x67C5 }, { 0x4CF7, 0x0CC8, 0x0A81 },
+  { 0x8667, 0x6C07, 0x3ACA }, { 0x8172, 0xF08E, 0x578E }, { 0x58D3, 0x341D, 0xCAAD }, { 0x5FC6, 0xA894, 0xA7E9 },
+  { 0x871D, 0x36F2, 0xD92C }, { 0x8008, 0xAA7B, 0xB468 }, { 0x59A9, 0x6EE8, 0x294B }, { 0x5EBC, 0xF261, 0x440F },
+  { 0xF859, 0x9BDF, 0xF4F7 }, { 0xFF4C, 0x0756, 0x99B3 }, { 0x26ED, 0xC3C5, 0x0490 }, { 0x21F8, 0x5F4C, 0x69D4 },
+  { 0xF923, 0xC12A, 0x1711 }, { 0xFE36, 0x5DA3, 0x7A55 }, { 0x2797, 0x9930, 0xE776 }, { 0x2082, 0x05B9, 0x8A32 },
+  { 0xA18E, 0xBF3A, 0xC13C }, { 0xA69B, 0x23B3, 0xAC78 }, { 0x7F3A, 0xE720, 0x315B }, { 0x782F, 0x7BA9, 0x5C1F },
+  { 0xA0F4, 0xE5CF, 0x22DA }, { 0xA7E1, 0x7946, 0x4F9E }, { 0x7E40, 0xBDD5, 0xD2BD }, { 0x7955, 0x215C, 0xBFF9 },
+  { 0xDFB0, 0x48E2, 0x0F01 }, { 0xD8A5, 0xD46B, 0x6245 }, { 0x0104, 0x10F8, 0xFF66 }, { 0x0611, 0x8C71, 0x9222 },
+  { 0xDECA, 0x1217, 0xECE7 }, { 0xD9DF, 0x8E9E, 0x81A3 }, { 0x007E, 0x4A0D, 0x1C80 }, { 0x076B, 0xD684, 0x71C4 },
+  { 0xCDFB, 0xB64B, 0x418F }, { 0xCAEE, 0x2AC2, 0x2CCB }, { 0x134F, 0xEE51, 0xB1E8 }, { 0x145A, 0x72D8, 0xDCAC },
+  { 0xCC81, 0xECBE, 0xA269 }, { 0xCB94, 0x7037, 0xCF2D }, { 0x1235, 0xB4A4, 0x520E }, { 0x1520, 0x282D, 0x3F4A },
+  { 0xB3C5, 0x4193, 0x8FB2 }, { 0xB4D0, 0xDD1A, 0xE2F6 }, { 0x6D71, 0x1989, 0x7FD5 }, { 0x6A64, 0x8500, 0x1291 },
+  { 0xB2BF, 0x1B66, 0x6C54 }, { 0xB5AA, 0x87EF, 0x0110 }, { 0x6C0B, 0x437C, 0x9C33 }, { 0x6B1E, 0xDFF5, 0xF177 },
+  { 0x7F63, 0x43E0, 0x2C93 }, { 0x7876, 0xDF69, 0x41D7 }, { 0xA1D7, 0x1BFA, 0xDCF4 }, { 0xA6C2, 0x8773, 0xB1B0 },
+  { 0x7E19, 0x1915, 0xCF75 }, { 0x790C, 0x859C, 0xA231 }, { 0xA0AD, 0x410F, 0x3F12 }, { 0xA7B8, 0xDD86, 0x5256 },
+  { 0x015D, 0xB438, 0xE2AE }, { 0x0648, 0x28B1, 0x8FEA }, { 0xDFE9, 0xEC22, 0x12C9 }, { 0xD8FC, 0x70AB, 0x7F8D },
+  { 0x0027, 0xEECD, 0x0148 }, { 0x0732, 0x7244, 0x6C0C }, { 0xDE93, 0xB6D7, 0xF12F }, { 0xD986, 0x2A5E, 0x9C6B },
+  { 0x1316, 0x4A91, 0xAC20 }, { 0x1403, 0xD618, 0xC164 }, { 0xCDA2, 0x128B, 0x5C47 }, { 0xCAB7, 0x8E02, 0x3103 },
+  { 0x126C, 0x1064, 0x4FC6 }, { 0x1579, 0x8CED, 0x2282 }, { 0xCCD8, 0x487E, 0xBFA1 }, { 0xCBCD, 0xD4F7, 0xD2E5 },
+  { 0x6D28, 0xBD49, 0x621D }, { 0x6A3D, 0x21C0, 0x0F59 }, { 0xB39C, 0xE553, 0x927A }, { 0xB489, 0x79DA, 0xFF3E },
+  { 0x6C52, 0xE7BC, 0x81FB }, { 0x6B47, 0x7B35, 0xECBF }, { 0xB2E6, 0xBFA6, 0x719C }, { 0xB5F3, 0x232F, 0x1CD8 },
+  { 0x34FF, 0x99AC, 0x57D6 }, { 0x33EA, 0x0525, 0x3A92 }, { 0xEA4B, 0xC1B6, 0xA7B1 }, { 0xED5E, 0x5D3F, 0xCAF5 },
+  { 0x3585, 0xC359, 0xB430 }, { 0x3290, 0x5FD0, 0xD974 }, { 0xEB31, 0x9B43, 0x4457 }, { 0xEC24, 0x07CA, 0x2913 },
+  { 0x4AC1, 0x6E74, 0x99EB }, { 0x4DD4, 0xF2FD, 0xF4AF }, { 0x9475, 0x366E, 0x698C }, { 0x9360, 0xAAE7, 0x04C8 },
+  { 0x4BBB, 0x3481, 0x7A0D }, { 0x4CAE, 0xA808, 0x1749 }, { 0x950F, 0x6C9B, 0x8A6A }, { 0x921A, 0xF012, 0xE72E },
+  { 0x588A, 0x90DD, 0xD765 }, { 0x5F9F, 0x0C54, 0xBA21 }, { 0x863E, 0xC8C7, 0x2702 }, { 0x812B, 0x544E, 0x4A46 },
+  { 0x59F0, 0xCA28, 0x3483 }, { 0x5EE5, 0x56A1, 0x59C7 }, { 0x8744, 0x9232, 0xC4E4 }, { 0x8051, 0x0EBB, 0xA9A0 },
+  { 0x26B4, 0x6705, 0x1958 }, { 0x21A1, 0xFB8C, 0x741C }, { 0xF800, 0x3F1F, 0xE93F }, { 0xFF15, 0xA396, 0x847B },
+  { 0x27CE, 0x3DF0, 0xFABE }, { 0x20DB, 0xA179, 0x97FA }, { 0xF97A, 0x65EA, 0x0AD9 }, { 0xFE6F, 0xF963, 0x679D },
+  { 0x9571, 0x2696, 0x96EA }, { 0x9264, 0xBA1F, 0xFBAE }, { 0x4BC5, 0x7E8C, 0x668D }, { 0x4CD0, 0xE205, 0x0BC9 },
+  { 0x940B, 0x7C63, 0x750C }, { 0x931E, 0xE0EA, 0x1848 }, { 0x4ABF, 0x2479, 0x856B }, { 0x4DAA, 0xB8F0, 0xE82F },
+  { 0xEB4F, 0xD14E, 0x58D7 }, { 0xEC5A, 0x4DC7, 0x3593 }, { 0x35FB, 0x8954, 0xA8B0 }, { 0x32EE, 0x15DD, 0xC5F4 },
+  { 0xEA35, 0x8BBB, 0xBB31 }, { 0xED20, 0x1732, 0xD675 }, { 0x3481, 0xD3A1, 0x4B56 }, { 0x3394, 0x4F28, 0x2612 },
+  { 0xF904, 0x2FE7, 0x1659 }, { 0xFE11, 0xB36E, 0x7B1D }, { 0x27B0, 0x77FD, 0xE63E }, { 0x20A5, 0xEB74, 0x8B7A },
+  { 0xF87E, 0x7512, 0xF5BF }, { 0xFF6B, 0xE99B, 0x98FB }, { 0x26CA, 0x2D08, 0x05D8 }, { 0x21DF, 0xB181, 0x689C },
+  { 0x873A, 0xD83F, 0xD864 }, { 0x802F, 0x44B6, 0xB520 }, { 0x598E, 0x8025, 0x2803 }, { 0x5E9B, 0x1CAC, 0x4547 },
+  { 0x8640, 0x82CA, 0x3B82 }, { 0x8155, 0x1E43, 0x56C6 }, { 0x58F4, 0xDAD0, 0xCBE5 }, { 0x5FE1, 0x4659, 0xA6A1 },
+  { 0xDEED, 0xFCDA, 0xEDAF }, { 0xD9F8, 0x6053, 0x80EB }, { 0x0059, 0xA4C0, 0x1DC8 }, { 0x074C, 0x3849, 0x708C },
+  { 0xDF97, 0xA62F, 0x0E49 }, { 0xD882, 0x3AA6, 0x630D }, { 0x0123, 0xFE35, 0xFE2E }, { 0x0636, 0x62BC, 0x936A },
+  { 0xA0D3, 0x0B02, 0x2392 }, { 0xA7C6, 0x978B, 0x4ED6 }, { 0x7E67, 0x5318, 0xD3F5 }, { 0x7972, 0xCF91, 0xBEB1 },
+  { 0xA1A9, 0x51F7, 0xC074 }, { 0xA6BC, 0xCD7E, 0xAD30 }, { 0x7F1D, 0x09ED, 0x3013 }, { 0x7808, 0x9564, 0x5D57 },
+  { 0xB298, 0xF5AB, 0x6D1C }, { 0xB58D, 0x6922, 0x0058 }, { 0x6C2C, 0xADB1, 0x9D7B }, { 0x6B39, 0x3138, 0xF03F },
+  { 0xB3E2, 0xAF5E, 0x8EFA }, { 0xB4F7, 0x33D7, 0xE3BE }, { 0x6D56, 0xF744, 0x7E9D }, { 0x6A43, 0x6BCD, 0x13D9 },
+  { 0xCCA6, 0x0273, 0xA321 }, { 0xCBB3, 0x9EFA, 0xCE65 }, { 0x1212, 0x5A69, 0x5346 }, { 0x1507, 0xC6E0, 0x3E02 },
+  { 0xCDDC, 0x5886, 0x40C7 }, { 0xCAC9, 0xC40F, 0x2D83 }, { 0x1368, 0x009C, 0xB0A0 }, { 0x147D, 0x9C15, 0xDDE4 }
+ },
+ {  // byte 8
+  { 0x0000, 0x0000, 0x0000 }, { 0x62C1, 0x2EED, 0x2489 }, { 0x7BAD, 0x21F0, 0xAD33 }, { 0x196C, 0x0F1D, 0x89BA },
+  { 0xC034, 0x0100, 0x0002 }, { 0xA2F5, 0x2FED, 0x248B }, { 0xBB99, 0x20F0, 0xAD31 }, { 0xD958, 0x0E1D, 0x89B8 },
+  { 0x183D, 0x7105, 0xFB3F }, { 0x7AFC, 0x5FE8, 0xDFB6 }, { 0x6390, 0x50F5, 0x560C }, { 0x0151, 0x7E18, 0x7285 },
+  { 0xD809, 0x7005, 0xFB3D }, { 0xBAC8, 0x5EE8, 0xDFB4 }, { 0xA3A4, 0x51F5, 0x560E }, { 0xC165, 0x7F18, 0x7287 },
+  { 0xE142, 0x5AB6, 0xC7A4 }, { 0x8383, 0x745B, 0xE32D }, { 0x9AEF, 0x7B46, 0x6A97 }, { 0xF82E, 0x55AB, 0x4E1E },
+  { 0x2176, 0x5BB6, 0xC7A6 }, { 0x43B7, 0x755B, 0xE32F }, { 0x5ADB, 0x7A46, 0x6A95 }, { 0x381A, 0x54AB, 0x4E1C },
+  { 0xF97F, 0x2BB3, 0x3C9B }, { 0x9BBE, 0x055E, 0x1812 }, { 0x82D2, 0x0A43, 0x91A8 }, { 0xE013, 0x24AE, 0xB521 },
+  { 0x394B, 0x2AB3, 0x3C99 }, { 0x5B8A, 0x045E, 0x1810 }, { 0x42E6, 0x0B43, 0x91AA }, { 0x2027, 0x25AE, 0xB523 },
+  { 0x6785, 0xDDB4, 0x6744 }, { 0x0544, 0xF359, 0x43CD }, { 0x1C28, 0xFC44, 0xCA77 }, { 0x7EE9, 0xD2A9, 0xEEFE },
+  { 0xA7B1, 0xDCB4, 0x6746 }, { 0xC570, 0xF259, 0x43CF }, { 0xDC1C, 0xFD44, 0xCA75 }, { 0xBEDD, 0xD3A9, 0xEEFC },
+  { 0x7FB8, 0xACB1, 0x9C7B }, { 0x1D79, 0x825C, 0xB8F2 }, { 0x0415, 0x8D41, 0x3148 }, { 0x66D4, 0xA3AC, 0x15C1 },
+  { 0xBF8C, 0xADB1, 0x9C79 }, { 0xDD4D, 0x835C, 0xB8F0 }, { 0xC421, 0x8C41, 0x314A }, { 0xA6E0, 0xA2AC, 0x15C3 },
+  { 0x86C7, 0x8702, 0xA0E0 }, { 0xE406, 0xA9EF, 0x8469 }, { 0xFD6A, 0xA6F2, 0x0DD3 }, { 0x9FAB, 0x881F, 0x295A },
+  { 0x46F3, 0x8602, 0xA0E2 }, { 0x2432, 0xA8EF, 0x846B }, { 0x3D5E, 0xA7F2, 0x0DD1 }, { 0x5F9F, 0x891F, 0x2958 },
+  { 0x9EFA, 0xF607, 0x5BDF }, { 0xFC3B, 0xD8EA, 0x7F56 }, { 0xE557, 0xD7F7, 0xF6EC }, { 0x8796, 0xF91A, 0xD265 },
+  { 0x5ECE, 0xF707, 0x5BDD }, { 0x3C0F, 0xD9EA, 0x7F54 }, { 0x2563, 0xD6F7, 0xF6EE }, { 0x47A2, 0xF81A, 0xD267 },
+  { 0xBD8B, 0xAD9A, 0x8C28 }, { 0xDF4A, 0x8377, 0xA8A1 }, { 0xC626, 0x8C6A, 0x211B }, { 0xA4E7, 0xA287, 0x0592 },
+  { 0x7DBF, 0xAC9A, 0x8C2A }, { 0x1F7E, 0x8277, 0xA8A3 }, { 0x0612, 0x8D6A, 0x2119 }, { 0x64D3, 0xA387, 0x0590 },
+  { 0xA5B6, 0xDC9F, 0x7717 }, { 0xC777, 0xF272, 0x539E }, { 0xDE1B, 0xFD6F, 0xDA24 }, { 0xBCDA, 0xD382, 0xFEAD },
+  { 0x6582, 0xDD9F, 0x7715 }, { 0x0743, 0xF372, 0x539C }, { 0x1E2F, 0xFC6F, 0xDA26 }, { 0x7CEE, 0xD282, 0xFEAF },
+  { 0x5CC9, 0xF72C, 0x4B8C }, { 0x3E08, 0xD9C1, 0x6F05 }, { 0x2764, 0xD6DC, 0xE6BF }, { 0x45A5, 0xF831, 0xC236 },
+  { 0x9CFD, 0xF62C, 0x4B8E }, { 0xFE3C, 0xD8C1, 0x6F07 }, { 0xE750, 0xD7DC, 0xE6BD }, { 0x8591, 0xF931, 0xC234 },
+  { 0x44F4, 0x8629, 0xB0B3 }, { 0x2635, 0xA8C4, 0x943A }, { 0x3F59, 0xA7D9, 0x1D80 }, { 0x5D98, 0x8934, 0x3909 },
+  { 0x84C0, 0x8729, 0xB0B1 }, { 0xE601, 0xA9C4, 0x9438 }, { 0xFF6D, 0xA6D9, 0x1D82 }, { 0x9DAC, 0x8834, 0x390B },
+  { 0xDA0E, 0x702E, 0xEB6C }, { 0xB8CF, 0x5EC3, 0xCFE5 }, { 0xA1A3, 0x51DE, 0x465F }, { 0xC362, 0x7F33, 0x62D6 },
+  { 0x1A3A, 0x712E, 0xEB6E }, { 0x78FB, 0x5FC3, 0xCFE7 }, { 0x6197, 0x50DE, 0x465D }, { 0x0356, 0x7E33, 0x62D4 },
+  { 0xC233, 0x012B, 0x1053 }, { 0xA0F2, 0x2FC6, 0x34DA }, { 0xB99E, 0x20DB, 0xBD60 }, { 0xDB5F, 0x0E36, 0x99E9 },
+  { 0x0207, 0x002B, 0x1051 }, { 0x60C6, 0x2EC6, 0x34D8 }, { 0x79AA, 0x21DB, 0xBD62 }, { 0x1B6B, 0x0F36, 0x99EB },
+  { 0x3B4C, 0x2A98, 0x2CC8 }, { 0x598D, 0x0475, 0x0841 }, { 0x40E1, 0x0B68, 0x81FB }, { 0x2220, 0x2585, 0xA572 },
+  { 0xFB78, 0x2B98, 0x2CCA }, { 0x99B9, 0x0575, 0x0843 }, { 0x80D5, 0x0A68, 0x81F9 }, { 0xE214, 0x2485, 0xA570 },
+  { 0x2371, 0x5B9D, 0xD7F7 }, { 0x41B0, 0x7570, 0xF37E }, { 0x58DC, 0x7A6D, 0x7AC4 }, { 0x3A1D, 0x5480, 0x5E4D },
+  { 0xE345, 0x5A9D, 0xD7F5 }, { 0x8184, 0x7470, 0xF37C }, { 0x98E8, 0x7B6D, 0x7AC6 }, { 0xFA29, 0x5580, 0x5E4F },
+  { 0x7F82, 0x09ED, 0x3701 }, { 0x1D43, 0x2700, 0x1388 }, { 0x042F, 0x281D, 0x9A32 }, { 0x66EE, 0x06F0, 0xBEBB },
+  { 0xBFB6, 0x08ED, 0x3703 }, { 0xDD77, 0x2600, 0x138A }, { 0xC41B, 0x291D, 0x9A30 }, { 0xA6DA, 0x07F0, 0xBEB9 },
+  { 0x67BF, 0x78E8, 0xCC3E }, { 0x057E, 0x5605, 0xE8B7 }, { 0x1C12, 0x5918, 0x610D }, { 0x7ED3, 0x77F5, 0x4584 },
+  { 0xA78B, 0x79E8, 0xCC3C }, { 0xC54A, 0x5705, 0xE8B5 }, { 0xDC26, 0x5818, 0x610F }, { 0xBEE7, 0x76F5, 0x4586 },
+  { 0x9EC0, 0x535B, 0xF0A5 }, { 0xFC01, 0x7DB6, 0xD42C }, { 0xE56D, 0x72AB, 0x5D96 }, { 0x87AC, 0x5C46, 0x791F },
+  { 0x5EF4, 0x525B, 0xF0A7 }, { 0x3C35, 0x7CB6, 0xD42E }, { 0x2559, 0x73AB, 0x5D94 }, { 0x4798, 0x5D46, 0x791D },
+  { 0x86FD, 0x225E, 0x0B9A }, { 0xE43C, 0x0CB3, 0x2F13 }, { 0xFD50, 0x03AE, 0xA6A9 }, { 0x9F91, 0x2D43, 0x8220 },
+  { 0x46C9, 0x235E, 0x0B98 }, { 0x2408, 0x0DB3, 0x2F11 }, { 0x3D64, 0x02AE, 0xA6AB }, { 0x5FA5, 0x2C43, 0x8222 },
+  { 0x1807, 0xD459, 0x5045 }, { 0x7AC6, 0xFAB4, 0x74CC }, { 0x63AA, 0xF5A9, 0xFD76 }, { 0x016B, 0xDB44, 0xD9FF },
+  { 0xD833, 0xD559, 0x5047 }, { 0xBAF2, 0xFBB4, 0x74CE }, { 0xA39E, 0xF4A9, 0xFD74 }, { 0xC15F, 0xDA44, 0xD9FD },
+  { 0x003A, 0xA55C, 0xAB7A }, { 0x62FB, 0x8BB1, 0x8FF3 }, { 0x7B97, 0x84AC, 0x0649 }, { 0x1956, 0xAA41, 0x22C0 },
+  { 0xC00E, 0xA45C, 0xAB78 }, { 0xA2CF, 0x8AB1, 0x8FF1 }, { 0xBBA3, 0x85AC, 0x064B }, { 0xD962, 0xAB41, 0x22C2 },
+  { 0xF945, 0x8EEF, 0x97E1 }, { 0x9B84, 0xA002, 0xB368 }, { 0x82E8, 0xAF1F, 0x3AD2 }, { 0xE029, 0x81F2, 0x1E5B },
+  { 0x3971, 0x8FEF, 0x97E3 }, { 0x5BB0, 0xA102, 0xB36A }, { 0x42DC, 0xAE1F, 0x3AD0 }, { 0x201D, 0x80F2, 0x1E59 },
+  { 0xE178, 0xFFEA, 0x6CDE }, { 0x83B9, 0xD107, 0x4857 }, { 0x9AD5, 0xDE1A, 0xC1ED }, { 0xF814, 0xF0F7, 0xE564 },
+  { 0x214C, 0xFEEA, 0x6CDC }, { 0x438D, 0xD007, 0x4855 }, { 0x5AE1, 0xDF1A, 0xC1EF }, { 0x3820, 0xF1F7, 0xE566 },
+  { 0xC209, 0xA477, 0xBB29 }, { 0xA0C8, 0x8A9A, 0x9FA0 }, { 0xB9A4, 0x8587, 0x161A }, { 0xDB65, 0xAB6A, 0x3293 },
+  { 0x023D, 0xA577, 0xBB2B }, { 0x60FC, 0x8B9A, 0x9FA2 }, { 0x7990, 0x8487, 0x1618 }, { 0x1B51, 0xAA6A, 0x3291 },
+  { 0xDA34, 0xD572, 0x4016 }, { 0xB8F5, 0xFB9F, 0x649F }, { 0xA199, 0xF482, 0xED25 }, { 0xC358, 0xDA6F, 0xC9AC },
+  { 0x1A00, 0xD472, 0x4014 }, { 0x78C1, 0xFA9F, 0x649D }, { 0x61AD, 0xF582, 0xED27 }, { 0x036C, 0xDB6F, 0xC9AE },
+  { 0x234B, 0xFEC1, 0x7C8D }, { 0x418A, 0xD02C, 0x5804 }, { 0x58E6, 0xDF31, 0xD1BE }, { 0x3A27, 0xF1DC, 0xF537 },
+  { 0xE37F, 0xFFC1, 0x7C8F }, { 0x81BE, 0xD12C, 0x5806 }, { 0x98D2, 0xDE31, 0xD1BC }, { 0xFA13, 0xF0DC, 0xF535 },
+  { 0x3B76, 0x8FC4, 0x87B2 }, { 0x59B7, 0xA129, 0xA33B }, { 0x40DB, 0xAE34, 0x2A81 }, { 0x221A, 0x80D9, 0x0E08 },
+  { 0xFB42, 0x8EC4, 0x87B0 }, { 0x9983, 0xA029, 0xA339 }, { 0x80EF, 0xAF34, 0x2A83 }, { 0xE22E, 0x81D9, 0x0E0A },
+  { 0xA58C, 0x79C3, 0xDC6D }, { 0xC74D, 0x572E, 0xF8E4 }, { 0xDE21, 0x5833, 0x715E }, { 0xBCE0, 0x76DE, 0x55D7 },
+  { 0x65B8, 0x78C3, 0xDC6F }, { 0x0779, 0x562E, 0xF8E6 }, { 0x1E15, 0x5933, 0x715C }, { 0x7CD4, 0x77DE, 0x55D5 },
+  { 0xBDB1, 0x08C6, 0x2752 }, { 0xDF70, 0x262B, 0x03DB }, { 0xC61C, 0x2936, 0x8A61 }, { 0xA4DD, 0x07DB, 0xAEE8 },
+  { 0x7D85, 0x09C6, 0x2750 }, { 0x1F44, 0x272B, 0x03D9 }, { 0x0628, 0x2836, 0x8A63 }, { 0x64E9, 0x06DB, 0xAEEA },
+  { 0x44CE, 0x2375, 0x1BC9 }, { 0x260F, 0x0D98, 0x3F40 }, { 0x3F63, 0x0285, 0xB6FA }, { 0x5DA2, 0x2C68, 0x9273 },
+  { 0x84FA, 0x2275, 0x1BCB }, { 0xE63B, 0x0C98, 0x3F42 }, { 0xFF57, 0x0385, 0xB6F8 }, { 0x9D96, 0x2D68, 0x9271 },
+  { 0x5CF3, 0x5270, 0xE0F6 }, { 0x3E32, 0x7C9D, 0xC47F }, { 0x275E, 0x7380, 0x4DC5 }, { 0x459F, 0x5D6D, 0x694C },
+  { 0x9CC7, 0x5370, 0xE0F4 }, { 0xFE06, 0x7D9D, 0xC47D }, { 0xE76A, 0x7280, 0x4DC7 }, { 0x85AB, 0x5C6D, 0x694E }
+ },
+ {  // byte 9
+  { 0x0000, 0x0000, 0x0000 }, { 0x8567, 0x72D6, 0x97BF }, { 0x7B5E, 0x6FF5, 0xB7F9 }, { 0xFE39, 0x1D23, 0x2046 },
+  { 0xD090, 0x7086, 0x4446 }, { 0x55F7, 0x0250, 0xD3F9 }, { 0xABCE, 0x1F73, 0xF3BF }, { 0x2EA9, 0x6DA5, 0x6400 },
+  { 0xF9F8, 0x6082, 0x1CCF }, { 0x7C9F, 0x1254, 0x8B70 }, { 0x82A6, 0x0F77, 0xAB36 }, { 0x07C1, 0x7DA1, 0x3C89 },
+  { 0x2968, 0x1004, 0x5889 }, { 0xAC0F, 0x62D2, 0xCF36 }, { 0x5236, 0x7FF1, 0xEF70 }, { 0xD751, 0x0D27, 0x78CF },
+  { 0xFDED, 0xAEC2, 0xBDBA }, { 0x788A, 0xDC14, 0x2A05 }, { 0x86B3, 0xC137, 0x0A43 }, { 0x03D4, 0xB3E1, 0x9DFC },
+  { 0x2D7D, 0xDE44, 0xF9FC }, { 0xA81A, 0xAC92, 0x6E43 }, { 0x5623, 0xB1B1, 0x4E05 }, { 0xD344, 0xC367, 0xD9BA },
+  { 0x0415, 0xCE40, 0xA175 }, { 0x8172, 0xBC96, 0x36CA }, { 0x7F4B, 0xA1B5, 0x168C }, { 0xFA2C, 0xD363, 0x8133 },
+  { 0xD485, 0xBEC6, 0xE533 }, { 0x51E2, 0xCC10, 0x728C }, { 0xAFDB, 0xD133, 0x52CA }, { 0x2ABC, 0xA3E5, 0xC575 },
+  { 0x9010, 0xBA6A, 0x4009 }, { 0x1577, 0xC8BC, 0xD7B6 }, { 0xEB4E, 0xD59F, 0xF7F0 }, { 0x6E29, 0xA749, 0x604F },
+  { 0x4080, 0xCAEC, 0x044F }, { 0xC5E7, 0xB83A, 0x93F0 }, { 0x3BDE, 0xA519, 0xB3B6 }, { 0xBEB9, 0xD7CF, 0x2409 },
+  { 0x69E8, 0xDAE8, 0x5CC6 }, { 0xEC8F, 0xA83E, 0xCB79 }, { 0x12B6, 0xB51D, 0xEB3F }, { 0x97D1, 0xC7CB, 0x7C80 },
+  { 0xB978, 0xAA6E, 0x1880 }, { 0x3C1F, 0xD8B8, 0x8F3F }, { 0xC226, 0xC59B, 0xAF79 }, { 0x4741, 0xB74D, 0x38C6 },
+  { 0x6DFD, 0x14A8, 0xFDB3 }, { 0xE89A, 0x667E, 0x6A0C }, { 0x16A3, 0x7B5D, 0x4A4A }, { 0x93C4, 0x098B, 0xDDF5 },
+  { 0xBD6D, 0x642E, 0xB9F5 }, { 0x380A, 0x16F8, 0x2E4A }, { 0xC633, 0x0BDB, 0x0E0C }, { 0x4354, 0x790D, 0x99B3 },
+  { 0x9405, 0x742A, 0xE17C }, { 0x1162, 0x06FC, 0x76C3 }, { 0xEF5B, 0x1BDF, 0x5685 }, { 0x6A3C, 0x6909, 0xC13A },
+  { 0x4495, 0x04AC, 0xA53A }, { 0xC1F2, 0x767A, 0x3285 }, { 0x3FCB, 0x6B59, 0x12C3 }, { 0xBAAC, 0x198F, 0x857C },
+  { 0x6DAF, 0xF2DA, 0xCC7F }, { 0xE8C8, 0x800C, 0x5BC0 }, { 0x16F1, 0x9D2F, 0x7B86 }, { 0x9396, 0xEFF9, 0xEC39 },
+  { 0xBD3F, 0x825C, 0x8839 }, { 0x3858, 0xF08A, 0x1F86 }, { 0xC661, 0xEDA9, 0x3FC0 }, { 0x4306, 0x9F7F, 0xA87F },
+  { 0x9457, 0x9258, 0xD0B0 }, { 0x1130, 0xE08E, 0x470F }, { 0xEF09, 0xFDAD, 0x6749 }, { 0x6A6E, 0x8F7B, 0xF0F6 },
+  { 0x44C7, 0xE2DE, 0x94F6 }, { 0xC1A0, 0x9008, 0x0349 }, { 0x3F99, 0x8D2B, 0x230F }, { 0xBAFE, 0xFFFD, 0xB4B0 },
+  { 0x9042, 0x5C18, 0x71C5 }, { 0x1525, 0x2ECE, 0xE67A }, { 0xEB1C, 0x33ED, 0xC63C }, { 0x6E7B, 0x413B, 0x5183 },
+  { 0x40D2, 0x2C9E, 0x3583 }, { 0xC5B5, 0x5E48, 0xA23C }, { 0x3B8C, 0x436B, 0x827A }, { 0xBEEB, 0x31BD, 0x15C5 },
+  { 0x69BA, 0x3C9A, 0x6D0A }, { 0xECDD, 0x4E4C, 0xFAB5 }, { 0x12E4, 0x536F, 0xDAF3 }, { 0x9783, 0x21B9, 0x4D4C },
+  { 0xB92A, 0x4C1C, 0x294C }, { 0x3C4D, 0x3ECA, 0xBEF3 }, { 0xC274, 0x23E9, 0x9EB5 }, { 0x4713, 0x513F, 0x090A },
+  { 0xFDBF, 0x48B0, 0x8C76 }, { 0x78D8, 0x3A66, 0x1BC9 }, { 0x86E1, 0x2745, 0x3B8F }, { 0x0386, 0x5593, 0xAC30 },
+  { 0x2D2F, 0x3836, 0xC830 }, { 0xA848, 0x4AE0, 0x5F8F }, { 0x5671, 0x57C3, 0x7FC9 }, { 0xD316, 0x2515, 0xE876 },
+  { 0x0447, 0x2832, 0x90B9 }, { 0x8120, 0x5AE4, 0x0706 }, { 0x7F19, 0x47C7, 0x2740 }, { 0xFA7E, 0x3511, 0xB0FF },
+  { 0xD4D7, 0x58B4, 0xD4FF }, { 0x51B0, 0x2A62, 0x4340 }, { 0xAF89, 0x3741, 0x6306 }, { 0x2AEE, 0x4597, 0xF4B9 },
+  { 0x0052, 0xE672, 0x31CC }, { 0x8535, 0x94A4, 0xA673 }, { 0x7B0C, 0x8987, 0x8635 }, { 0xFE6B, 0xFB51, 0x118A },
+  { 0xD0C2, 0x96F4, 0x758A }, { 0x55A5, 0xE422, 0xE235 }, { 0xAB9C, 0xF901, 0xC273 }, { 0x2EFB, 0x8BD7, 0x55CC },
+  { 0xF9AA, 0x86F0, 0x2D03 }, { 0x7CCD, 0xF426, 0xBABC }, { 0x82F4, 0xE905, 0x9AFA }, { 0x0793, 0x9BD3, 0x0D45 },
+  { 0x293A, 0xF676, 0x6945 }, { 0xAC5D, 0x84A0, 0xFEFA }, { 0x5264, 0x9983, 0xDEBC }, { 0xD703, 0xEB55, 0x4903 },
+  { 0x9642, 0x7C1A, 0xD17D }, { 0x1325, 0x0ECC, 0x46C2 }, { 0xED1C, 0x13EF, 0x6684 }, { 0x687B, 0x6139, 0xF13B },
+  { 0x46D2, 0x0C9C, 0x953B }, { 0xC3B5, 0x7E4A, 0x0284 }, { 0x3D8C, 0x6369, 0x22C2 }, { 0xB8EB, 0x11BF, 0xB57D },
+  { 0x6FBA, 0x1C98, 0xCDB2 }, { 0xEADD, 0x6E4E, 0x5A0D }, { 0x14E4, 0x736D, 0x7A4B }, { 0x9183, 0x01BB, 0xEDF4 },
+  { 0xBF2A, 0x6C1E, 0x89F4 }, { 0x3A4D, 0x1EC8, 0x1E4B }, { 0xC474, 0x03EB, 0x3E0D }, { 0x4113, 0x713D, 0xA9B2 },
+  { 0x6BAF, 0xD2D8, 0x6CC7 }, { 0xEEC8, 0xA00E, 0xFB78 }, { 0x10F1, 0xBD2D, 0xDB3E }, { 0x9596, 0xCFFB, 0x4C81 },
+  { 0xBB3F, 0xA25E, 0x2881 }, { 0x3E58, 0xD088, 0xBF3E }, { 0xC061, 0xCDAB, 0x9F78 }, { 0x4506, 0xBF7D, 0x08C7 },
+  { 0x9257, 0xB25A, 0x7008 }, { 0x1730, 0xC08C, 0xE7B7 }, { 0xE909, 0xDDAF, 0xC7F1 }, { 0x6C6E, 0xAF79, 0x504E },
+  { 0x42C7, 0xC2DC, 0x344E }, { 0xC7A0, 0xB00A, 0xA3F1 }, { 0x3999, 0xAD29, 0x83B7 }, { 0xBCFE, 0xDFFF, 0x1408 },
+  { 0x0652, 0xC670, 0x9174 }, { 0x8335, 0xB4A6, 0x06CB }, { 0x7D0C, 0xA985, 0x268D }, { 0xF86B, 0xDB53, 0xB132 },
+  { 0xD6C2, 0xB6F6, 0xD532 }, { 0x53A5, 0xC420, 0x428D }, { 0xAD9C, 0xD903, 0x62CB }, { 0x28FB, 0xABD5, 0xF574 },
+  { 0xFFAA, 0xA6F2, 0x8DBB }, { 0x7ACD, 0xD424, 0x1A04 }, { 0x84F4, 0xC907, 0x3A42 }, { 0x0193, 0xBBD1, 0xADFD },
+  { 0x2F3A, 0xD674, 0xC9FD }, { 0xAA5D, 0xA4A2, 0x5E42 }, { 0x5464, 0xB981, 0x7E04 }, { 0xD103, 0xCB57, 0xE9BB },
+  { 0xFBBF, 0x68B2, 0x2CCE }, { 0x7ED8, 0x1A64, 0xBB71 }, { 0x80E1, 0x0747, 0x9B37 }, { 0x0586, 0x7591, 0x0C88 },
+  { 0x2B2F, 0x1834, 0x6888 }, { 0xAE48, 0x6AE2, 0xFF37 }, { 0x5071, 0x77C1, 0xDF71 }, { 0xD516, 0x0517, 0x48CE },
+  { 0x0247, 0x0830, 0x3001 }, { 0x8720, 0x7AE6, 0xA7BE }, { 0x7919, 0x67C5, 0x87F8 }, { 0xFC7E, 0x1513, 0x1047 },
+  { 0xD2D7, 0x78B6, 0x7447 }, { 0x57B0, 0x0A60, 0xE3F8 }, { 0xA989, 0x1743, 0xC3BE }, { 0x2CEE, 0x6595, 0x5401 },
+  { 0xFBED, 0x8EC0, 0x1D02 }, { 0x7E8A, 0xFC16, 0x8ABD }, { 0x80B3, 0xE135, 0xAAFB }, { 0x05D4, 0x93E3, 0x3D44 },
+  { 0x2B7D, 0xFE46, 0x5944 }, { 0xAE1A, 0x8C90, 0xCEFB }, { 0x5023, 0x91B3, 0xEEBD }, { 0xD544, 0xE365, 0x7902 },
+  { 0x0215, 0xEE42, 0x01CD }, { 0x8772, 0x9C94, 0x9672 }, { 0x794B, 0x81B7, 0xB634 }, { 0xFC2C, 0xF361, 0x218B },
+  { 0xD285, 0x9EC4, 0x458B }, { 0x57E2, 0xEC12, 0xD234 }, { 0xA9DB, 0xF131, 0xF272 }, { 0x2CBC, 0x83E7, 0x65CD },
+  { 0x0600, 0x2002, 0xA0B8 }, { 0x8367, 0x52D4, 0x3707 }, { 0x7D5E, 0x4FF7, 0x1741 }, { 0xF839, 0x3D21, 0x80FE },
+  { 0xD690, 0x5084, 0xE4FE }, { 0x53F7, 0x2252, 0x7341 }, { 0xADCE, 0x3F71, 0x5307 }, { 0x28A9, 0x4DA7, 0xC4B8 },
+  { 0xFFF8, 0x4080, 0xBC77 }, { 0x7A9F, 0x3256, 0x2BC8 }, { 0x84A6, 0x2F75, 0x0B8E }, { 0x01C1, 0x5DA3, 0x9C31 },
+  { 0x2F68, 0x3006, 0xF831 }, { 0xAA0F, 0x42D0, 0x6F8E }, { 0x5436, 0x5FF3, 0x4FC8 }, { 0xD151, 0x2D25, 0xD877 },
+  { 0x6BFD, 0x34AA, 0x5D0B }, { 0xEE9A, 0x467C, 0xCAB4 }, { 0x10A3, 0x5B5F, 0xEAF2 }, { 0x95C4, 0x2989, 0x7D4D },
+  { 0xBB6D, 0x442C, 0x194D }, { 0x3E0A, 0x36FA, 0x8EF2 }, { 0xC033, 0x2BD9, 0xAEB4 }, { 0x4554, 0x590F, 0x390B },
+  { 0x9205, 0x5428, 0x41C4 }, { 0x1762, 0x26FE, 0xD67B }, { 0xE95B, 0x3BDD, 0xF63D }, { 0x6C3C, 0x490B, 0x6182 },
+  { 0x4295, 0x24AE, 0x0582 }, { 0xC7F2, 0x5678, 0x923D }, { 0x39CB, 0x4B5B, 0xB27B }, { 0xBCAC, 0x398D, 0x25C4 },
+  { 0x9610, 0x9A68, 0xE0B1 }, { 0x1377, 0xE8BE, 0x770E }, { 0xED4E, 0xF59D, 0x5748 }, { 0x6829, 0x874B, 0xC0F7 },
+  { 0x4680, 0xEAEE, 0xA4F7 }, { 0xC3E7, 0x9838, 0x3348 }, { 0x3DDE, 0x851B, 0x130E }, { 0xB8B9, 0xF7CD, 0x84B1 },
+  { 0x6FE8, 0xFAEA, 0xFC7E }, { 0xEA8F, 0x883C, 0x6BC1 }, { 0x14B6, 0x951F, 0x4B87 }, { 0x91D1, 0xE7C9, 0xDC38 },
+  { 0xBF78, 0x8A6C, 0xB838 }, { 0x3A1F, 0xF8BA, 0x2F87 }, { 0xC426, 0xE599, 0x0FC1 }, { 0x4141, 0x974F, 0x987E }
+ },
+ {  // byte 10
+  { 0x0000, 0x0000, 0x0000 }, { 0x9C09, 0xB98A, 0x441D }, { 0xA036, 0x4E7D, 0x9B73 }, { 0x3C3F, 0xF7F7, 0xDF6E },
+  { 0xB217, 0xFE5A, 0x414D }, { 0x2E1E, 0x47D0, 0x0550 }, { 0x1221, 0xB027, 0xDA3E }, { 0x8E28, 0x09AD, 0x9E23 },
+  { 0xCFD3, 0x56E6, 0x43C4 }, { 0x53DA, 0xEF6C, 0x07D9 }, { 0x6FE5, 0x189B, 0xD8B7 }, { 0xF3EC, 0xA111, 0x9CAA },
+  { 0x7DC4, 0xA8BC, 0x0289 }, { 0xE1CD, 0x1136, 0x4694 }, { 0xDDF2, 0xE6C1, 0x99FA }, { 0x41FB, 0x5F4B, 0xDDE7 },
+  { 0x3C8B, 0x5371, 0xC174 }, { 0xA082, 0xEAFB, 0x8569 }, { 0x9CBD, 0x1D0C, 0x5A07 }, { 0x00B4, 0xA486, 0x1E1A },
+  { 0x8E9C, 0xAD2B, 0x8039 }, { 0x1295, 0x14A1, 0xC424 }, { 0x2EAA, 0xE356, 0x1B4A }, { 0xB2A3, 0x5ADC, 0x5F57 },
+  { 0xF358, 0x0597, 0x82B0 }, { 0x6F51, 0xBC1D, 0xC6AD }, { 0x536E, 0x4BEA, 0x19C3 }, { 0xCF67, 0xF260, 0x5DDE },
+  { 0x414F, 0xFBCD, 0xC3FD }, { 0xDD46, 0x4247, 0x87E0 }, { 0xE179, 0xB5B0, 0x588E }, { 0x7D70, 0x0C3A, 0x1C93 },
+  { 0x5DCC, 0x69BC, 0xA6E9 }, { 0xC1C5, 0xD036, 0xE2F4 }, { 0xFDFA, 0x27C1, 0x3D9A }, { 0x61F3, 0x9E4B, 0x7987 },
+  { 0xEFDB, 0x97E6, 0xE7A4 }, { 0x73D2, 0x2E6C, 0xA3B9 }, { 0x4FED, 0xD99B, 0x7CD7 }, { 0xD3E4, 0x6011, 0x38CA },
+  { 0x921F, 0x3F5A, 0xE52D }, { 0x0E16, 0x86D0, 0xA130 }, { 0x3229, 0x7127, 0x7E5E }, { 0xAE20, 0xC8AD, 0x3A43 },
+  { 0x2008, 0xC100, 0xA460 }, { 0xBC01, 0x788A, 0xE07D }, { 0x803E, 0x8F7D, 0x3F13 }, { 0x1C37, 0x36F7, 0x7B0E },
+  { 0x6147, 0x3ACD, 0x679D }, { 0xFD4E, 0x8347, 0x2380 }, { 0xC171, 0x74B0, 0xFCEE }, { 0x5D78, 0xCD3A, 0xB8F3 },
+  { 0xD350, 0xC497, 0x26D0 }, { 0x4F59, 0x7D1D, 0x62CD }, { 0x7366, 0x8AEA, 0xBDA3 }, { 0xEF6F, 0x3360, 0xF9BE },
+  { 0xAE94, 0x6C2B, 0x2459 }, { 0x329D, 0xD5A1, 0x6044 }, { 0x0EA2, 0x2256, 0xBF2A }, { 0x92AB, 0x9BDC, 0xFB37 },
+  { 0x1C83, 0x9271, 0x6514 }, { 0x808A, 0x2BFB, 0x2109 }, { 0xBCB5, 0xDC0C, 0xFE67 }, { 0x20BC, 0x6586, 0xBA7A },
+  { 0xD588, 0x62FF, 0x8669 }, { 0x4981, 0xDB75, 0xC274 }, { 0x75BE, 0x2C82, 0x1D1A }, { 0xE9B7, 0x9508, 0x5907 },
+  { 0x679F, 0x9CA5, 0xC724 }, { 0xFB96, 0x252F, 0x8339 }, { 0xC7A9, 0xD2D8, 0x5C57 }, { 0x5BA0, 0x6B52, 0x184A },
+  { 0x1A5B, 0x3419, 0xC5AD }, { 0x8652, 0x8D93, 0x81B0 }, { 0xBA6D, 0x7A64, 0x5EDE }, { 0x2664, 0xC3EE, 0x1AC3 },
+  { 0xA84C, 0xCA43, 0x84E0 }, { 0x3445, 0x73C9, 0xC0FD }, { 0x087A, 0x843E, 0x1F93 }, { 0x9473, 0x3DB4, 0x5B8E },
+  { 0xE903, 0x318E, 0x471D }, { 0x750A, 0x8804, 0x0300 }, { 0x4935, 0x7FF3, 0xDC6E }, { 0xD53C, 0xC679, 0x9873 },
+  { 0x5B14, 0xCFD4, 0x0650 }, { 0xC71D, 0x765E, 0x424D }, { 0xFB22, 0x81A9, 0x9D23 }, { 0x672B, 0x3823, 0xD93E },
+  { 0x26D0, 0x6768, 0x04D9 }, { 0xBAD9, 0xDEE2, 0x40C4 }, { 0x86E6, 0x2915, 0x9FAA }, { 0x1AEF, 0x909F, 0xDBB7 },
+  { 0x94C7, 0x9932, 0x4594 }, { 0x08CE, 0x20B8, 0x0189 }, { 0x34F1, 0xD74F, 0xDEE7 }, { 0xA8F8, 0x6EC5, 0x9AFA },
+  { 0x8844, 0x0B43, 0x2080 }, { 0x144D, 0xB2C9, 0x649D }, { 0x2872, 0x453E, 0xBBF3 }, { 0xB47B, 0xFCB4, 0xFFEE },
+  { 0x3A53, 0xF519, 0x61CD }, { 0xA65A, 0x4C93, 0x25D0 }, { 0x9A65, 0xBB64, 0xFABE }, { 0x066C, 0x02EE, 0xBEA3 },
+  { 0x4797, 0x5DA5, 0x6344 }, { 0xDB9E, 0xE42F, 0x2759 }, { 0xE7A1, 0x13D8, 0xF837 }, { 0x7BA8, 0xAA52, 0xBC2A },
+  { 0xF580, 0xA3FF, 0x2209 }, { 0x6989, 0x1A75, 0x6614 }, { 0x55B6, 0xED82, 0xB97A }, { 0xC9BF, 0x5408, 0xFD67 },
+  { 0xB4CF, 0x5832, 0xE1F4 }, { 0x28C6, 0xE1B8, 0xA5E9 }, { 0x14F9, 0x164F, 0x7A87 }, { 0x88F0, 0xAFC5, 0x3E9A },
+  { 0x06D8, 0xA668, 0xA0B9 }, { 0x9AD1, 0x1FE2, 0xE4A4 }, { 0xA6EE, 0xE815, 0x3BCA }, { 0x3AE7, 0x519F, 0x7FD7 },
+  { 0x7B1C, 0x0ED4, 0xA230 }, { 0xE715, 0xB75E, 0xE62D }, { 0xDB2A, 0x40A9, 0x3943 }, { 0x4723, 0xF923, 0x7D5E },
+  { 0xC90B, 0xF08E, 0xE37D }, { 0x5502, 0x4904, 0xA760 }, { 0x693D, 0xBEF3, 0x780E }, { 0xF534, 0x0779, 0x3C13 },
+  { 0x52FD, 0x1E7B, 0xE0A6 }, { 0xCEF4, 0xA7F1, 0xA4BB }, { 0xF2CB, 0x5006, 0x7BD5 }, { 0x6EC2, 0xE98C, 0x3FC8 },
+  { 0xE0EA, 0xE021, 0xA1EB }, { 0x7CE3, 0x59AB, 0xE5F6 }, { 0x40DC, 0xAE5C, 0x3A98 }, { 0xDCD5, 0x17D6, 0x7E85 },
+  { 0x9D2E, 0x489D, 0xA362 }, { 0x0127, 0xF117, 0xE77F }, { 0x3D18, 0x06E0, 0x3811 }, { 0xA111, 0xBF6A, 0x7C0C },
+  { 0x2F39, 0xB6C7, 0xE22F }, { 0xB330, 0x0F4D, 0xA632 }, { 0x8F0F, 0xF8BA, 0x795C }, { 0x1306, 0x4130, 0x3D41 },
+  { 0x6E76, 0x4D0A, 0x21D2 }, { 0xF27F, 0xF480, 0x65CF }, { 0xCE40, 0x0377, 0xBAA1 }, { 0x5249, 0xBAFD, 0xFEBC },
+  { 0xDC61, 0xB350, 0x609F }, { 0x4068, 0x0ADA, 0x2482 }, { 0x7C57, 0xFD2D, 0xFBEC }, { 0xE05E, 0x44A7, 0xBFF1 },
+  { 0xA1A5, 0x1BEC, 0x6216 }, { 0x3DAC, 0xA266, 0x260B }, { 0x0193, 0x5591, 0xF965 }, { 0x9D9A, 0xEC1B, 0xBD78 },
+  { 0x13B2, 0xE5B6, 0x235B }, { 0x8FBB, 0x5C3C, 0x6746 }, { 0xB384, 0xABCB, 0xB828 }, { 0x2F8D, 0x1241, 0xFC35 },
+  { 0x0F31, 0x77C7, 0x464F }, { 0x9338, 0xCE4D, 0x0252 }, { 0xAF07, 0x39BA, 0xDD3C }, { 0x330E, 0x8030, 0x9921 },
+  { 0xBD26, 0x899D, 0x0702 }, { 0x212F, 0x3017, 0x431F }, { 0x1D10, 0xC7E0, 0x9C71 }, { 0x8119, 0x7E6A, 0xD86C },
+  { 0xC0E2, 0x2121, 0x058B }, { 0x5CEB, 0x98AB, 0x4196 }, { 0x60D4, 0x6F5C, 0x9EF8 }, { 0xFCDD, 0xD6D6, 0xDAE5 },
+  { 0x72F5, 0xDF7B, 0x44C6 }, { 0xEEFC, 0x66F1, 0x00DB }, { 0xD2C3, 0x9106, 0xDFB5 }, { 0x4ECA, 0x288C, 0x9BA8 },
+  { 0x33BA, 0x24B6, 0x873B }, { 0xAFB3, 0x9D3C, 0xC326 }, { 0x938C, 0x6ACB, 0x1C48 }, { 0x0F85, 0xD341, 0x5855 },
+  { 0x81AD, 0xDAEC, 0xC676 }, { 0x1DA4, 0x6366, 0x826B }, { 0x219B, 0x9491, 0x5D05 }, { 0xBD92, 0x2D1B, 0x1918 },
+  { 0xFC69, 0x7250, 0xC4FF }, { 0x6060, 0xCBDA, 0x80E2 }, { 0x5C5F, 0x3C2D, 0x5F8C }, { 0xC056, 0x85A7, 0x1B91 },
+  { 0x4E7E, 0x8C0A, 0x85B2 }, { 0xD277, 0x3580, 0xC1AF }, { 0xEE48, 0xC277, 0x1EC1 }, { 0x7241, 0x7BFD, 0x5ADC },
+  { 0x8775, 0x7C84, 0x66CF }, { 0x1B7C, 0xC50E, 0x22D2 }, { 0x2743, 0x32F9, 0xFDBC }, { 0xBB4A, 0x8B73, 0xB9A1 },
+  { 0x3562, 0x82DE, 0x2782 }, { 0xA96B, 0x3B54, 0x639F }, { 0x9554, 0xCCA3, 0xBCF1 }, { 0x095D, 0x7529, 0xF8EC },
+  { 0x48A6, 0x2A62, 0x250B }, { 0xD4AF, 0x93E8, 0x6116 }, { 0xE890, 0x641F, 0xBE78 }, { 0x7499, 0xDD95, 0xFA65 },
+  { 0xFAB1, 0xD438, 0x6446 }, { 0x66B8, 0x6DB2, 0x205B }, { 0x5A87, 0x9A45, 0xFF35 }, { 0xC68E, 0x23CF, 0xBB28 },
+  { 0xBBFE, 0x2FF5, 0xA7BB }, { 0x27F7, 0x967F, 0xE3A6 }, { 0x1BC8, 0x6188, 0x3CC8 }, { 0x87C1, 0xD802, 0x78D5 },
+  { 0x09E9, 0xD1AF, 0xE6F6 }, { 0x95E0, 0x6825, 0xA2EB }, { 0xA9DF, 0x9FD2, 0x7D85 }, { 0x35D6, 0x2658, 0x3998 },
+  { 0x742D, 0x7913, 0xE47F }, { 0xE824, 0xC099, 0xA062 }, { 0xD41B, 0x376E, 0x7F0C }, { 0x4812, 0x8EE4, 0x3B11 },
+  { 0xC63A, 0x8749, 0xA532 }, { 0x5A33, 0x3EC3, 0xE12F }, { 0x660C, 0xC934, 0x3E41 }, { 0xFA05, 0x70BE, 0x7A5C },
+  { 0xDAB9, 0x1538, 0xC026 }, { 0x46B0, 0xACB2, 0x843B }, { 0x7A8F, 0x5B45, 0x5B55 }, { 0xE686, 0xE2CF, 0x1F48 },
+  { 0x68AE, 0xEB62, 0x816B }, { 0xF4A7, 0x52E8, 0xC576 }, { 0xC898, 0xA51F, 0x1A18 }, { 0x5491, 0x1C95, 0x5E05 },
+  { 0x156A, 0x43DE, 0x83E2 }, { 0x8963, 0xFA54, 0xC7FF }, { 0xB55C, 0x0DA3, 0x1891 }, { 0x2955, 0xB429, 0x5C8C },
+  { 0xA77D, 0xBD84, 0xC2AF }, { 0x3B74, 0x040E, 0x86B2 }, { 0x074B, 0xF3F9, 0x59DC }, { 0x9B42, 0x4A73, 0x1DC1 },
+  { 0xE632, 0x4649, 0x0152 }, { 0x7A3B, 0xFFC3, 0x454F }, { 0x4604, 0x0834, 0x9A21 }, { 0xDA0D, 0xB1BE, 0xDE3C },
+  { 0x5425, 0xB813, 0x401F }, { 0xC82C, 0x0199, 0x0402 }, { 0xF413, 0xF66E, 0xDB6C }, { 0x681A, 0x4FE4, 0x9F71 },
+  { 0x29E1, 0x10AF, 0x4296 }, { 0xB5E8, 0xA925, 0x068B }, { 0x89D7, 0x5ED2, 0xD9E5 }, { 0x15DE, 0xE758, 0x9DF8 },
+  { 0x9BF6, 0xEEF5, 0x03DB }, { 0x07FF, 0x577F, 0x47C6 }, { 0x3BC0, 0xA088, 0x98A8 }, { 0xA7C9, 0x1902, 0xDCB5 }
+ },
+ {  // byte 11
+  { 0x0000, 0x0000, 0x0000 }, { 0x0C7A, 0xAD1C, 0xAA3A }, { 0xF2B5, 0xF51A, 0xC0EF }, { 0xFECF, 0x5806, 0x6AD5 },
+  { 0x6049, 0xE1A0, 0x7FE9 }, { 0x6C33, 0x4CBC, 0xD5D3 }, { 0x92FC, 0x14BA, 0xBF06 }, { 0x9E86, 0xB9A6, 0x153C },
+  { 0x76E1, 0x1989, 0x5F97 }, { 0x7A9B, 0xB495, 0xF5AD }, { 0x8454, 0xEC93, 0x9F78 }, { 0x882E, 0x418F, 0x3542 },
+  { 0x16A8, 0xF829, 0x207E }, { 0x1AD2, 0x5535, 0x8A44 }, { 0xE41D, 0x0D33, 0xE091 }, { 0xE867, 0xA02F, 0x4AAB },
+  { 0xC67C, 0xE663, 0x30FB }, { 0xCA06, 0x4B7F, 0x9AC1 }, { 0x34C9, 0x1379, 0xF014 }, { 0x38B3, 0xBE65, 0x5A2E },
+  { 0xA635, 0x07C3, 0x4F12 }, { 0xAA4F, 0xAADF, 0xE528 }, { 0x5480, 0xF2D9, 0x8FFD }, { 0x58FA, 0x5FC5, 0x25C7 },
+  { 0xB09D, 0xFFEA, 0x6F6C }, { 0xBCE7, 0x52F6, 0xC556 }, { 0x4228, 0x0AF0, 0xAF83 }, { 0x4E52, 0xA7EC, 0x05B9 },
+  { 0xD0D4, 0x1E4A, 0x1085 }, { 0xDCAE, 0xB356, 0xBABF }, { 0x2261, 0xEB50, 0xD06A }, { 0x2E1B, 0x464C, 0x7A50 },
+  { 0x4DB0, 0x3998, 0xF92F }, { 0x41CA, 0x9484, 0x5315 }, { 0xBF05, 0xCC82, 0x39C0 }, { 0xB37F, 0x619E, 0x93FA },
+  { 0x2DF9, 0xD838, 0x86C6 }, { 0x2183, 0x7524, 0x2CFC }, { 0xDF4C, 0x2D22, 0x4629 }, { 0xD336, 0x803E, 0xEC13 },
+  { 0x3B51, 0x2011, 0xA6B8 }, { 0x372B, 0x8D0D, 0x0C82 }, { 0xC9E4, 0xD50B, 0x6657 }, { 0xC59E, 0x7817, 0xCC6D },
+  { 0x5B18, 0xC1B1, 0xD951 }, { 0x5762, 0x6CAD, 0x736B }, { 0xA9AD, 0x34AB, 0x19BE }, { 0xA5D7, 0x99B7, 0xB384 },
+  { 0x8BCC, 0xDFFB, 0xC9D4 }, { 0x87B6, 0x72E7, 0x63EE }, { 0x7979, 0x2AE1, 0x093B }, { 0x7503, 0x87FD, 0xA301 },
+  { 0xEB85, 0x3E5B, 0xB63D }, { 0xE7FF, 0x9347, 0x1C07 }, { 0x1930, 0xCB41, 0x76D2 }, { 0x154A, 0x665D, 0xDCE8 },
+  { 0xFD2D, 0xC672, 0x9643 }, { 0xF157, 0x6B6E, 0x3C79 }, { 0x0F98, 0x3368, 0x56AC }, { 0x03E2, 0x9E74, 0xFC96 },
+  { 0x9D64, 0x27D2, 0xE9AA }, { 0x911E, 0x8ACE, 0x4390 }, { 0x6FD1, 0xD2C8, 0x2945 }, { 0x63AB, 0x7FD4, 0x837F },
+  { 0x4C15, 0x664C, 0x8BE8 }, { 0x406F, 0xCB50, 0x21D2 }, { 0xBEA0, 0x9356, 0x4B07 }, { 0xB2DA, 0x3E4A, 0xE13D },
+  { 0x2C5C, 0x87EC, 0xF401 }, { 0x2026, 0x2AF0, 0x5E3B }, { 0xDEE9, 0x72F6, 0x34EE }, { 0xD293, 0xDFEA, 0x9ED4 },
+  { 0x3AF4, 0x7FC5, 0xD47F }, { 0x368E, 0xD2D9, 0x7E45 }, { 0xC841, 0x8ADF, 0x1490 }, { 0xC43B, 0x27C3, 0xBEAA },
+  { 0x5ABD, 0x9E65, 0xAB96 }, { 0x56C7, 0x3379, 0x01AC }, { 0xA808, 0x6B7F, 0x6B79 }, { 0xA472, 0xC663, 0xC143 },
+  { 0x8A69, 0x802F, 0xBB13 }, { 0x8613, 0x2D33, 0x1129 }, { 0x78DC, 0x7535, 0x7BFC }, { 0x74A6, 0xD829, 0xD1C6 },
+  { 0xEA20, 0x618F, 0xC4FA }, { 0xE65A, 0xCC93, 0x6EC0 }, { 0x1895, 0x9495, 0x0415 }, { 0x14EF, 0x3989, 0xAE2F },
+  { 0xFC88, 0x99A6, 0xE484 }, { 0xF0F2, 0x34BA, 0x4EBE }, { 0x0E3D, 0x6CBC, 0x246B }, { 0x0247, 0xC1A0, 0x8E51 },
+  { 0x9CC1, 0x7806, 0x9B6D }, { 0x90BB, 0xD51A, 0x3157 }, { 0x6E74, 0x8D1C, 0x5B82 }, { 0x620E, 0x2000, 0xF1B8 },
+  { 0x01A5, 0x5FD4, 0x72C7 }, { 0x0DDF, 0xF2C8, 0xD8FD }, { 0xF310, 0xAACE, 0xB228 }, { 0xFF6A, 0x07D2, 0x1812 },
+  { 0x61EC, 0xBE74, 0x0D2E }, { 0x6D96, 0x1368, 0xA714 }, { 0x9359, 0x4B6E, 0xCDC1 }, { 0x9F23, 0xE672, 0x67FB },
+  { 0x7744, 0x465D, 0x2D50 }, { 0x7B3E, 0xEB41, 0x876A }, { 0x85F1, 0xB347, 0xEDBF }, { 0x898B, 0x1E5B, 0x4785 },
+  { 0x170D, 0xA7FD, 0x52B9 }, { 0x1B77, 0x0AE1, 0xF883 }, { 0xE5B8, 0x52E7, 0x9256 }, { 0xE9C2, 0xFFFB, 0x386C },
+  { 0xC7D9, 0xB9B7, 0x423C }, { 0xCBA3, 0x14AB, 0xE806 }, { 0x356C, 0x4CAD, 0x82D3 }, { 0x3916, 0xE1B1, 0x28E9 },
+  { 0xA790, 0x5817, 0x3DD5 }, { 0xABEA, 0xF50B, 0x97EF }, { 0x5525, 0xAD0D, 0xFD3A }, { 0x595F, 0x0011, 0x5700 },
+  { 0xB138, 0xA03E, 0x1DAB }, { 0xBD42, 0x0D22, 0xB791 }, { 0x438D, 0x5524, 0xDD44 }, { 0x4FF7, 0xF838, 0x777E },
+  { 0xD171, 0x419E, 0x6242 }, { 0xDD0B, 0xEC82, 0xC878 }, { 0x23C4, 0xB484, 0xA2AD }, { 0x2FBE, 0x1998, 0x0897 },
+  { 0x35A7, 0x23C4, 0x123B }, { 0x39DD, 0x8ED8, 0xB801 }, { 0xC712, 0xD6DE, 0xD2D4 }, { 0xCB68, 0x7BC2, 0x78EE },
+  { 0x55EE, 0xC264, 0x6DD2 }, { 0x5994, 0x6F78, 0xC7E8 }, { 0xA75B, 0x377E, 0xAD3D }, { 0xAB21, 0x9A62, 0x0707 },
+  { 0x4346, 0x3A4D, 0x4DAC }, { 0x4F3C, 0x9751, 0xE796 }, { 0xB1F3, 0xCF57, 0x8D43 }, { 0xBD89, 0x624B, 0x2779 },
+  { 0x230F, 0xDBED, 0x3245 }, { 0x2F75, 0x76F1, 0x987F }, { 0xD1BA, 0x2EF7, 0xF2AA }, { 0xDDC0, 0x83EB, 0x5890 },
+  { 0xF3DB, 0xC5A7, 0x22C0 }, { 0xFFA1, 0x68BB, 0x88FA }, { 0x016E, 0x30BD, 0xE22F }, { 0x0D14, 0x9DA1, 0x4815 },
+  { 0x9392, 0x2407, 0x5D29 }, { 0x9FE8, 0x891B, 0xF713 }, { 0x6127, 0xD11D, 0x9DC6 }, { 0x6D5D, 0x7C01, 0x37FC },
+  { 0x853A, 0xDC2E, 0x7D57 }, { 0x8940, 0x7132, 0xD76D }, { 0x778F, 0x2934, 0xBDB8 }, { 0x7BF5, 0x8428, 0x1782 },
+  { 0xE573, 0x3D8E, 0x02BE }, { 0xE909, 0x9092, 0xA884 }, { 0x17C6, 0xC894, 0xC251 }, { 0x1BBC, 0x6588, 0x686B },
+  { 0x7817, 0x1A5C, 0xEB14 }, { 0x746D, 0xB740, 0x412E }, { 0x8AA2, 0xEF46, 0x2BFB }, { 0x86D8, 0x425A, 0x81C1 },
+  { 0x185E, 0xFBFC, 0x94FD }, { 0x1424, 0x56E0, 0x3EC7 }, { 0xEAEB, 0x0EE6, 0x5412 }, { 0xE691, 0xA3FA, 0xFE28 },
+  { 0x0EF6, 0x03D5, 0xB483 }, { 0x028C, 0xAEC9, 0x1EB9 }, { 0xFC43, 0xF6CF, 0x746C }, { 0xF039, 0x5BD3, 0xDE56 },
+  { 0x6EBF, 0xE275, 0xCB6A }, { 0x62C5, 0x4F69, 0x6150 }, { 0x9C0A, 0x176F, 0x0B85 }, { 0x9070, 0xBA73, 0xA1BF },
+  { 0xBE6B, 0xFC3F, 0xDBEF }, { 0xB211, 0x5123, 0x71D5 }, { 0x4CDE, 0x0925, 0x1B00 }, { 0x40A4, 0xA439, 0xB13A },
+  { 0xDE22, 0x1D9F, 0xA406 }, { 0xD258, 0xB083, 0x0E3C }, { 0x2C97, 0xE885, 0x64E9 }, { 0x20ED, 0x4599, 0xCED3 },
+  { 0xC88A, 0xE5B6, 0x8478 }, { 0xC4F0, 0x48AA, 0x2E42 }, { 0x3A3F, 0x10AC, 0x4497 }, { 0x3645, 0xBDB0, 0xEEAD },
+  { 0xA8C3, 0x0416, 0xFB91 }, { 0xA4B9, 0xA90A, 0x51AB }, { 0x5A76, 0xF10C, 0x3B7E }, { 0x560C, 0x5C10, 0x9144 },
+  { 0x79B2, 0x4588, 0x99D3 }, { 0x75C8, 0xE894, 0x33E9 }, { 0x8B07, 0xB092, 0x593C }, { 0x877D, 0x1D8E, 0xF306 },
+  { 0x19FB, 0xA428, 0xE63A }, { 0x1581, 0x0934, 0x4C00 }, { 0xEB4E, 0x5132, 0x26D5 }, { 0xE734, 0xFC2E, 0x8CEF },
+  { 0x0F53, 0x5C01, 0xC644 }, { 0x0329, 0xF11D, 0x6C7E }, { 0xFDE6, 0xA91B, 0x06AB }, { 0xF19C, 0x0407, 0xAC91 },
+  { 0x6F1A, 0xBDA1, 0xB9AD }, { 0x6360, 0x10BD, 0x1397 }, { 0x9DAF, 0x48BB, 0x7942 }, { 0x91D5, 0xE5A7, 0xD378 },
+  { 0xBFCE, 0xA3EB, 0xA928 }, { 0xB3B4, 0x0EF7, 0x0312 }, { 0x4D7B, 0x56F1, 0x69C7 }, { 0x4101, 0xFBED, 0xC3FD },
+  { 0xDF87, 0x424B, 0xD6C1 }, { 0xD3FD, 0xEF57, 0x7CFB }, { 0x2D32, 0xB751, 0x162E }, { 0x2148, 0x1A4D, 0xBC14 },
+  { 0xC92F, 0xBA62, 0xF6BF }, { 0xC555, 0x177E, 0x5C85 }, { 0x3B9A, 0x4F78, 0x3650 }, { 0x37E0, 0xE264, 0x9C6A },
+  { 0xA966, 0x5BC2, 0x8956 }, { 0xA51C, 0xF6DE, 0x236C }, { 0x5BD3, 0xAED8, 0x49B9 }, { 0x57A9, 0x03C4, 0xE383 },
+  { 0x3402, 0x7C10, 0x60FC }, { 0x3878, 0xD10C, 0xCAC6 }, { 0xC6B7, 0x890A, 0xA013 }, { 0xCACD, 0x2416, 0x0A29 },
+  { 0x544B, 0x9DB0, 0x1F15 }, { 0x5831, 0x30AC, 0xB52F }, { 0xA6FE, 0x68AA, 0xDFFA }, { 0xAA84, 0xC5B6, 0x75C0 },
+  { 0x42E3, 0x6599, 0x3F6B }, { 0x4E99, 0xC885, 0x9551 }, { 0xB056, 0x9083, 0xFF84 }, { 0xBC2C, 0x3D9F, 0x55BE },
+  { 0x22AA, 0x8439, 0x4082 }, { 0x2ED0, 0x2925, 0xEAB8 }, { 0xD01F, 0x7123, 0x806D }, { 0xDC65, 0xDC3F, 0x2A57 },
+  { 0xF27E, 0x9A73, 0x5007 }, { 0xFE04, 0x376F, 0xFA3D }, { 0x00CB, 0x6F69, 0x90E8 }, { 0x0CB1, 0xC275, 0x3AD2 },
+  { 0x9237, 0x7BD3, 0x2FEE }, { 0x9E4D, 0xD6CF, 0x85D4 }, { 0x6082, 0x8EC9, 0xEF01 }, { 0x6CF8, 0x23D5, 0x453B },
+  { 0x849F, 0x83FA, 0x0F90 }, { 0x88E5, 0x2EE6, 0xA5AA }, { 0x762A, 0x76E0, 0xCF7F }, { 0x7A50, 0xDBFC, 0x6545 },
+  { 0xE4D6, 0x625A, 0x7079 }, { 0xE8AC, 0xCF46, 0xDA43 }, { 0x1663, 0x9740, 0xB096 }, { 0x1A19, 0x3A5C, 0x1AAC }
+ },
+ {  // byte 12
+  { 0x0000, 0x0000, 0x0000 }, { 0xB91B, 0xAFCA, 0x2C18 }, { 0x40B3, 0xA500, 0x111A }, { 0xF9A8, 0x0ACA, 0x3D02 },
+  { 0xC244, 0x9B57, 0xEBB5 }, { 0x7B5F, 0x349D, 0xC7AD }, { 0x82F7, 0x3E57, 0xFAAF }, { 0x3BEC, 0x919D, 0xD6B7 },
+  { 0xBE21, 0x9C26, 0x6B06 }, { 0x073A, 0x33EC, 0x471E }, { 0xFE92, 0x3926, 0x7A1C }, { 0x4789, 0x96EC, 0x5604 },
+  { 0x7C65, 0x0771, 0x80B3 }, { 0xC57E, 0xA8BB, 0xACAB }, { 0x3CD6, 0xA271, 0x91A9 }, { 0x85CD, 0x0DBB, 0xBDB1 },
+  { 0xB812, 0xB08A, 0x4E0F }, { 0x0109, 0x1F40, 0x6217 }, { 0xF8A1, 0x158A, 0x5F15 }, { 0x41BA, 0xBA40, 0x730D },
+  { 0x7A56, 0x2BDD, 0xA5BA }, { 0xC34D, 0x8417, 0x89A2 }, { 0x3AE5, 0x8EDD, 0xB4A0 }, { 0x83FE, 0x2117, 0x98B8 },
+  { 0x0633, 0x2CAC, 0x2509 }, { 0xBF28, 0x8366, 0x0911 }, { 0x4680, 0x89AC, 0x3413 }, { 0xFF9B, 0x2666, 0x180B },
+  { 0xC477, 0xB7FB, 0xCEBC }, { 0x7D6C, 0x1831, 0xE2A4 }, { 0x84C4, 0x12FB, 0xDFA6 }, { 0x3DDF, 0xBD31, 0xF3BE },
+  { 0x2826, 0xEE44, 0x9A7A }, { 0x913D, 0x418E, 0xB662 }, { 0x6895, 0x4B44, 0x8B60 }, { 0xD18E, 0xE48E, 0xA778 },
+  { 0xEA62, 0x7513, 0x71CF }, { 0x5379, 0xDAD9, 0x5DD7 }, { 0xAAD1, 0xD013, 0x60D5 }, { 0x13CA, 0x7FD9, 0x4CCD },
+  { 0x9607, 0x7262, 0xF17C }, { 0x2F1C, 0xDDA8, 0xDD64 }, { 0xD6B4, 0xD762, 0xE066 }, { 0x6FAF, 0x78A8, 0xCC7E },
+  { 0x5443, 0xE935, 0x1AC9 }, { 0xED58, 0x46FF, 0x36D1 }, { 0x14F0, 0x4C35, 0x0BD3 }, { 0xADEB, 0xE3FF, 0x27CB },
+  { 0x9034, 0x5ECE, 0xD475 }, { 0x292F, 0xF104, 0xF86D }, { 0xD087, 0xFBCE, 0xC56F }, { 0x699C, 0x5404, 0xE977 },
+  { 0x5270, 0xC599, 0x3FC0 }, { 0xEB6B, 0x6A53, 0x13D8 }, { 0x12C3, 0x6099, 0x2EDA }, { 0xABD8, 0xCF53, 0x02C2 },
+  { 0x2E15, 0xC2E8, 0xBF73 }, { 0x970E, 0x6D22, 0x936B }, { 0x6EA6, 0x67E8, 0xAE69 }, { 0xD7BD, 0xC822, 0x8271 },
+  { 0xEC51, 0x59BF, 0x54C6 }, { 0x554A, 0xF675, 0x78DE }, { 0xACE2, 0xFCBF, 0x45DC }, { 0x15F9, 0x5375, 0x69C4 },
+  { 0x5024, 0xFF69, 0x415E }, { 0xE93F, 0x50A3, 0x6D46 }, { 0x1097, 0x5A69, 0x5044 }, { 0xA98C, 0xF5A3, 0x7C5C },
+  { 0x9260, 0x643E, 0xAAEB }, { 0x2B7B, 0xCBF4, 0x86F3 }, { 0xD2D3, 0xC13E, 0xBBF1 }, { 0x6BC8, 0x6EF4, 0x97E9 },
+  { 0xEE05, 0x634F, 0x2A58 }, { 0x571E, 0xCC85, 0x0640 }, { 0xAEB6, 0xC64F, 0x3B42 }, { 0x17AD, 0x6985, 0x175A },
+  { 0x2C41, 0xF818, 0xC1ED }, { 0x955A, 0x57D2, 0xEDF5 }, { 0x6CF2, 0x5D18, 0xD0F7 }, { 0xD5E9, 0xF2D2, 0xFCEF },
+  { 0xE836, 0x4FE3, 0x0F51 }, { 0x512D, 0xE029, 0x2349 }, { 0xA885, 0xEAE3, 0x1E4B }, { 0x119E, 0x4529, 0x3253 },
+  { 0x2A72, 0xD4B4, 0xE4E4 }, { 0x9369, 0x7B7E, 0xC8FC }, { 0x6AC1, 0x71B4, 0xF5FE }, { 0xD3DA, 0xDE7E, 0xD9E6 },
+  { 0x5617, 0xD3C5, 0x6457 }, { 0xEF0C, 0x7C0F, 0x484F }, { 0x16A4, 0x76C5, 0x754D }, { 0xAFBF, 0xD90F, 0x5955 },
+  { 0x9453, 0x4892, 0x8FE2 }, { 0x2D48, 0xE758, 0xA3FA }, { 0xD4E0, 0xED92, 0x9EF8 }, { 0x6DFB, 0x4258, 0xB2E0 },
+  { 0x7802, 0x112D, 0xDB24 }, { 0xC119, 0xBEE7, 0xF73C }, { 0x38B1, 0xB42D, 0xCA3E }, { 0x81AA, 0x1BE7, 0xE626 },
+  { 0xBA46, 0x8A7A, 0x3091 }, { 0x035D, 0x25B0, 0x1C89 }, { 0xFAF5, 0x2F7A, 0x218B }, { 0x43EE, 0x80B0, 0x0D93 },
+  { 0xC623, 0x8D0B, 0xB022 }, { 0x7F38, 0x22C1, 0x9C3A }, { 0x8690, 0x280B, 0xA138 }, { 0x3F8B, 0x87C1, 0x8D20 },
+  { 0x0467, 0x165C, 0x5B97 }, { 0xBD7C, 0xB996, 0x778F }, { 0x44D4, 0xB35C, 0x4A8D }, { 0xFDCF, 0x1C96, 0x6695 },
+  { 0xC010, 0xA1A7, 0x952B }, { 0x790B, 0x0E6D, 0xB933 }, { 0x80A3, 0x04A7, 0x8431 }, { 0x39B8, 0xAB6D, 0xA829 },
+  { 0x0254, 0x3AF0, 0x7E9E }, { 0xBB4F, 0x953A, 0x5286 }, { 0x42E7, 0x9FF0, 0x6F84 }, { 0xFBFC, 0x303A, 0x439C },
+  { 0x7E31, 0x3D81, 0xFE2D }, { 0xC72A, 0x924B, 0xD235 }, { 0x3E82, 0x9881, 0xEF37 }, { 0x8799, 0x374B, 0xC32F },
+  { 0xBC75, 0xA6D6, 0x1598 }, { 0x056E, 0x091C, 0x3980 }, { 0xFCC6, 0x03D6, 0x0482 }, { 0x45DD, 0xAC1C, 0x289A },
+  { 0x2536, 0x3254, 0xF82D }, { 0x9C2D, 0x9D9E, 0xD435 }, { 0x6585, 0x9754, 0xE937 }, { 0xDC9E, 0x389E, 0xC52F },
+  { 0xE772, 0xA903, 0x1398 }, { 0x5E69, 0x06C9, 0x3F80 }, { 0xA7C1, 0x0C03, 0x0282 }, { 0x1EDA, 0xA3C9, 0x2E9A },
+  { 0x9B17, 0xAE72, 0x932B }, { 0x220C, 0x01B8, 0xBF33 }, { 0xDBA4, 0x0B72, 0x8231 }, { 0x62BF, 0xA4B8, 0xAE29 },
+  { 0x5953, 0x3525, 0x789E }, { 0xE048, 0x9AEF, 0x5486 }, { 0x19E0, 0x9025, 0x6984 }, { 0xA0FB, 0x3FEF, 0x459C },
+  { 0x9D24, 0x82DE, 0xB622 }, { 0x243F, 0x2D14, 0x9A3A }, { 0xDD97, 0x27DE, 0xA738 }, { 0x648C, 0x8814, 0x8B20 },
+  { 0x5F60, 0x1989, 0x5D97 }, { 0xE67B, 0xB643, 0x718F }, { 0x1FD3, 0xBC89, 0x4C8D }, { 0xA6C8, 0x1343, 0x6095 },
+  { 0x2305, 0x1EF8, 0xDD24 }, { 0x9A1E, 0xB132, 0xF13C }, { 0x63B6, 0xBBF8, 0xCC3E }, { 0xDAAD, 0x1432, 0xE026 },
+  { 0xE141, 0x85AF, 0x3691 }, { 0x585A, 0x2A65, 0x1A89 }, { 0xA1F2, 0x20AF, 0x278B }, { 0x18E9, 0x8F65, 0x0B93 },
+  { 0x0D10, 0xDC10, 0x6257 }, { 0xB40B, 0x73DA, 0x4E4F }, { 0x4DA3, 0x7910, 0x734D }, { 0xF4B8, 0xD6DA, 0x5F55 },
+  { 0xCF54, 0x4747, 0x89E2 }, { 0x764F, 0xE88D, 0xA5FA }, { 0x8FE7, 0xE247, 0x98F8 }, { 0x36FC, 0x4D8D, 0xB4E0 },
+  { 0xB331, 0x4036, 0x0951 }, { 0x0A2A, 0xEFFC, 0x2549 }, { 0xF382, 0xE536, 0x184B }, { 0x4A99, 0x4AFC, 0x3453 },
+  { 0x7175, 0xDB61, 0xE2E4 }, { 0xC86E, 0x74AB, 0xCEFC }, { 0x31C6, 0x7E61, 0xF3FE }, { 0x88DD, 0xD1AB, 0xDFE6 },
+  { 0xB502, 0x6C9A, 0x2C58 }, { 0x0C19, 0xC350, 0x0040 }, { 0xF5B1, 0xC99A, 0x3D42 }, { 0x4CAA, 0x6650, 0x115A },
+  { 0x7746, 0xF7CD, 0xC7ED }, { 0xCE5D, 0x5807, 0xEBF5 }, { 0x37F5, 0x52CD, 0xD6F7 }, { 0x8EEE, 0xFD07, 0xFAEF },
+  { 0x0B23, 0xF0BC, 0x475E }, { 0xB238, 0x5F76, 0x6B46 }, { 0x4B90, 0x55BC, 0x5644 }, { 0xF28B, 0xFA76, 0x7A5C },
+  { 0xC967, 0x6BEB, 0xACEB }, { 0x707C, 0xC421, 0x80F3 }, { 0x89D4, 0xCEEB, 0xBDF1 }, { 0x30CF, 0x6121, 0x91E9 },
+  { 0x7512, 0xCD3D, 0xB973 }, { 0xCC09, 0x62F7, 0x956B }, { 0x35A1, 0x683D, 0xA869 }, { 0x8CBA, 0xC7F7, 0x8471 },
+  { 0xB756, 0x566A, 0x52C6 }, { 0x0E4D, 0xF9A0, 0x7EDE }, { 0xF7E5, 0xF36A, 0x43DC }, { 0x4EFE, 0x5CA0, 0x6FC4 },
+  { 0xCB33, 0x511B, 0xD275 }, { 0x7228, 0xFED1, 0xFE6D }, { 0x8B80, 0xF41B, 0xC36F }, { 0x329B, 0x5BD1, 0xEF77 },
+  { 0x0977, 0xCA4C, 0x39C0 }, { 0xB06C, 0x6586, 0x15D8 }, { 0x49C4, 0x6F4C, 0x28DA }, { 0xF0DF, 0xC086, 0x04C2 },
+  { 0xCD00, 0x7DB7, 0xF77C }, { 0x741B, 0xD27D, 0xDB64 }, { 0x8DB3, 0xD8B7, 0xE666 }, { 0x34A8, 0x777D, 0xCA7E },
+  { 0x0F44, 0xE6E0, 0x1CC9 }, { 0xB65F, 0x492A, 0x30D1 }, { 0x4FF7, 0x43E0, 0x0DD3 }, { 0xF6EC, 0xEC2A, 0x21CB },
+  { 0x7321, 0xE191, 0x9C7A }, { 0xCA3A, 0x4E5B, 0xB062 }, { 0x3392, 0x4491, 0x8D60 }, { 0x8A89, 0xEB5B, 0xA178 },
+  { 0xB165, 0x7AC6, 0x77CF }, { 0x087E, 0xD50C, 0x5BD7 }, { 0xF1D6, 0xDFC6, 0x66D5 }, { 0x48CD, 0x700C, 0x4ACD },
+  { 0x5D34, 0x2379, 0x2309 }, { 0xE42F, 0x8CB3, 0x0F11 }, { 0x1D87, 0x8679, 0x3213 }, { 0xA49C, 0x29B3, 0x1E0B },
+  { 0x9F70, 0xB82E, 0xC8BC }, { 0x266B, 0x17E4, 0xE4A4 }, { 0xDFC3, 0x1D2E, 0xD9A6 }, { 0x66D8, 0xB2E4, 0xF5BE },
+  { 0xE315, 0xBF5F, 0x480F }, { 0x5A0E, 0x1095, 0x6417 }, { 0xA3A6, 0x1A5F, 0x5915 }, { 0x1ABD, 0xB595, 0x750D },
+  { 0x2151, 0x2408, 0xA3BA }, { 0x984A, 0x8BC2, 0x8FA2 }, { 0x61E2, 0x8108, 0xB2A0 }, { 0xD8F9, 0x2EC2, 0x9EB8 },
+  { 0xE526, 0x93F3, 0x6D06 }, { 0x5C3D, 0x3C39, 0x411E }, { 0xA595, 0x36F3, 0x7C1C }, { 0x1C8E, 0x9939, 0x5004 },
+  { 0x2762, 0x08A4, 0x86B3 }, { 0x9E79, 0xA76E, 0xAAAB }, { 0x67D1, 0xADA4, 0x97A9 }, { 0xDECA, 0x026E, 0xBBB1 },
+  { 0x5B07, 0x0FD5, 0x0600 }, { 0xE21C, 0xA01F, 0x2A18 }, { 0x1BB4, 0xAAD5, 0x171A }, { 0xA2AF, 0x051F, 0x3B02 },
+  { 0x9943, 0x9482, 0xEDB5 }, { 0x2058, 0x3B48, 0xC1AD }, { 0xD9F0, 0x3182, 0xFCAF }, { 0x60EB, 0x9E48, 0xD0B7 }
+ },
+ {  // byte 13
+  { 0x0000, 0x0000, 0x0000 }, { 0x141B, 0xDD09, 0x7145 }, { 0xE2E4, 0x3AF8, 0xCFAE }, { 0xF6FF, 0xE7F1, 0xBEEB },
+  { 0x3591, 0xE931, 0xB9F9 }, { 0x218A, 0x3438, 0xC8BC }, { 0xD775, 0xD3C9, 0x7657 }, { 0xC36E, 0x0EC0, 0x0712 },
+  { 0xCF09, 0xB817, 0xF93A }, { 0xDB12, 0x651E, 0x887F }, { 0x2DED, 0x82EF, 0x3694 }, { 0x39F6, 0x5FE6, 0x47D1 },
+  { 0xFA98, 0x5126, 0x40C3 }, { 0xEE83, 0x8C2F, 0x3186 }, { 0x187C, 0x6BDE, 0x8F6D }, { 0x0C67, 0xB6D7, 0xFE28 },
+  { 0x4FFC, 0x0CB0, 0xBDBB }, { 0x5BE7, 0xD1B9, 0xCCFE }, { 0xAD18, 0x3648, 0x7215 }, { 0xB903, 0xEB41, 0x0350 },
+  { 0x7A6D, 0xE581, 0x0442 }, { 0x6E76, 0x3888, 0x7507 }, { 0x9889, 0xDF79, 0xCBEC }, { 0x8C92, 0x0270, 0xBAA9 },
+  { 0x80F5, 0xB4A7, 0x4481 }, { 0x94EE, 0x69AE, 0x35C4 }, { 0x6211, 0x8E5F, 0x8B2F }, { 0x760A, 0x5356, 0xFA6A },
+  { 0xB564, 0x5D96, 0xFD78 }, { 0xA17F, 0x809F, 0x8C3D }, { 0x5780, 0x676E, 0x32D6 }, { 0x439B, 0xBA67, 0x4393 },
+  { 0x05C1, 0xB359, 0xC9AD }, { 0x11DA, 0x6E50, 0xB8E8 }, { 0xE725, 0x89A1, 0x0603 }, { 0xF33E, 0x54A8, 0x7746 },
+  { 0x3050, 0x5A68, 0x7054 }, { 0x244B, 0x8761, 0x0111 }, { 0xD2B4, 0x6090, 0xBFFA }, { 0xC6AF, 0xBD99, 0xCEBF },
+  { 0xCAC8, 0x0B4E, 0x3097 }, { 0xDED3, 0xD647, 0x41D2 }, { 0x282C, 0x31B6, 0xFF39 }, { 0x3C37, 0xECBF, 0x8E7C },
+  { 0xFF59, 0xE27F, 0x896E }, { 0xEB42, 0x3F76, 0xF82B }, { 0x1DBD, 0xD887, 0x46C0 }, { 0x09A6, 0x058E, 0x3785 },
+  { 0x4A3D, 0xBFE9, 0x7416 }, { 0x5E26, 0x62E0, 0x0553 }, { 0xA8D9, 0x8511, 0xBBB8 }, { 0xBCC2, 0x5818, 0xCAFD },
+  { 0x7FAC, 0x56D8, 0xCDEF }, { 0x6BB7, 0x8BD1, 0xBCAA }, { 0x9D48, 0x6C20, 0x0241 }, { 0x8953, 0xB129, 0x7304 },
+  { 0x8534, 0x07FE, 0x8D2C }, { 0x912F, 0xDAF7, 0xFC69 }, { 0x67D0, 0x3D06, 0x4282 }, { 0x73CB, 0xE00F, 0x33C7 },
+  { 0xB0A5, 0xEECF, 0x34D5 }, { 0xA4BE, 0x33C6, 0x4590 }, { 0x5241, 0xD437, 0xFB7B }, { 0x465A, 0x093E, 0x8A3E },
+  { 0x4A4F, 0xA93C, 0x8EB9 }, { 0x5E54, 0x7435, 0xFFFC }, { 0xA8AB, 0x93C4, 0x4117 }, { 0xBCB0, 0x4ECD, 0x3052 },
+  { 0x7FDE, 0x400D, 0x3740 }, { 0x6BC5, 0x9D04, 0x4605 }, { 0x9D3A, 0x7AF5, 0xF8EE }, { 0x8921, 0xA7FC, 0x89AB },
+  { 0x8546, 0x112B, 0x7783 }, { 0x915D, 0xCC22, 0x06C6 }, { 0x67A2, 0x2BD3, 0xB82D }, { 0x73B9, 0xF6DA, 0xC968 },
+  { 0xB0D7, 0xF81A, 0xCE7A }, { 0xA4CC, 0x2513, 0xBF3F }, { 0x5233, 0xC2E2, 0x01D4 }, { 0x4628, 0x1FEB, 0x7091 },
+  { 0x05B3, 0xA58C, 0x3302 }, { 0x11A8, 0x7885, 0x4247 }, { 0xE757, 0x9F74, 0xFCAC }, { 0xF34C, 0x427D, 0x8DE9 },
+  { 0x3022, 0x4CBD, 0x8AFB }, { 0x2439, 0x91B4, 0xFBBE }, { 0xD2C6, 0x7645, 0x4555 }, { 0xC6DD, 0xAB4C, 0x3410 },
+  { 0xCABA, 0x1D9B, 0xCA38 }, { 0xDEA1, 0xC092, 0xBB7D }, { 0x285E, 0x2763, 0x0596 }, { 0x3C45, 0xFA6A, 0x74D3 },
+  { 0xFF2B, 0xF4AA, 0x73C1 }, { 0xEB30, 0x29A3, 0x0284 }, { 0x1DCF, 0xCE52, 0xBC6F }, { 0x09D4, 0x135B, 0xCD2A },
+  { 0x4F8E, 0x1A65, 0x4714 }, { 0x5B95, 0xC76C, 0x3651 }, { 0xAD6A, 0x209D, 0x88BA }, { 0xB971, 0xFD94, 0xF9FF },
+  { 0x7A1F, 0xF354, 0xFEED }, { 0x6E04, 0x2E5D, 0x8FA8 }, { 0x98FB, 0xC9AC, 0x3143 }, { 0x8CE0, 0x14A5, 0x4006 },
+  { 0x8087, 0xA272, 0xBE2E }, { 0x949C, 0x7F7B, 0xCF6B }, { 0x6263, 0x988A, 0x7180 }, { 0x7678, 0x4583, 0x00C5 },
+  { 0xB516, 0x4B43, 0x07D7 }, { 0xA10D, 0x964A, 0x7692 }, { 0x57F2, 0x71BB, 0xC879 }, { 0x43E9, 0xACB2, 0xB93C },
+  { 0x0072, 0x16D5, 0xFAAF }, { 0x1469, 0xCBDC, 0x8BEA }, { 0xE296, 0x2C2D, 0x3501 }, { 0xF68D, 0xF124, 0x4444 },
+  { 0x35E3, 0xFFE4, 0x4356 }, { 0x21F8, 0x22ED, 0x3213 }, { 0xD707, 0xC51C, 0x8CF8 }, { 0xC31C, 0x1815, 0xFDBD },
+  { 0xCF7B, 0xAEC2, 0x0395 }, { 0xDB60, 0x73CB, 0x72D0 }, { 0x2D9F, 0x943A, 0xCC3B }, { 0x3984, 0x4933, 0xBD7E },
+  { 0xFAEA, 0x47F3, 0xBA6C }, { 0xEEF1, 0x9AFA, 0xCB29 }, { 0x180E, 0x7D0B, 0x75C2 }, { 0x0C15, 0xA002, 0x0487 },
+  { 0x76EB, 0x9999, 0xE5B7 }, { 0x62F0, 0x4490, 0x94F2 }, { 0x940F, 0xA361, 0x2A19 }, { 0x8014, 0x7E68, 0x5B5C },
+  { 0x437A, 0x70A8, 0x5C4E }, { 0x5761, 0xADA1, 0x2D0B }, { 0xA19E, 0x4A50, 0x93E0 }, { 0xB585, 0x9759, 0xE2A5 },
+  { 0xB9E2, 0x218E, 0x1C8D }, { 0xADF9, 0xFC87, 0x6DC8 }, { 0x5B06, 0x1B76, 0xD323 }, { 0x4F1D, 0xC67F, 0xA266 },
+  { 0x8C73, 0xC8BF, 0xA574 }, { 0x9868, 0x15B6, 0xD431 }, { 0x6E97, 0xF247, 0x6ADA }, { 0x7A8C, 0x2F4E, 0x1B9F },
+  { 0x3917, 0x9529, 0x580C }, { 0x2D0C, 0x4820, 0x2949 }, { 0xDBF3, 0xAFD1, 0x97A2 }, { 0xCFE8, 0x72D8, 0xE6E7 },
+  { 0x0C86, 0x7C18, 0xE1F5 }, { 0x189D, 0xA111, 0x90B0 }, { 0xEE62, 0x46E0, 0x2E5B }, { 0xFA79, 0x9BE9, 0x5F1E },
+  { 0xF61E, 0x2D3E, 0xA136 }, { 0xE205, 0xF037, 0xD073 }, { 0x14FA, 0x17C6, 0x6E98 }, { 0x00E1, 0xCACF, 0x1FDD },
+  { 0xC38F, 0xC40F, 0x18CF }, { 0xD794, 0x1906, 0x698A }, { 0x216B, 0xFEF7, 0xD761 }, { 0x3570, 0x23FE, 0xA624 },
+  { 0x732A, 0x2AC0, 0x2C1A }, { 0x6731, 0xF7C9, 0x5D5F }, { 0x91CE, 0x1038, 0xE3B4 }, { 0x85D5, 0xCD31, 0x92F1 },
+  { 0x46BB, 0xC3F1, 0x95E3 }, { 0x52A0, 0x1EF8, 0xE4A6 }, { 0xA45F, 0xF909, 0x5A4D }, { 0xB044, 0x2400, 0x2B08 },
+  { 0xBC23, 0x92D7, 0xD520 }, { 0xA838, 0x4FDE, 0xA465 }, { 0x5EC7, 0xA82F, 0x1A8E }, { 0x4ADC, 0x7526, 0x6BCB },
+  { 0x89B2, 0x7BE6, 0x6CD9 }, { 0x9DA9, 0xA6EF, 0x1D9C }, { 0x6B56, 0x411E, 0xA377 }, { 0x7F4D, 0x9C17, 0xD232 },
+  { 0x3CD6, 0x2670, 0x91A1 }, { 0x28CD, 0xFB79, 0xE0E4 }, { 0xDE32, 0x1C88, 0x5E0F }, { 0xCA29, 0xC181, 0x2F4A },
+  { 0x0947, 0xCF41, 0x2858 }, { 0x1D5C, 0x1248, 0x591D }, { 0xEBA3, 0xF5B9, 0xE7F6 }, { 0xFFB8, 0x28B0, 0x96B3 },
+  { 0xF3DF, 0x9E67, 0x689B }, { 0xE7C4, 0x436E, 0x19DE }, { 0x113B, 0xA49F, 0xA735 }, { 0x0520, 0x7996, 0xD670 },
+  { 0xC64E, 0x7756, 0xD162 }, { 0xD255, 0xAA5F, 0xA027 }, { 0x24AA, 0x4DAE, 0x1ECC }, { 0x30B1, 0x90A7, 0x6F89 },
+  { 0x3CA4, 0x30A5, 0x6B0E }, { 0x28BF, 0xEDAC, 0x1A4B }, { 0xDE40, 0x0A5D, 0xA4A0 }, { 0xCA5B, 0xD754, 0xD5E5 },
+  { 0x0935, 0xD994, 0xD2F7 }, { 0x1D2E, 0x049D, 0xA3B2 }, { 0xEBD1, 0xE36C, 0x1D59 }, { 0xFFCA, 0x3E65, 0x6C1C },
+  { 0xF3AD, 0x88B2, 0x9234 }, { 0xE7B6, 0x55BB, 0xE371 }, { 0x1149, 0xB24A, 0x5D9A }, { 0x0552, 0x6F43, 0x2CDF },
+  { 0xC63C, 0x6183, 0x2BCD }, { 0xD227, 0xBC8A, 0x5A88 }, { 0x24D8, 0x5B7B, 0xE463 }, { 0x30C3, 0x8672, 0x9526 },
+  { 0x7358, 0x3C15, 0xD6B5 }, { 0x6743, 0xE11C, 0xA7F0 }, { 0x91BC, 0x06ED, 0x191B }, { 0x85A7, 0xDBE4, 0x685E },
+  { 0x46C9, 0xD524, 0x6F4C }, { 0x52D2, 0x082D, 0x1E09 }, { 0xA42D, 0xEFDC, 0xA0E2 }, { 0xB036, 0x32D5, 0xD1A7 },
+  { 0xBC51, 0x8402, 0x2F8F }, { 0xA84A, 0x590B, 0x5ECA }, { 0x5EB5, 0xBEFA, 0xE021 }, { 0x4AAE, 0x63F3, 0x9164 },
+  { 0x89C0, 0x6D33, 0x9676 }, { 0x9DDB, 0xB03A, 0xE733 }, { 0x6B24, 0x57CB, 0x59D8 }, { 0x7F3F, 0x8AC2, 0x289D },
+  { 0x3965, 0x83FC, 0xA2A3 }, { 0x2D7E, 0x5EF5, 0xD3E6 }, { 0xDB81, 0xB904, 0x6D0D }, { 0xCF9A, 0x640D, 0x1C48 },
+  { 0x0CF4, 0x6ACD, 0x1B5A }, { 0x18EF, 0xB7C4, 0x6A1F }, { 0xEE10, 0x5035, 0xD4F4 }, { 0xFA0B, 0x8D3C, 0xA5B1 },
+  { 0xF66C, 0x3BEB, 0x5B99 }, { 0xE277, 0xE6E2, 0x2ADC }, { 0x1488, 0x0113, 0x9437 }, { 0x0093, 0xDC1A, 0xE572 },
+  { 0xC3FD, 0xD2DA, 0xE260 }, { 0xD7E6, 0x0FD3, 0x9325 }, { 0x2119, 0xE822, 0x2DCE }, { 0x3502, 0x352B, 0x5C8B },
+  { 0x7699, 0x8F4C, 0x1F18 }, { 0x6282, 0x5245, 0x6E5D }, { 0x947D, 0xB5B4, 0xD0B6 }, { 0x8066, 0x68BD, 0xA1F3 },
+  { 0x4308, 0x667D, 0xA6E1 }, { 0x5713, 0xBB74, 0xD7A4 }, { 0xA1EC, 0x5C85, 0x694F }, { 0xB5F7, 0x818C, 0x180A },
+  { 0xB990, 0x375B, 0xE622 }, { 0xAD8B, 0xEA52, 0x9767 }, { 0x5B74, 0x0DA3, 0x298C }, { 0x4F6F, 0xD0AA, 0x58C9 },
+  { 0x8C01, 0xDE6A, 0x5FDB }, { 0x981A, 0x0363, 0x2E9E }, { 0x6EE5, 0xE492, 0x9075 }, { 0x7AFE, 0x399B, 0xE130 }
+ },
+ {  // byte 14
+  { 0x0000, 0x0000, 0x0000 }, { 0xC99C, 0x13E6, 0x6704 }, { 0x7CE7, 0x0770, 0x81A3 }, { 0xB57B, 0x1496, 0xE6A7 },
+  { 0x7797, 0xA7EC, 0x0709 }, { 0xBE0B, 0xB40A, 0x600D }, { 0x0B70, 0xA09C, 0x86AA }, { 0xC2EC, 0xB37A, 0xE1AE },
+  { 0x484F, 0x2F5D, 0x8BF8 }, { 0x81D3, 0x3CBB, 0xECFC }, { 0x34A8, 0x282D, 0x0A5B }, { 0xFD34, 0x3BCB, 0x6D5F },
+  { 0x3FD8, 0x88B1, 0x8CF1 }, { 0xF644, 0x9B57, 0xEBF5 }, { 0x433F, 0x8FC1, 0x0D52 }, { 0x8AA3, 0x9C27, 0x6A56 },
+  { 0x7F3B, 0xA880, 0x3D1A }, { 0xB6A7, 0xBB66, 0x5A1E }, { 0x03DC, 0xAFF0, 0xBCB9 }, { 0xCA40, 0xBC16, 0xDBBD },
+  { 0x08AC, 0x0F6C, 0x3A13 }, { 0xC130, 0x1C8A, 0x5D17 }, { 0x744B, 0x081C, 0xBBB0 }, { 0xBDD7, 0x1BFA, 0xDCB4 },
+  { 0x3774, 0x87DD, 0xB6E2 }, { 0xFEE8, 0x943B, 0xD1E6 }, { 0x4B93, 0x80AD, 0x3741 }, { 0x820F, 0x934B, 0x5045 },
+  { 0x40E3, 0x2031, 0xB1EB }, { 0x897F, 0x33D7, 0xD6EF }, { 0x3C04, 0x2741, 0x3048 }, { 0xF598, 0x34A7, 0x574C },
+  { 0xC6D2, 0xC90F, 0x2AC8 }, { 0x0F4E, 0xDAE9, 0x4DCC }, { 0xBA35, 0xCE7F, 0xAB6B }, { 0x73A9, 0xDD99, 0xCC6F },
+  { 0xB145, 0x6EE3, 0x2DC1 }, { 0x78D9, 0x7D05, 0x4AC5 }, { 0xCDA2, 0x6993, 0xAC62 }, { 0x043E, 0x7A75, 0xCB66 },
+  { 0x8E9D, 0xE652, 0xA130 }, { 0x4701, 0xF5B4, 0xC634 }, { 0xF27A, 0xE122, 0x2093 }, { 0x3BE6, 0xF2C4, 0x4797 },
+  { 0xF90A, 0x41BE, 0xA639 }, { 0x3096, 0x5258, 0xC13D }, { 0x85ED, 0x46CE, 0x279A }, { 0x4C71, 0x5528, 0x409E },
+  { 0xB9E9, 0x618F, 0x17D2 }, { 0x7075, 0x7269, 0x70D6 }, { 0xC50E, 0x66FF, 0x9671 }, { 0x0C92, 0x7519, 0xF175 },
+  { 0xCE7E, 0xC663, 0x10DB }, { 0x07E2, 0xD585, 0x77DF }, { 0xB299, 0xC113, 0x9178 }, { 0x7B05, 0xD2F5, 0xF67C },
+  { 0xF1A6, 0x4ED2, 0x9C2A }, { 0x383A, 0x5D34, 0xFB2E }, { 0x8D41, 0x49A2, 0x1D89 }, { 0x44DD, 0x5A44, 0x7A8D },
+  { 0x8631, 0xE93E, 0x9B23 }, { 0x4FAD, 0xFAD8, 0xFC27 }, { 0xFAD6, 0xEE4E, 0x1A80 }, { 0x334A, 0xFDA8, 0x7D84 },
+  { 0x8DCF, 0x929A, 0xFCB0 }, { 0x4453, 0x817C, 0x9BB4 }, { 0xF128, 0x95EA, 0x7D13 }, { 0x38B4, 0x860C, 0x1A17 },
+  { 0xFA58, 0x3576, 0xFBB9 }, { 0x33C4, 0x2690, 0x9CBD }, { 0x86BF, 0x3206, 0x7A1A }, { 0x4F23, 0x21E0, 0x1D1E },
+  { 0xC580, 0xBDC7, 0x7748 }, { 0x0C1C, 0xAE21, 0x104C }, { 0xB967, 0xBAB7, 0xF6EB }, { 0x70FB, 0xA951, 0x91EF },
+  { 0xB217, 0x1A2B, 0x7041 }, { 0x7B8B, 0x09CD, 0x1745 }, { 0xCEF0, 0x1D5B, 0xF1E2 }, { 0x076C, 0x0EBD, 0x96E6 },
+  { 0xF2F4, 0x3A1A, 0xC1AA }, { 0x3B68, 0x29FC, 0xA6AE }, { 0x8E13, 0x3D6A, 0x4009 }, { 0x478F, 0x2E8C, 0x270D },
+  { 0x8563, 0x9DF6, 0xC6A3 }, { 0x4CFF, 0x8E10, 0xA1A7 }, { 0xF984, 0x9A86, 0x4700 }, { 0x3018, 0x8960, 0x2004 },
+  { 0xBABB, 0x1547, 0x4A52 }, { 0x7327, 0x06A1, 0x2D56 }, { 0xC65C, 0x1237, 0xCBF1 }, { 0x0FC0, 0x01D1, 0xACF5 },
+  { 0xCD2C, 0xB2AB, 0x4D5B }, { 0x04B0, 0xA14D, 0x2A5F }, { 0xB1CB, 0xB5DB, 0xCCF8 }, { 0x7857, 0xA63D, 0xABFC },
+  { 0x4B1D, 0x5B95, 0xD678 }, { 0x8281, 0x4873, 0xB17C }, { 0x37FA, 0x5CE5, 0x57DB }, { 0xFE66, 0x4F03, 0x30DF },
+  { 0x3C8A, 0xFC79, 0xD171 }, { 0xF516, 0xEF9F, 0xB675 }, { 0x406D, 0xFB09, 0x50D2 }, { 0x89F1, 0xE8EF, 0x37D6 },
+  { 0x0352, 0x74C8, 0x5D80 }, { 0xCACE, 0x672E, 0x3A84 }, { 0x7FB5, 0x73B8, 0xDC23 }, { 0xB629, 0x605E, 0xBB27 },
+  { 0x74C5, 0xD324, 0x5A89 }, { 0xBD59, 0xC0C2, 0x3D8D }, { 0x0822, 0xD454, 0xDB2A }, { 0xC1BE, 0xC7B2, 0xBC2E },
+  { 0x3426, 0xF315, 0xEB62 }, { 0xFDBA, 0xE0F3, 0x8C66 }, { 0x48C1, 0xF465, 0x6AC1 }, { 0x815D, 0xE783, 0x0DC5 },
+  { 0x43B1, 0x54F9, 0xEC6B }, { 0x8A2D, 0x471F, 0x8B6F }, { 0x3F56, 0x5389, 0x6DC8 }, { 0xF6CA, 0x406F, 0x0ACC },
+  { 0x7C69, 0xDC48, 0x609A }, { 0xB5F5, 0xCFAE, 0x079E }, { 0x008E, 0xDB38, 0xE139 }, { 0xC912, 0xC8DE, 0x863D },
+  { 0x0BFE, 0x7BA4, 0x6793 }, { 0xC262, 0x6842, 0x0097 }, { 0x7719, 0x7CD4, 0xE630 }, { 0xBE85, 0x6F32, 0x8134 },
+  { 0x56E5, 0x12F8, 0xCDAE }, { 0x9F79, 0x011E, 0xAAAA }, { 0x2A02, 0x1588, 0x4C0D }, { 0xE39E, 0x066E, 0x2B09 },
+  { 0x2172, 0xB514, 0xCAA7 }, { 0xE8EE, 0xA6F2, 0xADA3 }, { 0x5D95, 0xB264, 0x4B04 }, { 0x9409, 0xA182, 0x2C00 },
+  { 0x1EAA, 0x3DA5, 0x4656 }, { 0xD736, 0x2E43, 0x2152 }, { 0x624D, 0x3AD5, 0xC7F5 }, { 0xABD1, 0x2933, 0xA0F1 },
+  { 0x693D, 0x9A49, 0x415F }, { 0xA0A1, 0x89AF, 0x265B }, { 0x15DA, 0x9D39, 0xC0FC }, { 0xDC46, 0x8EDF, 0xA7F8 },
+  { 0x29DE, 0xBA78, 0xF0B4 }, { 0xE042, 0xA99E, 0x97B0 }, { 0x5539, 0xBD08, 0x7117 }, { 0x9CA5, 0xAEEE, 0x1613 },
+  { 0x5E49, 0x1D94, 0xF7BD }, { 0x97D5, 0x0E72, 0x90B9 }, { 0x22AE, 0x1AE4, 0x761E }, { 0xEB32, 0x0902, 0x111A },
+  { 0x6191, 0x9525, 0x7B4C }, { 0xA80D, 0x86C3, 0x1C48 }, { 0x1D76, 0x9255, 0xFAEF }, { 0xD4EA, 0x81B3, 0x9DEB },
+  { 0x1606, 0x32C9, 0x7C45 }, { 0xDF9A, 0x212F, 0x1B41 }, { 0x6AE1, 0x35B9, 0xFDE6 }, { 0xA37D, 0x265F, 0x9AE2 },
+  { 0x9037, 0xDBF7, 0xE766 }, { 0x59AB, 0xC811, 0x8062 }, { 0xECD0, 0xDC87, 0x66C5 }, { 0x254C, 0xCF61, 0x01C1 },
+  { 0xE7A0, 0x7C1B, 0xE06F }, { 0x2E3C, 0x6FFD, 0x876B }, { 0x9B47, 0x7B6B, 0x61CC }, { 0x52DB, 0x688D, 0x06C8 },
+  { 0xD878, 0xF4AA, 0x6C9E }, { 0x11E4, 0xE74C, 0x0B9A }, { 0xA49F, 0xF3DA, 0xED3D }, { 0x6D03, 0xE03C, 0x8A39 },
+  { 0xAFEF, 0x5346, 0x6B97 }, { 0x6673, 0x40A0, 0x0C93 }, { 0xD308, 0x5436, 0xEA34 }, { 0x1A94, 0x47D0, 0x8D30 },
+  { 0xEF0C, 0x7377, 0xDA7C }, { 0x2690, 0x6091, 0xBD78 }, { 0x93EB, 0x7407, 0x5BDF }, { 0x5A77, 0x67E1, 0x3CDB },
+  { 0x989B, 0xD49B, 0xDD75 }, { 0x5107, 0xC77D, 0xBA71 }, { 0xE47C, 0xD3EB, 0x5CD6 }, { 0x2DE0, 0xC00D, 0x3BD2 },
+  { 0xA743, 0x5C2A, 0x5184 }, { 0x6EDF, 0x4FCC, 0x3680 }, { 0xDBA4, 0x5B5A, 0xD027 }, { 0x1238, 0x48BC, 0xB723 },
+  { 0xD0D4, 0xFBC6, 0x568D }, { 0x1948, 0xE820, 0x3189 }, { 0xAC33, 0xFCB6, 0xD72E }, { 0x65AF, 0xEF50, 0xB02A },
+  { 0xDB2A, 0x8062, 0x311E }, { 0x12B6, 0x9384, 0x561A }, { 0xA7CD, 0x8712, 0xB0BD }, { 0x6E51, 0x94F4, 0xD7B9 },
+  { 0xACBD, 0x278E, 0x3617 }, { 0x6521, 0x3468, 0x5113 }, { 0xD05A, 0x20FE, 0xB7B4 }, { 0x19C6, 0x3318, 0xD0B0 },
+  { 0x9365, 0xAF3F, 0xBAE6 }, { 0x5AF9, 0xBCD9, 0xDDE2 }, { 0xEF82, 0xA84F, 0x3B45 }, { 0x261E, 0xBBA9, 0x5C41 },
+  { 0xE4F2, 0x08D3, 0xBDEF }, { 0x2D6E, 0x1B35, 0xDAEB }, { 0x9815, 0x0FA3, 0x3C4C }, { 0x5189, 0x1C45, 0x5B48 },
+  { 0xA411, 0x28E2, 0x0C04 }, { 0x6D8D, 0x3B04, 0x6B00 }, { 0xD8F6, 0x2F92, 0x8DA7 }, { 0x116A, 0x3C74, 0xEAA3 },
+  { 0xD386, 0x8F0E, 0x0B0D }, { 0x1A1A, 0x9CE8, 0x6C09 }, { 0xAF61, 0x887E, 0x8AAE }, { 0x66FD, 0x9B98, 0xEDAA },
+  { 0xEC5E, 0x07BF, 0x87FC }, { 0x25C2, 0x1459, 0xE0F8 }, { 0x90B9, 0x00CF, 0x065F }, { 0x5925, 0x1329, 0x615B },
+  { 0x9BC9, 0xA053, 0x80F5 }, { 0x5255, 0xB3B5, 0xE7F1 }, { 0xE72E, 0xA723, 0x0156 }, { 0x2EB2, 0xB4C5, 0x6652 },
+  { 0x1DF8, 0x496D, 0x1BD6 }, { 0xD464, 0x5A8B, 0x7CD2 }, { 0x611F, 0x4E1D, 0x9A75 }, { 0xA883, 0x5DFB, 0xFD71 },
+  { 0x6A6F, 0xEE81, 0x1CDF }, { 0xA3F3, 0xFD67, 0x7BDB }, { 0x1688, 0xE9F1, 0x9D7C }, { 0xDF14, 0xFA17, 0xFA78 },
+  { 0x55B7, 0x6630, 0x902E }, { 0x9C2B, 0x75D6, 0xF72A }, { 0x2950, 0x6140, 0x118D }, { 0xE0CC, 0x72A6, 0x7689 },
+  { 0x2220, 0xC1DC, 0x9727 }, { 0xEBBC, 0xD23A, 0xF023 }, { 0x5EC7, 0xC6AC, 0x1684 }, { 0x975B, 0xD54A, 0x7180 },
+  { 0x62C3, 0xE1ED, 0x26CC }, { 0xAB5F, 0xF20B, 0x41C8 }, { 0x1E24, 0xE69D, 0xA76F }, { 0xD7B8, 0xF57B, 0xC06B },
+  { 0x1554, 0x4601, 0x21C5 }, { 0xDCC8, 0x55E7, 0x46C1 }, { 0x69B3, 0x4171, 0xA066 }, { 0xA02F, 0x5297, 0xC762 },
+  { 0x2A8C, 0xCEB0, 0xAD34 }, { 0xE310, 0xDD56, 0xCA30 }, { 0x566B, 0xC9C0, 0x2C97 }, { 0x9FF7, 0xDA26, 0x4B93 },
+  { 0x5D1B, 0x695C, 0xAA3D }, { 0x9487, 0x7ABA, 0xCD39 }, { 0x21FC, 0x6E2C, 0x2B9E }, { 0xE860, 0x7DCA, 0x4C9A }
+ },
+ {  // byte 15
+  { 0x0000, 0x0000, 0x0000 }, { 0xC681, 0xE76F, 0x2B59 }, { 0x9CD1, 0xB7FA, 0xEFAC }, { 0x5A50, 0x5095, 0xC4F5 },
+  { 0x9DA9, 0xC6BF, 0x3643 }, { 0x5B28, 0x21D0, 0x1D1A }, { 0x0178, 0x7145, 0xD9EF }, { 0xC7F9, 0x962A, 0xF2B6 },
+  { 0xC5A5, 0x1DB3, 0xDD6E }, { 0x0324, 0xFADC, 0xF637 }, { 0x5974, 0xAA49, 0x32C2 }, { 0x9FF5, 0x4D26, 0x199B },
+  { 0x580C, 0xDB0C, 0xEB2D }, { 0x9E8D, 0x3C63, 0xC074 }, { 0xC4DD, 0x6CF6, 0x0481 }, { 0x025C, 0x8B99, 0x2FD8 },
+  { 0xC1FA, 0x54DB, 0xFD77 }, { 0x077B, 0xB3B4, 0xD62E }, { 0x5D2B, 0xE321, 0x12DB }, { 0x9BAA, 0x044E, 0x3982 },
+  { 0x5C53, 0x9264, 0xCB34 }, { 0x9AD2, 0x750B, 0xE06D }, { 0xC082, 0x259E, 0x2498 }, { 0x0603, 0xC2F1, 0x0FC1 },
+  { 0x045F, 0x4968, 0x2019 }, { 0xC2DE, 0xAE07, 0x0B40 }, { 0x988E, 0xFE92, 0xCFB5 }, { 0x5E0F, 0x19FD, 0xE4EC },
+  { 0x99F6, 0x8FD7, 0x165A }, { 0x5F77, 0x68B8, 0x3D03 }, { 0x0527, 0x382D, 0xF9F6 }, { 0xC3A6, 0xDF42, 0xD2AF },
+  { 0x98CB, 0x9A57, 0x4C90 }, { 0x5E4A, 0x7D38, 0x67C9 }, { 0x041A, 0x2DAD, 0xA33C }, { 0xC29B, 0xCAC2, 0x8865 },
+  { 0x0562, 0x5CE8, 0x7AD3 }, { 0xC3E3, 0xBB87, 0x518A }, { 0x99B3, 0xEB12, 0x957F }, { 0x5F32, 0x0C7D, 0xBE26 },
+  { 0x5D6E, 0x87E4, 0x91FE }, { 0x9BEF, 0x608B, 0xBAA7 }, { 0xC1BF, 0x301E, 0x7E52 }, { 0x073E, 0xD771, 0x550B },
+  { 0xC0C7, 0x415B, 0xA7BD }, { 0x0646, 0xA634, 0x8CE4 }, { 0x5C16, 0xF6A1, 0x4811 }, { 0x9A97, 0x11CE, 0x6348 },
+  { 0x5931, 0xCE8C, 0xB1E7 }, { 0x9FB0, 0x29E3, 0x9ABE }, { 0xC5E0, 0x7976, 0x5E4B }, { 0x0361, 0x9E19, 0x7512 },
+  { 0xC498, 0x0833, 0x87A4 }, { 0x0219, 0xEF5C, 0xACFD }, { 0x5849, 0xBFC9, 0x6808 }, { 0x9EC8, 0x58A6, 0x4351 },
+  { 0x9C94, 0xD33F, 0x6C89 }, { 0x5A15, 0x3450, 0x47D0 }, { 0x0045, 0x64C5, 0x8325 }, { 0xC6C4, 0x83AA, 0xA87C },
+  { 0x013D, 0x1580, 0x5ACA }, { 0xC7BC, 0xF2EF, 0x7193 }, { 0x9DEC, 0xA27A, 0xB566 }, { 0x5B6D, 0x4515, 0x9E3F },
+  { 0x3FDC, 0x27F0, 0xBDB9 }, { 0xF95D, 0xC09F, 0x96E0 }, { 0xA30D, 0x900A, 0x5215 }, { 0x658C, 0x7765, 0x794C },
+  { 0xA275, 0xE14F, 0x8BFA }, { 0x64F4, 0x0620, 0xA0A3 }, { 0x3EA4, 0x56B5, 0x6456 }, { 0xF825, 0xB1DA, 0x4F0F },
+  { 0xFA79, 0x3A43, 0x60D7 }, { 0x3CF8, 0xDD2C, 0x4B8E }, { 0x66A8, 0x8DB9, 0x8F7B }, { 0xA029, 0x6AD6, 0xA422 },
+  { 0x67D0, 0xFCFC, 0x5694 }, { 0xA151, 0x1B93, 0x7DCD }, { 0xFB01, 0x4B06, 0xB938 }, { 0x3D80, 0xAC69, 0x9261 },
+  { 0xFE26, 0x732B, 0x40CE }, { 0x38A7, 0x9444, 0x6B97 }, { 0x62F7, 0xC4D1, 0xAF62 }, { 0xA476, 0x23BE, 0x843B },
+  { 0x638F, 0xB594, 0x768D }, { 0xA50E, 0x52FB, 0x5DD4 }, { 0xFF5E, 0x026E, 0x9921 }, { 0x39DF, 0xE501, 0xB278 },
+  { 0x3B83, 0x6E98, 0x9DA0 }, { 0xFD02, 0x89F7, 0xB6F9 }, { 0xA752, 0xD962, 0x720C }, { 0x61D3, 0x3E0D, 0x5955 },
+  { 0xA62A, 0xA827, 0xABE3 }, { 0x60AB, 0x4F48, 0x80BA }, { 0x3AFB, 0x1FDD, 0x444F }, { 0xFC7A, 0xF8B2, 0x6F16 },
+  { 0xA717, 0xBDA7, 0xF129 }, { 0x6196, 0x5AC8, 0xDA70 }, { 0x3BC6, 0x0A5D, 0x1E85 }, { 0xFD47, 0xED32, 0x35DC },
+  { 0x3ABE, 0x7B18, 0xC76A }, { 0xFC3F, 0x9C77, 0xEC33 }, { 0xA66F, 0xCCE2, 0x28C6 }, { 0x60EE, 0x2B8D, 0x039F },
+  { 0x62B2, 0xA014, 0x2C47 }, { 0xA433, 0x477B, 0x071E }, { 0xFE63, 0x17EE, 0xC3EB }, { 0x38E2, 0xF081, 0xE8B2 },
+  { 0xFF1B, 0x66AB, 0x1A04 }, { 0x399A, 0x81C4, 0x315D }, { 0x63CA, 0xD151, 0xF5A8 }, { 0xA54B, 0x363E, 0xDEF1 },
+  { 0x66ED, 0xE97C, 0x0C5E }, { 0xA06C, 0x0E13, 0x2707 }, { 0xFA3C, 0x5E86, 0xE3F2 }, { 0x3CBD, 0xB9E9, 0xC8AB },
+  { 0xFB44, 0x2FC3, 0x3A1D }, { 0x3DC5, 0xC8AC, 0x1144 }, { 0x6795, 0x9839, 0xD5B1 }, { 0xA114, 0x7F56, 0xFEE8 },
+  { 0xA348, 0xF4CF, 0xD130 }, { 0x65C9, 0x13A0, 0xFA69 }, { 0x3F99, 0x4335, 0x3E9C }, { 0xF918, 0xA45A, 0x15C5 },
+  { 0x3EE1, 0x3270, 0xE773 }, { 0xF860, 0xD51F, 0xCC2A }, { 0xA230, 0x858A, 0x08DF }, { 0x64B1, 0x62E5, 0x2386 },
+  { 0xACB2, 0x83CF, 0x3702 }, { 0x6A33, 0x64A0, 0x1C5B }, { 0x3063, 0x3435, 0xD8AE }, { 0xF6E2, 0xD35A, 0xF3F7 },
+  { 0x311B, 0x4570, 0x0141 }, { 0xF79A, 0xA21F, 0x2A18 }, { 0xADCA, 0xF28A, 0xEEED }, { 0x6B4B, 0x15E5, 0xC5B4 },
+  { 0x6917, 0x9E7C, 0xEA6C }, { 0xAF96, 0x7913, 0xC135 }, { 0xF5C6, 0x2986, 0x05C0 }, { 0x3347, 0xCEE9, 0x2E99 },
+  { 0xF4BE, 0x58C3, 0xDC2F }, { 0x323F, 0xBFAC, 0xF776 }, { 0x686F, 0xEF39, 0x3383 }, { 0xAEEE, 0x0856, 0x18DA },
+  { 0x6D48, 0xD714, 0xCA75 }, { 0xABC9, 0x307B, 0xE12C }, { 0xF199, 0x60EE, 0x25D9 }, { 0x3718, 0x8781, 0x0E80 },
+  { 0xF0E1, 0x11AB, 0xFC36 }, { 0x3660, 0xF6C4, 0xD76F }, { 0x6C30, 0xA651, 0x139A }, { 0xAAB1, 0x413E, 0x38C3 },
+  { 0xA8ED, 0xCAA7, 0x171B }, { 0x6E6C, 0x2DC8, 0x3C42 }, { 0x343C, 0x7D5D, 0xF8B7 }, { 0xF2BD, 0x9A32, 0xD3EE },
+  { 0x3544, 0x0C18, 0x2158 }, { 0xF3C5, 0xEB77, 0x0A01 }, { 0xA995, 0xBBE2, 0xCEF4 }, { 0x6F14, 0x5C8D, 0xE5AD },
+  { 0x3479, 0x1998, 0x7B92 }, { 0xF2F8, 0xFEF7, 0x50CB }, { 0xA8A8, 0xAE62, 0x943E }, { 0x6E29, 0x490D, 0xBF67 },
+  { 0xA9D0, 0xDF27, 0x4DD1 }, { 0x6F51, 0x3848, 0x6688 }, { 0x3501, 0x68DD, 0xA27D }, { 0xF380, 0x8FB2, 0x8924 },
+  { 0xF1DC, 0x042B, 0xA6FC }, { 0x375D, 0xE344, 0x8DA5 }, { 0x6D0D, 0xB3D1, 0x4950 }, { 0xAB8C, 0x54BE, 0x6209 },
+  { 0x6C75, 0xC294, 0x90BF }, { 0xAAF4, 0x25FB, 0xBBE6 }, { 0xF0A4, 0x756E, 0x7F13 }, { 0x3625, 0x9201, 0x544A },
+  { 0xF583, 0x4D43, 0x86E5 }, { 0x3302, 0xAA2C, 0xADBC }, { 0x6952, 0xFAB9, 0x6949 }, { 0xAFD3, 0x1DD6, 0x4210 },
+  { 0x682A, 0x8BFC, 0xB0A6 }, { 0xAEAB, 0x6C93, 0x9BFF }, { 0xF4FB, 0x3C06, 0x5F0A }, { 0x327A, 0xDB69, 0x7453 },
+  { 0x3026, 0x50F0, 0x5B8B }, { 0xF6A7, 0xB79F, 0x70D2 }, { 0xACF7, 0xE70A, 0xB427 }, { 0x6A76, 0x0065, 0x9F7E },
+  { 0xAD8F, 0x964F, 0x6DC8 }, { 0x6B0E, 0x7120, 0x4691 }, { 0x315E, 0x21B5, 0x8264 }, { 0xF7DF, 0xC6DA, 0xA93D },
+  { 0x936E, 0xA43F, 0x8ABB }, { 0x55EF, 0x4350, 0xA1E2 }, { 0x0FBF, 0x13C5, 0x6517 }, { 0xC93E, 0xF4AA, 0x4E4E },
+  { 0x0EC7, 0x6280, 0xBCF8 }, { 0xC846, 0x85EF, 0x97A1 }, { 0x9216, 0xD57A, 0x5354 }, { 0x5497, 0x3215, 0x780D },
+  { 0x56CB, 0xB98C, 0x57D5 }, { 0x904A, 0x5EE3, 0x7C8C }, { 0xCA1A, 0x0E76, 0xB879 }, { 0x0C9B, 0xE919, 0x9320 },
+  { 0xCB62, 0x7F33, 0x6196 }, { 0x0DE3, 0x985C, 0x4ACF }, { 0x57B3, 0xC8C9, 0x8E3A }, { 0x9132, 0x2FA6, 0xA563 },
+  { 0x5294, 0xF0E4, 0x77CC }, { 0x9415, 0x178B, 0x5C95 }, { 0xCE45, 0x471E, 0x9860 }, { 0x08C4, 0xA071, 0xB339 },
+  { 0xCF3D, 0x365B, 0x418F }, { 0x09BC, 0xD134, 0x6AD6 }, { 0x53EC, 0x81A1, 0xAE23 }, { 0x956D, 0x66CE, 0x857A },
+  { 0x9731, 0xED57, 0xAAA2 }, { 0x51B0, 0x0A38, 0x81FB }, { 0x0BE0, 0x5AAD, 0x450E }, { 0xCD61, 0xBDC2, 0x6E57 },
+  { 0x0A98, 0x2BE8, 0x9CE1 }, { 0xCC19, 0xCC87, 0xB7B8 }, { 0x9649, 0x9C12, 0x734D }, { 0x50C8, 0x7B7D, 0x5814 },
+  { 0x0BA5, 0x3E68, 0xC62B }, { 0xCD24, 0xD907, 0xED72 }, { 0x9774, 0x8992, 0x2987 }, { 0x51F5, 0x6EFD, 0x02DE },
+  { 0x960C, 0xF8D7, 0xF068 }, { 0x508D, 0x1FB8, 0xDB31 }, { 0x0ADD, 0x4F2D, 0x1FC4 }, { 0xCC5C, 0xA842, 0x349D },
+  { 0xCE00, 0x23DB, 0x1B45 }, { 0x0881, 0xC4B4, 0x301C }, { 0x52D1, 0x9421, 0xF4E9 }, { 0x9450, 0x734E, 0xDFB0 },
+  { 0x53A9, 0xE564, 0x2D06 }, { 0x9528, 0x020B, 0x065F }, { 0xCF78, 0x529E, 0xC2AA }, { 0x09F9, 0xB5F1, 0xE9F3 },
+  { 0xCA5F, 0x6AB3, 0x3B5C }, { 0x0CDE, 0x8DDC, 0x1005 }, { 0x568E, 0xDD49, 0xD4F0 }, { 0x900F, 0x3A26, 0xFFA9 },
+  { 0x57F6, 0xAC0C, 0x0D1F }, { 0x9177, 0x4B63, 0x2646 }, { 0xCB27, 0x1BF6, 0xE2B3 }, { 0x0DA6, 0xFC99, 0xC9EA },
+  { 0x0FFA, 0x7700, 0xE632 }, { 0xC97B, 0x906F, 0xCD6B }, { 0x932B, 0xC0FA, 0x099E }, { 0x55AA, 0x2795, 0x22C7 },
+  { 0x9253, 0xB1BF, 0xD071 }, { 0x54D2, 0x56D0, 0xFB28 }, { 0x0E82, 0x0645, 0x3FDD }, { 0xC803, 0xE12A, 0x1484 }
+ },
+ {  // byte 16
+  { 0x0000, 0x0000, 0x0000 }, { 0x1474, 0x9914, 0xCBA7 }, { 0x5A00, 0xDEF4, 0xC476 }, { 0x4E74, 0x47E0, 0x0FD1 },
+  { 0xB68D, 0x337B, 0xE02C }, { 0xA2F9, 0xAA6F, 0x2B8B }, { 0xEC8D, 0xED8F, 0x245A }, { 0xF8F9, 0x749B, 0xEFFD },
+  { 0x233E, 0xBFD5, 0xD71F }, { 0x374A, 0x26C1, 0x1CB8 }, { 0x793E, 0x6121, 0x1369 }, { 0x6D4A, 0xF835, 0xD8CE },
+  { 0x95B3, 0x8CAE, 0x3733 }, { 0x81C7, 0x15BA, 0xFC94 }, { 0xCFB3, 0x525A, 0xF345 }, { 0xDBC7, 0xCB4E, 0x38E2 },
+  { 0xE623, 0x0772, 0xB12B }, { 0xF257, 0x9E66, 0x7A8C }, { 0xBC23, 0xD986, 0x755D }, { 0xA857, 0x4092, 0xBEFA },
+  { 0x50AE, 0x3409, 0x5107 }, { 0x44DA, 0xAD1D, 0x9AA0 }, { 0x0AAE, 0xEAFD, 0x9571 }, { 0x1EDA, 0x73E9, 0x5ED6 },
+  { 0xC51D, 0xB8A7, 0x6634 }, { 0xD169, 0x21B3, 0xAD93 }, { 0x9F1D, 0x6653, 0xA242 }, { 0x8B69, 0xFF47, 0x69E5 },
+  { 0x7390, 0x8BDC, 0x8618 }, { 0x67E4, 0x12C8, 0x4DBF }, { 0x2990, 0x5528, 0x426E }, { 0x3DE4, 0xCC3C, 0x89C9 },
+  { 0x10B4, 0x3F65, 0x4B0E }, { 0x04C0, 0xA671, 0x80A9 }, { 0x4AB4, 0xE191, 0x8F78 }, { 0x5EC0, 0x7885, 0x44DF },
+  { 0xA639, 0x0C1E, 0xAB22 }, { 0xB24D, 0x950A, 0x6085 }, { 0xFC39, 0xD2EA, 0x6F54 }, { 0xE84D, 0x4BFE, 0xA4F3 },
+  { 0x338A, 0x80B0, 0x9C11 }, { 0x27FE, 0x19A4, 0x57B6 }, { 0x698A, 0x5E44, 0x5867 }, { 0x7DFE, 0xC750, 0x93C0 },
+  { 0x8507, 0xB3CB, 0x7C3D }, { 0x9173, 0x2ADF, 0xB79A }, { 0xDF07, 0x6D3F, 0xB84B }, { 0xCB73, 0xF42B, 0x73EC },
+  { 0xF697, 0x3817, 0xFA25 }, { 0xE2E3, 0xA103, 0x3182 }, { 0xAC97, 0xE6E3, 0x3E53 }, { 0xB8E3, 0x7FF7, 0xF5F4 },
+  { 0x401A, 0x0B6C, 0x1A09 }, { 0x546E, 0x9278, 0xD1AE }, { 0x1A1A, 0xD598, 0xDE7F }, { 0x0E6E, 0x4C8C, 0x15D8 },
+  { 0xD5A9, 0x87C2, 0x2D3A }, { 0xC1DD, 0x1ED6, 0xE69D }, { 0x8FA9, 0x5936, 0xE94C }, { 0x9BDD, 0xC022, 0x22EB },
+  { 0x6324, 0xB4B9, 0xCD16 }, { 0x7750, 0x2DAD, 0x06B1 }, { 0x3924, 0x6A4D, 0x0960 }, { 0x2D50, 0xF359, 0xC2C7 },
+  { 0x71DF, 0xEE11, 0x83E8 }, { 0x65AB, 0x7705, 0x484F }, { 0x2BDF, 0x30E5, 0x479E }, { 0x3FAB, 0xA9F1, 0x8C39 },
+  { 0xC752, 0xDD6A, 0x63C4 }, { 0xD326, 0x447E, 0xA863 }, { 0x9D52, 0x039E, 0xA7B2 }, { 0x8926, 0x9A8A, 0x6C15 },
+  { 0x52E1, 0x51C4, 0x54F7 }, { 0x4695, 0xC8D0, 0x9F50 }, { 0x08E1, 0x8F30, 0x9081 }, { 0x1C95, 0x1624, 0x5B26 },
+  { 0xE46C, 0x62BF, 0xB4DB }, { 0xF018, 0xFBAB, 0x7F7C }, { 0xBE6C, 0xBC4B, 0x70AD }, { 0xAA18, 0x255F, 0xBB0A },
+  { 0x97FC, 0xE963, 0x32C3 }, { 0x8388, 0x7077, 0xF964 }, { 0xCDFC, 0x3797, 0xF6B5 }, { 0xD988, 0xAE83, 0x3D12 },
+  { 0x2171, 0xDA18, 0xD2EF }, { 0x3505, 0x430C, 0x1948 }, { 0x7B71, 0x04EC, 0x1699 }, { 0x6F05, 0x9DF8, 0xDD3E },
+  { 0xB4C2, 0x56B6, 0xE5DC }, { 0xA0B6, 0xCFA2, 0x2E7B }, { 0xEEC2, 0x8842, 0x21AA }, { 0xFAB6, 0x1156, 0xEA0D },
+  { 0x024F, 0x65CD, 0x05F0 }, { 0x163B, 0xFCD9, 0xCE57 }, { 0x584F, 0xBB39, 0xC186 }, { 0x4C3B, 0x222D, 0x0A21 },
+  { 0x616B, 0xD174, 0xC8E6 }, { 0x751F, 0x4860, 0x0341 }, { 0x3B6B, 0x0F80, 0x0C90 }, { 0x2F1F, 0x9694, 0xC737 },
+  { 0xD7E6, 0xE20F, 0x28CA }, { 0xC392, 0x7B1B, 0xE36D }, { 0x8DE6, 0x3CFB, 0xECBC }, { 0x9992, 0xA5EF, 0x271B },
+  { 0x4255, 0x6EA1, 0x1FF9 }, { 0x5621, 0xF7B5, 0xD45E }, { 0x1855, 0xB055, 0xDB8F }, { 0x0C21, 0x2941, 0x1028 },
+  { 0xF4D8, 0x5DDA, 0xFFD5 }, { 0xE0AC, 0xC4CE, 0x3472 }, { 0xAED8, 0x832E, 0x3BA3 }, { 0xBAAC, 0x1A3A, 0xF004 },
+  { 0x8748, 0xD606, 0x79CD }, { 0x933C, 0x4F12, 0xB26A }, { 0xDD48, 0x08F2, 0xBDBB }, { 0xC93C, 0x91E6, 0x761C },
+  { 0x31C5, 0xE57D, 0x99E1 }, { 0x25B1, 0x7C69, 0x5246 }, { 0x6BC5, 0x3B89, 0x5D97 }, { 0x7FB1, 0xA29D, 0x9630 },
+  { 0xA476, 0x69D3, 0xAED2 }, { 0xB002, 0xF0C7, 0x6575 }, { 0xFE76, 0xB727, 0x6AA4 }, { 0xEA02, 0x2E33, 0xA103 },
+  { 0x12FB, 0x5AA8, 0x4EFE }, { 0x068F, 0xC3BC, 0x8559 }, { 0x48FB, 0x845C, 0x8A88 }, { 0x5C8F, 0x1D48, 0x412F },
+  { 0xB42B, 0x9D97, 0xE527 }, { 0xA05F, 0x0483, 0x2E80 }, { 0xEE2B, 0x4363, 0x2151 }, { 0xFA5F, 0xDA77, 0xEAF6 },
+  { 0x02A6, 0xAEEC, 0x050B }, { 0x16D2, 0x37F8, 0xCEAC }, { 0x58A6, 0x7018, 0xC17D }, { 0x4CD2, 0xE90C, 0x0ADA },
+  { 0x9715, 0x2242, 0x3238 }, { 0x8361, 0xBB56, 0xF99F }, { 0xCD15, 0xFCB6, 0xF64E }, { 0xD961, 0x65A2, 0x3DE9 },
+  { 0x2198, 0x1139, 0xD214 }, { 0x35EC, 0x882D, 0x19B3 }, { 0x7B98, 0xCFCD, 0x1662 }, { 0x6FEC, 0x56D9, 0xDDC5 },
+  { 0x5208, 0x9AE5, 0x540C }, { 0x467C, 0x03F1, 0x9FAB }, { 0x0808, 0x4411, 0x907A }, { 0x1C7C, 0xDD05, 0x5BDD },
+  { 0xE485, 0xA99E, 0xB420 }, { 0xF0F1, 0x308A, 0x7F87 }, { 0xBE85, 0x776A, 0x7056 }, { 0xAAF1, 0xEE7E, 0xBBF1 },
+  { 0x7136, 0x2530, 0x8313 }, { 0x6542, 0xBC24, 0x48B4 }, { 0x2B36, 0xFBC4, 0x4765 }, { 0x3F42, 0x62D0, 0x8CC2 },
+  { 0xC7BB, 0x164B, 0x633F }, { 0xD3CF, 0x8F5F, 0xA898 }, { 0x9DBB, 0xC8BF, 0xA749 }, { 0x89CF, 0x51AB, 0x6CEE },
+  { 0xA49F, 0xA2F2, 0xAE29 }, { 0xB0EB, 0x3BE6, 0x658E }, { 0xFE9F, 0x7C06, 0x6A5F }, { 0xEAEB, 0xE512, 0xA1F8 },
+  { 0x1212, 0x9189, 0x4E05 }, { 0x0666, 0x089D, 0x85A2 }, { 0x4812, 0x4F7D, 0x8A73 }, { 0x5C66, 0xD669, 0x41D4 },
+  { 0x87A1, 0x1D27, 0x7936 }, { 0x93D5, 0x8433, 0xB291 }, { 0xDDA1, 0xC3D3, 0xBD40 }, { 0xC9D5, 0x5AC7, 0x76E7 },
+  { 0x312C, 0x2E5C, 0x991A }, { 0x2558, 0xB748, 0x52BD }, { 0x6B2C, 0xF0A8, 0x5D6C }, { 0x7F58, 0x69BC, 0x96CB },
+  { 0x42BC, 0xA580, 0x1F02 }, { 0x56C8, 0x3C94, 0xD4A5 }, { 0x18BC, 0x7B74, 0xDB74 }, { 0x0CC8, 0xE260, 0x10D3 },
+  { 0xF431, 0x96FB, 0xFF2E }, { 0xE045, 0x0FEF, 0x3489 }, { 0xAE31, 0x480F, 0x3B58 }, { 0xBA45, 0xD11B, 0xF0FF },
+  { 0x6182, 0x1A55, 0xC81D }, { 0x75F6, 0x8341, 0x03BA }, { 0x3B82, 0xC4A1, 0x0C6B }, { 0x2FF6, 0x5DB5, 0xC7CC },
+  { 0xD70F, 0x292E, 0x2831 }, { 0xC37B, 0xB03A, 0xE396 }, { 0x8D0F, 0xF7DA, 0xEC47 }, { 0x997B, 0x6ECE, 0x27E0 },
+  { 0xC5F4, 0x7386, 0x66CF }, { 0xD180, 0xEA92, 0xAD68 }, { 0x9FF4, 0xAD72, 0xA2B9 }, { 0x8B80, 0x3466, 0x691E },
+  { 0x7379, 0x40FD, 0x86E3 }, { 0x670D, 0xD9E9, 0x4D44 }, { 0x2979, 0x9E09, 0x4295 }, { 0x3D0D, 0x071D, 0x8932 },
+  { 0xE6CA, 0xCC53, 0xB1D0 }, { 0xF2BE, 0x5547, 0x7A77 }, { 0xBCCA, 0x12A7, 0x75A6 }, { 0xA8BE, 0x8BB3, 0xBE01 },
+  { 0x5047, 0xFF28, 0x51FC }, { 0x4433, 0x663C, 0x9A5B }, { 0x0A47, 0x21DC, 0x958A }, { 0x1E33, 0xB8C8, 0x5E2D },
+  { 0x23D7, 0x74F4, 0xD7E4 }, { 0x37A3, 0xEDE0, 0x1C43 }, { 0x79D7, 0xAA00, 0x1392 }, { 0x6DA3, 0x3314, 0xD835 },
+  { 0x955A, 0x478F, 0x37C8 }, { 0x812E, 0xDE9B, 0xFC6F }, { 0xCF5A, 0x997B, 0xF3BE }, { 0xDB2E, 0x006F, 0x3819 },
+  { 0x00E9, 0xCB21, 0x00FB }, { 0x149D, 0x5235, 0xCB5C }, { 0x5AE9, 0x15D5, 0xC48D }, { 0x4E9D, 0x8CC1, 0x0F2A },
+  { 0xB664, 0xF85A, 0xE0D7 }, { 0xA210, 0x614E, 0x2B70 }, { 0xEC64, 0x26AE, 0x24A1 }, { 0xF810, 0xBFBA, 0xEF06 },
+  { 0xD540, 0x4CE3, 0x2DC1 }, { 0xC134, 0xD5F7, 0xE666 }, { 0x8F40, 0x9217, 0xE9B7 }, { 0x9B34, 0x0B03, 0x2210 },
+  { 0x63CD, 0x7F98, 0xCDED }, { 0x77B9, 0xE68C, 0x064A }, { 0x39CD, 0xA16C, 0x099B }, { 0x2DB9, 0x3878, 0xC23C },
+  { 0xF67E, 0xF336, 0xFADE }, { 0xE20A, 0x6A22, 0x3179 }, { 0xAC7E, 0x2DC2, 0x3EA8 }, { 0xB80A, 0xB4D6, 0xF50F },
+  { 0x40F3, 0xC04D, 0x1AF2 }, { 0x5487, 0x5959, 0xD155 }, { 0x1AF3, 0x1EB9, 0xDE84 }, { 0x0E87, 0x87AD, 0x1523 },
+  { 0x3363, 0x4B91, 0x9CEA }, { 0x2717, 0xD285, 0x574D }, { 0x6963, 0x9565, 0x589C }, { 0x7D17, 0x0C71, 0x933B },
+  { 0x85EE, 0x78EA, 0x7CC6 }, { 0x919A, 0xE1FE, 0xB761 }, { 0xDFEE, 0xA61E, 0xB8B0 }, { 0xCB9A, 0x3F0A, 0x7317 },
+  { 0x105D, 0xF444, 0x4BF5 }, { 0x0429, 0x6D50, 0x8052 }, { 0x4A5D, 0x2AB0, 0x8F83 }, { 0x5E29, 0xB3A4, 0x4424 },
+  { 0xA6D0, 0xC73F, 0xABD9 }, { 0xB2A4, 0x5E2B, 0x607E }, { 0xFCD0, 0x19CB, 0x6FAF }, { 0xE8A4, 0x80DF, 0xA408 }
+ },
+ {  // byte 17
+  { 0x0000, 0x0000, 0x0000 }, { 0x1908, 0x6B60, 0x12CB }, { 0x6138, 0xB649, 0x621E }, { 0x7830, 0xDD29, 0x70D5 },
+  { 0x38B1, 0x3104, 0x1B1F }, { 0x21B9, 0x5A64, 0x09D4 }, { 0x5989, 0x874D, 0x7901 }, { 0x4081, 0xEC2D, 0x6BCA },
+  { 0x6FA7, 0xF2B9, 0xC77E }, { 0x76AF, 0x99D9, 0xD5B5 }, { 0x0E9F, 0x44F0, 0xA560 }, { 0x1797, 0x2F90, 0xB7AB },
+  { 0x5716, 0xC3BD, 0xDC61 }, { 0x4E1E, 0xA8DD, 0xCEAA }, { 0x362E, 0x75F4, 0xBE7F }, { 0x2F26, 0x1E94, 0xACB4 },
+  { 0xBE05, 0x2C63, 0x3009 }, { 0xA70D, 0x4703, 0x22C2 }, { 0xDF3D, 0x9A2A, 0x5217 }, { 0xC635, 0xF14A, 0x40DC },
+  { 0x86B4, 0x1D67, 0x2B16 }, { 0x9FBC, 0x7607, 0x39DD }, { 0xE78C, 0xAB2E, 0x4908 }, { 0xFE84, 0xC04E, 0x5BC3 },
+  { 0xD1A2, 0xDEDA, 0xF777 }, { 0xC8AA, 0xB5BA, 0xE5BC }, { 0xB09A, 0x6893, 0x9569 }, { 0xA992, 0x03F3, 0x87A2 },
+  { 0xE913, 0xEFDE, 0xEC68 }, { 0xF01B, 0x84BE, 0xFEA3 }, { 0x882B, 0x5997, 0x8E76 }, { 0x9123, 0x32F7, 0x9CBD },
+  { 0x336B, 0xC2FC, 0x97F3 }, { 0x2A63, 0xA99C, 0x8538 }, { 0x5253, 0x74B5, 0xF5ED }, { 0x4B5B, 0x1FD5, 0xE726 },
+  { 0x0BDA, 0xF3F8, 0x8CEC }, { 0x12D2, 0x9898, 0x9E27 }, { 0x6AE2, 0x45B1, 0xEEF2 }, { 0x73EA, 0x2ED1, 0xFC39 },
+  { 0x5CCC, 0x3045, 0x508D }, { 0x45C4, 0x5B25, 0x4246 }, { 0x3DF4, 0x860C, 0x3293 }, { 0x24FC, 0xED6C, 0x2058 },
+  { 0x647D, 0x0141, 0x4B92 }, { 0x7D75, 0x6A21, 0x5959 }, { 0x0545, 0xB708, 0x298C }, { 0x1C4D, 0xDC68, 0x3B47 },
+  { 0x8D6E, 0xEE9F, 0xA7FA }, { 0x9466, 0x85FF, 0xB531 }, { 0xEC56, 0x58D6, 0xC5E4 }, { 0xF55E, 0x33B6, 0xD72F },
+  { 0xB5DF, 0xDF9B, 0xBCE5 }, { 0xACD7, 0xB4FB, 0xAE2E }, { 0xD4E7, 0x69D2, 0xDEFB }, { 0xCDEF, 0x02B2, 0xCC30 },
+  { 0xE2C9, 0x1C26, 0x6084 }, { 0xFBC1, 0x7746, 0x724F }, { 0x83F1, 0xAA6F, 0x029A }, { 0x9AF9, 0xC10F, 0x1051 },
+  { 0xDA78, 0x2D22, 0x7B9B }, { 0xC370, 0x4642, 0x6950 }, { 0xBB40, 0x9B6B, 0x1985 }, { 0xA248, 0xF00B, 0x0B4E },
+  { 0xC78F, 0xF347, 0x4855 }, { 0xDE87, 0x9827, 0x5A9E }, { 0xA6B7, 0x450E, 0x2A4B }, { 0xBFBF, 0x2E6E, 0x3880 },
+  { 0xFF3E, 0xC243, 0x534A }, { 0xE636, 0xA923, 0x4181 }, { 0x9E06, 0x740A, 0x3154 }, { 0x870E, 0x1F6A, 0x239F },
+  { 0xA828, 0x01FE, 0x8F2B }, { 0xB120, 0x6A9E, 0x9DE0 }, { 0xC910, 0xB7B7, 0xED35 }, { 0xD018, 0xDCD7, 0xFFFE },
+  { 0x9099, 0x30FA, 0x9434 }, { 0x8991, 0x5B9A, 0x86FF }, { 0xF1A1, 0x86B3, 0xF62A }, { 0xE8A9, 0xEDD3, 0xE4E1 },
+  { 0x798A, 0xDF24, 0x785C }, { 0x6082, 0xB444, 0x6A97 }, { 0x18B2, 0x696D, 0x1A42 }, { 0x01BA, 0x020D, 0x0889 },
+  { 0x413B, 0xEE20, 0x6343 }, { 0x5833, 0x8540, 0x7188 }, { 0x2003, 0x5869, 0x015D }, { 0x390B, 0x3309, 0x1396 },
+  { 0x162D, 0x2D9D, 0xBF22 }, { 0x0F25, 0x46FD, 0xADE9 }, { 0x7715, 0x9BD4, 0xDD3C }, { 0x6E1D, 0xF0B4, 0xCFF7 },
+  { 0x2E9C, 0x1C99, 0xA43D }, { 0x3794, 0x77F9, 0xB6F6 }, { 0x4FA4, 0xAAD0, 0xC623 }, { 0x56AC, 0xC1B0, 0xD4E8 },
+  { 0xF4E4, 0x31BB, 0xDFA6 }, { 0xEDEC, 0x5ADB, 0xCD6D }, { 0x95DC, 0x87F2, 0xBDB8 }, { 0x8CD4, 0xEC92, 0xAF73 },
+  { 0xCC55, 0x00BF, 0xC4B9 }, { 0xD55D, 0x6BDF, 0xD672 }, { 0xAD6D, 0xB6F6, 0xA6A7 }, { 0xB465, 0xDD96, 0xB46C },
+  { 0x9B43, 0xC302, 0x18D8 }, { 0x824B, 0xA862, 0x0A13 }, { 0xFA7B, 0x754B, 0x7AC6 }, { 0xE373, 0x1E2B, 0x680D },
+  { 0xA3F2, 0xF206, 0x03C7 }, { 0xBAFA, 0x9966, 0x110C }, { 0xC2CA, 0x444F, 0x61D9 }, { 0xDBC2, 0x2F2F, 0x7312 },
+  { 0x4AE1, 0x1DD8, 0xEFAF }, { 0x53E9, 0x76B8, 0xFD64 }, { 0x2BD9, 0xAB91, 0x8DB1 }, { 0x32D1, 0xC0F1, 0x9F7A },
+  { 0x7250, 0x2CDC, 0xF4B0 }, { 0x6B58, 0x47BC, 0xE67B }, { 0x1368, 0x9A95, 0x96AE }, { 0x0A60, 0xF1F5, 0x8465 },
+  { 0x2546, 0xEF61, 0x28D1 }, { 0x3C4E, 0x8401, 0x3A1A }, { 0x447E, 0x5928, 0x4ACF }, { 0x5D76, 0x3248, 0x5804 },
+  { 0x1DF7, 0xDE65, 0x33CE }, { 0x04FF, 0xB505, 0x2105 }, { 0x7CCF, 0x682C, 0x51D0 }, { 0x65C7, 0x034C, 0x431B },
+  { 0x7BF2, 0x8411, 0xA7A0 }, { 0x62FA, 0xEF71, 0xB56B }, { 0x1ACA, 0x3258, 0xC5BE }, { 0x03C2, 0x5938, 0xD775 },
+  { 0x4343, 0xB515, 0xBCBF }, { 0x5A4B, 0xDE75, 0xAE74 }, { 0x227B, 0x035C, 0xDEA1 }, { 0x3B73, 0x683C, 0xCC6A },
+  { 0x1455, 0x76A8, 0x60DE }, { 0x0D5D, 0x1DC8, 0x7215 }, { 0x756D, 0xC0E1, 0x02C0 }, { 0x6C65, 0xAB81, 0x100B },
+  { 0x2CE4, 0x47AC, 0x7BC1 }, { 0x35EC, 0x2CCC, 0x690A }, { 0x4DDC, 0xF1E5, 0x19DF }, { 0x54D4, 0x9A85, 0x0B14 },
+  { 0xC5F7, 0xA872, 0x97A9 }, { 0xDCFF, 0xC312, 0x8562 }, { 0xA4CF, 0x1E3B, 0xF5B7 }, { 0xBDC7, 0x755B, 0xE77C },
+  { 0xFD46, 0x9976, 0x8CB6 }, { 0xE44E, 0xF216, 0x9E7D }, { 0x9C7E, 0x2F3F, 0xEEA8 }, { 0x8576, 0x445F, 0xFC63 },
+  { 0xAA50, 0x5ACB, 0x50D7 }, { 0xB358, 0x31AB, 0x421C }, { 0xCB68, 0xEC82, 0x32C9 }, { 0xD260, 0x87E2, 0x2002 },
+  { 0x92E1, 0x6BCF, 0x4BC8 }, { 0x8BE9, 0x00AF, 0x5903 }, { 0xF3D9, 0xDD86, 0x29D6 }, { 0xEAD1, 0xB6E6, 0x3B1D },
+  { 0x4899, 0x46ED, 0x3053 }, { 0x5191, 0x2D8D, 0x2298 }, { 0x29A1, 0xF0A4, 0x524D }, { 0x30A9, 0x9BC4, 0x4086 },
+  { 0x7028, 0x77E9, 0x2B4C }, { 0x6920, 0x1C89, 0x3987 }, { 0x1110, 0xC1A0, 0x4952 }, { 0x0818, 0xAAC0, 0x5B99 },
+  { 0x273E, 0xB454, 0xF72D }, { 0x3E36, 0xDF34, 0xE5E6 }, { 0x4606, 0x021D, 0x9533 }, { 0x5F0E, 0x697D, 0x87F8 },
+  { 0x1F8F, 0x8550, 0xEC32 }, { 0x0687, 0xEE30, 0xFEF9 }, { 0x7EB7, 0x3319, 0x8E2C }, { 0x67BF, 0x5879, 0x9CE7 },
+  { 0xF69C, 0x6A8E, 0x005A }, { 0xEF94, 0x01EE, 0x1291 }, { 0x97A4, 0xDCC7, 0x6244 }, { 0x8EAC, 0xB7A7, 0x708F },
+  { 0xCE2D, 0x5B8A, 0x1B45 }, { 0xD725, 0x30EA, 0x098E }, { 0xAF15, 0xEDC3, 0x795B }, { 0xB61D, 0x86A3, 0x6B90 },
+  { 0x993B, 0x9837, 0xC724 }, { 0x8033, 0xF357, 0xD5EF }, { 0xF803, 0x2E7E, 0xA53A }, { 0xE10B, 0x451E, 0xB7F1 },
+  { 0xA18A, 0xA933, 0xDC3B }, { 0xB882, 0xC253, 0xCEF0 }, { 0xC0B2, 0x1F7A, 0xBE25 }, { 0xD9BA, 0x741A, 0xACEE },
+  { 0xBC7D, 0x7756, 0xEFF5 }, { 0xA575, 0x1C36, 0xFD3E }, { 0xDD45, 0xC11F, 0x8DEB }, { 0xC44D, 0xAA7F, 0x9F20 },
+  { 0x84CC, 0x4652, 0xF4EA }, { 0x9DC4, 0x2D32, 0xE621 }, { 0xE5F4, 0xF01B, 0x96F4 }, { 0xFCFC, 0x9B7B, 0x843F },
+  { 0xD3DA, 0x85EF, 0x288B }, { 0xCAD2, 0xEE8F, 0x3A40 }, { 0xB2E2, 0x33A6, 0x4A95 }, { 0xABEA, 0x58C6, 0x585E },
+  { 0xEB6B, 0xB4EB, 0x3394 }, { 0xF263, 0xDF8B, 0x215F }, { 0x8A53, 0x02A2, 0x518A }, { 0x935B, 0x69C2, 0x4341 },
+  { 0x0278, 0x5B35, 0xDFFC }, { 0x1B70, 0x3055, 0xCD37 }, { 0x6340, 0xED7C, 0xBDE2 }, { 0x7A48, 0x861C, 0xAF29 },
+  { 0x3AC9, 0x6A31, 0xC4E3 }, { 0x23C1, 0x0151, 0xD628 }, { 0x5BF1, 0xDC78, 0xA6FD }, { 0x42F9, 0xB718, 0xB436 },
+  { 0x6DDF, 0xA98C, 0x1882 }, { 0x74D7, 0xC2EC, 0x0A49 }, { 0x0CE7, 0x1FC5, 0x7A9C }, { 0x15EF, 0x74A5, 0x6857 },
+  { 0x556E, 0x9888, 0x039D }, { 0x4C66, 0xF3E8, 0x1156 }, { 0x3456, 0x2EC1, 0x6183 }, { 0x2D5E, 0x45A1, 0x7348 },
+  { 0x8F16, 0xB5AA, 0x7806 }, { 0x961E, 0xDECA, 0x6ACD }, { 0xEE2E, 0x03E3, 0x1A18 }, { 0xF726, 0x6883, 0x08D3 },
+  { 0xB7A7, 0x84AE, 0x6319 }, { 0xAEAF, 0xEFCE, 0x71D2 }, { 0xD69F, 0x32E7, 0x0107 }, { 0xCF97, 0x5987, 0x13CC },
+  { 0xE0B1, 0x4713, 0xBF78 }, { 0xF9B9, 0x2C73, 0xADB3 }, { 0x8189, 0xF15A, 0xDD66 }, { 0x9881, 0x9A3A, 0xCFAD },
+  { 0xD800, 0x7617, 0xA467 }, { 0xC108, 0x1D77, 0xB6AC }, { 0xB938, 0xC05E, 0xC679 }, { 0xA030, 0xAB3E, 0xD4B2 },
+  { 0x3113, 0x99C9, 0x480F }, { 0x281B, 0xF2A9, 0x5AC4 }, { 0x502B, 0x2F80, 0x2A11 }, { 0x4923, 0x44E0, 0x38DA },
+  { 0x09A2, 0xA8CD, 0x5310 }, { 0x10AA, 0xC3AD, 0x41DB }, { 0x689A, 0x1E84, 0x310E }, { 0x7192, 0x75E4, 0x23C5 },
+  { 0x5EB4, 0x6B70, 0x8F71 }, { 0x47BC, 0x0010, 0x9DBA }, { 0x3F8C, 0xDD39, 0xED6F }, { 0x2684, 0xB659, 0xFFA4 },
+  { 0x6605, 0x5A74, 0x946E }, { 0x7F0D, 0x3114, 0x86A5 }, { 0x073D, 0xEC3D, 0xF670 }, { 0x1E35, 0x875D, 0xE4BB }
+ },
+ {  // byte 18
+  { 0x0000, 0x0000, 0x0000 }, { 0xD8D0, 0xD087, 0x46C5 }, { 0x26E5, 0xC26C, 0x3F93 }, { 0xFE35, 0x12EB, 0x7956 },
+  { 0x2C15, 0xAC01, 0x3008 }, { 0xF4C5, 0x7C86, 0x76CD }, { 0x0AF0, 0x6E6D, 0x0F9B }, { 0xD220, 0xBEEA, 0x495E },
+  { 0x1D8A, 0x4B51, 0xA160 }, { 0xC55A, 0x9BD6, 0xE7A5 }, { 0x3B6F, 0x893D, 0x9EF3 }, { 0xE3BF, 0x59BA, 0xD836 },
+  { 0x319F, 0xE750, 0x9168 }, { 0xE94F, 0x37D7, 0xD7AD }, { 0x177A, 0x253C, 0xAEFB }, { 0xCFAA, 0xF5BB, 0xE83E },
+  { 0x175E, 0x07C0, 0x1C90 }, { 0xCF8E, 0xD747, 0x5A55 }, { 0x31BB, 0xC5AC, 0x2303 }, { 0xE96B, 0x152B, 0x65C6 },
+  { 0x3B4B, 0xABC1, 0x2C98 }, { 0xE39B, 0x7B46, 0x6A5D }, { 0x1DAE, 0x69AD, 0x130B }, { 0xC57E, 0xB92A, 0x55CE },
+  { 0x0AD4, 0x4C91, 0xBDF0 }, { 0xD204, 0x9C16, 0xFB35 }, { 0x2C31, 0x8EFD, 0x8263 }, { 0xF4E1, 0x5E7A, 0xC4A6 },
+  { 0x26C1, 0xE090, 0x8DF8 }, { 0xFE11, 0x3017, 0xCB3D }, { 0x0024, 0x22FC, 0xB26B }, { 0xD8F4, 0xF27B, 0xF4AE },
+  { 0xAEBB, 0xC65F, 0x1A42 }, { 0x766B, 0x16D8, 0x5C87 }, { 0x885E, 0x0433, 0x25D1 }, { 0x508E, 0xD4B4, 0x6314 },
+  { 0x82AE, 0x6A5E, 0x2A4A }, { 0x5A7E, 0xBAD9, 0x6C8F }, { 0xA44B, 0xA832, 0x15D9 }, { 0x7C9B, 0x78B5, 0x531C },
+  { 0xB331, 0x8D0E, 0xBB22 }, { 0x6BE1, 0x5D89, 0xFDE7 }, { 0x95D4, 0x4F62, 0x84B1 }, { 0x4D04, 0x9FE5, 0xC274 },
+  { 0x9F24, 0x210F, 0x8B2A }, { 0x47F4, 0xF188, 0xCDEF }, { 0xB9C1, 0xE363, 0xB4B9 }, { 0x6111, 0x33E4, 0xF27C },
+  { 0xB9E5, 0xC19F, 0x06D2 }, { 0x6135, 0x1118, 0x4017 }, { 0x9F00, 0x03F3, 0x3941 }, { 0x47D0, 0xD374, 0x7F84 },
+  { 0x95F0, 0x6D9E, 0x36DA }, { 0x4D20, 0xBD19, 0x701F }, { 0xB315, 0xAFF2, 0x0949 }, { 0x6BC5, 0x7F75, 0x4F8C },
+  { 0xA46F, 0x8ACE, 0xA7B2 }, { 0x7CBF, 0x5A49, 0xE177 }, { 0x828A, 0x48A2, 0x9821 }, { 0x5A5A, 0x9825, 0xDEE4 },
+  { 0x887A, 0x26CF, 0x97BA }, { 0x50AA, 0xF648, 0xD17F }, { 0xAE9F, 0xE4A3, 0xA829 }, { 0x764F, 0x3424, 0xEEEC },
+  { 0xD4E8, 0xB6FA, 0xA4BE }, { 0x0C38, 0x667D, 0xE27B }, { 0xF20D, 0x7496, 0x9B2D }, { 0x2ADD, 0xA411, 0xDDE8 },
+  { 0xF8FD, 0x1AFB, 0x94B6 }, { 0x202D, 0xCA7C, 0xD273 }, { 0xDE18, 0xD897, 0xAB25 }, { 0x06C8, 0x0810, 0xEDE0 },
+  { 0xC962, 0xFDAB, 0x05DE }, { 0x11B2, 0x2D2C, 0x431B }, { 0xEF87, 0x3FC7, 0x3A4D }, { 0x3757, 0xEF40, 0x7C88 },
+  { 0xE577, 0x51AA, 0x35D6 }, { 0x3DA7, 0x812D, 0x7313 }, { 0xC392, 0x93C6, 0x0A45 }, { 0x1B42, 0x4341, 0x4C80 },
+  { 0xC3B6, 0xB13A, 0xB82E }, { 0x1B66, 0x61BD, 0xFEEB }, { 0xE553, 0x7356, 0x87BD }, { 0x3D83, 0xA3D1, 0xC178 },
+  { 0xEFA3, 0x1D3B, 0x8826 }, { 0x3773, 0xCDBC, 0xCEE3 }, { 0xC946, 0xDF57, 0xB7B5 }, { 0x1196, 0x0FD0, 0xF170 },
+  { 0xDE3C, 0xFA6B, 0x194E }, { 0x06EC, 0x2AEC, 0x5F8B }, { 0xF8D9, 0x3807, 0x26DD }, { 0x2009, 0xE880, 0x6018 },
+  { 0xF229, 0x566A, 0x2946 }, { 0x2AF9, 0x86ED, 0x6F83 }, { 0xD4CC, 0x9406, 0x16D5 }, { 0x0C1C, 0x4481, 0x5010 },
+  { 0x7A53, 0x70A5, 0xBEFC }, { 0xA283, 0xA022, 0xF839 }, { 0x5CB6, 0xB2C9, 0x816F }, { 0x8466, 0x624E, 0xC7AA },
+  { 0x5646, 0xDCA4, 0x8EF4 }, { 0x8E96, 0x0C23, 0xC831 }, { 0x70A3, 0x1EC8, 0xB167 }, { 0xA873, 0xCE4F, 0xF7A2 },
+  { 0x67D9, 0x3BF4, 0x1F9C }, { 0xBF09, 0xEB73, 0x5959 }, { 0x413C, 0xF998, 0x200F }, { 0x99EC, 0x291F, 0x66CA },
+  { 0x4BCC, 0x97F5, 0x2F94 }, { 0x931C, 0x4772, 0x6951 }, { 0x6D29, 0x5599, 0x1007 }, { 0xB5F9, 0x851E, 0x56C2 },
+  { 0x6D0D, 0x7765, 0xA26C }, { 0xB5DD, 0xA7E2, 0xE4A9 }, { 0x4BE8, 0xB509, 0x9DFF }, { 0x9338, 0x658E, 0xDB3A },
+  { 0x4118, 0xDB64, 0x9264 }, { 0x99C8, 0x0BE3, 0xD4A1 }, { 0x67FD, 0x1908, 0xADF7 }, { 0xBF2D, 0xC98F, 0xEB32 },
+  { 0x7087, 0x3C34, 0x030C }, { 0xA857, 0xECB3, 0x45C9 }, { 0x5662, 0xFE58, 0x3C9F }, { 0x8EB2, 0x2EDF, 0x7A5A },
+  { 0x5C92, 0x9035, 0x3304 }, { 0x8442, 0x40B2, 0x75C1 }, { 0x7A77, 0x5259, 0x0C97 }, { 0xA2A7, 0x82DE, 0x4A52 },
+  { 0x5462, 0xF821, 0x71CE }, { 0x8CB2, 0x28A6, 0x370B }, { 0x7287, 0x3A4D, 0x4E5D }, { 0xAA57, 0xEACA, 0x0898 },
+  { 0x7877, 0x5420, 0x41C6 }, { 0xA0A7, 0x84A7, 0x0703 }, { 0x5E92, 0x964C, 0x7E55 }, { 0x8642, 0x46CB, 0x3890 },
+  { 0x49E8, 0xB370, 0xD0AE }, { 0x9138, 0x63F7, 0x966B }, { 0x6F0D, 0x711C, 0xEF3D }, { 0xB7DD, 0xA19B, 0xA9F8 },
+  { 0x65FD, 0x1F71, 0xE0A6 }, { 0xBD2D, 0xCFF6, 0xA663 }, { 0x4318, 0xDD1D, 0xDF35 }, { 0x9BC8, 0x0D9A, 0x99F0 },
+  { 0x433C, 0xFFE1, 0x6D5E }, { 0x9BEC, 0x2F66, 0x2B9B }, { 0x65D9, 0x3D8D, 0x52CD }, { 0xBD09, 0xED0A, 0x1408 },
+  { 0x6F29, 0x53E0, 0x5D56 }, { 0xB7F9, 0x8367, 0x1B93 }, { 0x49CC, 0x918C, 0x62C5 }, { 0x911C, 0x410B, 0x2400 },
+  { 0x5EB6, 0xB4B0, 0xCC3E }, { 0x8666, 0x6437, 0x8AFB }, { 0x7853, 0x76DC, 0xF3AD }, { 0xA083, 0xA65B, 0xB568 },
+  { 0x72A3, 0x18B1, 0xFC36 }, { 0xAA73, 0xC836, 0xBAF3 }, { 0x5446, 0xDADD, 0xC3A5 }, { 0x8C96, 0x0A5A, 0x8560 },
+  { 0xFAD9, 0x3E7E, 0x6B8C }, { 0x2209, 0xEEF9, 0x2D49 }, { 0xDC3C, 0xFC12, 0x541F }, { 0x04EC, 0x2C95, 0x12DA },
+  { 0xD6CC, 0x927F, 0x5B84 }, { 0x0E1C, 0x42F8, 0x1D41 }, { 0xF029, 0x5013, 0x6417 }, { 0x28F9, 0x8094, 0x22D2 },
+  { 0xE753, 0x752F, 0xCAEC }, { 0x3F83, 0xA5A8, 0x8C29 }, { 0xC1B6, 0xB743, 0xF57F }, { 0x1966, 0x67C4, 0xB3BA },
+  { 0xCB46, 0xD92E, 0xFAE4 }, { 0x1396, 0x09A9, 0xBC21 }, { 0xEDA3, 0x1B42, 0xC577 }, { 0x3573, 0xCBC5, 0x83B2 },
+  { 0xED87, 0x39BE, 0x771C }, { 0x3557, 0xE939, 0x31D9 }, { 0xCB62, 0xFBD2, 0x488F }, { 0x13B2, 0x2B55, 0x0E4A },
+  { 0xC192, 0x95BF, 0x4714 }, { 0x1942, 0x4538, 0x01D1 }, { 0xE777, 0x57D3, 0x7887 }, { 0x3FA7, 0x8754, 0x3E42 },
+  { 0xF00D, 0x72EF, 0xD67C }, { 0x28DD, 0xA268, 0x90B9 }, { 0xD6E8, 0xB083, 0xE9EF }, { 0x0E38, 0x6004, 0xAF2A },
+  { 0xDC18, 0xDEEE, 0xE674 }, { 0x04C8, 0x0E69, 0xA0B1 }, { 0xFAFD, 0x1C82, 0xD9E7 }, { 0x222D, 0xCC05, 0x9F22 },
+  { 0x808A, 0x4EDB, 0xD570 }, { 0x585A, 0x9E5C, 0x93B5 }, { 0xA66F, 0x8CB7, 0xEAE3 }, { 0x7EBF, 0x5C30, 0xAC26 },
+  { 0xAC9F, 0xE2DA, 0xE578 }, { 0x744F, 0x325D, 0xA3BD }, { 0x8A7A, 0x20B6, 0xDAEB }, { 0x52AA, 0xF031, 0x9C2E },
+  { 0x9D00, 0x058A, 0x7410 }, { 0x45D0, 0xD50D, 0x32D5 }, { 0xBBE5, 0xC7E6, 0x4B83 }, { 0x6335, 0x1761, 0x0D46 },
+  { 0xB115, 0xA98B, 0x4418 }, { 0x69C5, 0x790C, 0x02DD }, { 0x97F0, 0x6BE7, 0x7B8B }, { 0x4F20, 0xBB60, 0x3D4E },
+  { 0x97D4, 0x491B, 0xC9E0 }, { 0x4F04, 0x999C, 0x8F25 }, { 0xB131, 0x8B77, 0xF673 }, { 0x69E1, 0x5BF0, 0xB0B6 },
+  { 0xBBC1, 0xE51A, 0xF9E8 }, { 0x6311, 0x359D, 0xBF2D }, { 0x9D24, 0x2776, 0xC67B }, { 0x45F4, 0xF7F1, 0x80BE },
+  { 0x8A5E, 0x024A, 0x6880 }, { 0x528E, 0xD2CD, 0x2E45 }, { 0xACBB, 0xC026, 0x5713 }, { 0x746B, 0x10A1, 0x11D6 },
+  { 0xA64B, 0xAE4B, 0x5888 }, { 0x7E9B, 0x7ECC, 0x1E4D }, { 0x80AE, 0x6C27, 0x671B }, { 0x587E, 0xBCA0, 0x21DE },
+  { 0x2E31, 0x8884, 0xCF32 }, { 0xF6E1, 0x5803, 0x89F7 }, { 0x08D4, 0x4AE8, 0xF0A1 }, { 0xD004, 0x9A6F, 0xB664 },
+  { 0x0224, 0x2485, 0xFF3A }, { 0xDAF4, 0xF402, 0xB9FF }, { 0x24C1, 0xE6E9, 0xC0A9 }, { 0xFC11, 0x366E, 0x866C },
+  { 0x33BB, 0xC3D5, 0x6E52 }, { 0xEB6B, 0x1352, 0x2897 }, { 0x155E, 0x01B9, 0x51C1 }, { 0xCD8E, 0xD13E, 0x1704 },
+  { 0x1FAE, 0x6FD4, 0x5E5A }, { 0xC77E, 0xBF53, 0x189F }, { 0x394B, 0xADB8, 0x61C9 }, { 0xE19B, 0x7D3F, 0x270C },
+  { 0x396F, 0x8F44, 0xD3A2 }, { 0xE1BF, 0x5FC3, 0x9567 }, { 0x1F8A, 0x4D28, 0xEC31 }, { 0xC75A, 0x9DAF, 0xAAF4 },
+  { 0x157A, 0x2345, 0xE3AA }, { 0xCDAA, 0xF3C2, 0xA56F }, { 0x339F, 0xE129, 0xDC39 }, { 0xEB4F, 0x31AE, 0x9AFC },
+  { 0x24E5, 0xC415, 0x72C2 }, { 0xFC35, 0x1492, 0x3407 }, { 0x0200, 0x0679, 0x4D51 }, { 0xDAD0, 0xD6FE, 0x0B94 },
+  { 0x08F0, 0x6814, 0x42CA }, { 0xD020, 0xB893, 0x040F }, { 0x2E15, 0xAA78, 0x7D59 }, { 0xF6C5, 0x7AFF, 0x3B9C }
+ },
+ {  // byte 19
+  { 0x0000, 0x0000, 0x0000 }, { 0x101B, 0x9509, 0x7105 }, { 0x9B9E, 0xEA5A, 0x8368 }, { 0x8B85, 0x7F53, 0xF26D },
+  { 0xA270, 0xCA7F, 0x9BE3 }, { 0xB26B, 0x5F76, 0xEAE6 }, { 0x39EE, 0x2025, 0x188B }, { 0x29F5, 0xB52C, 0x698E },
+  { 0xFC35, 0x92DB, 0x9D36 }, { 0xEC2E, 0x07D2, 0xEC33 }, { 0x67AB, 0x7881, 0x1E5E }, { 0x77B0, 0xED88, 0x6F5B },
+  { 0x5E45, 0x58A4, 0x06D5 }, { 0x4E5E, 0xCDAD, 0x77D0 }, { 0xC5DB, 0xB2FE, 0x85BD }, { 0xD5C0, 0x27F7, 0xF4B8 },
+  { 0x18C1, 0x7438, 0xD1EC }, { 0x08DA, 0xE131, 0xA0E9 }, { 0x835F, 0x9E62, 0x5284 }, { 0x9344, 0x0B6B, 0x2381 },
+  { 0xBAB1, 0xBE47, 0x4A0F }, { 0xAAAA, 0x2B4E, 0x3B0A }, { 0x212F, 0x541D, 0xC967 }, { 0x3134, 0xC114, 0xB862 },
+  { 0xE4F4, 0xE6E3, 0x4CDA }, { 0xF4EF, 0x73EA, 0x3DDF }, { 0x7F6A, 0x0CB9, 0xCFB2 }, { 0x6F71, 0x99B0, 0xBEB7 },
+  { 0x4684, 0x2C9C, 0xD739 }, { 0x569F, 0xB995, 0xA63C }, { 0xDD1A, 0xC6C6, 0x5451 }, { 0xCD01, 0x53CF, 0x2554 },
+  { 0x20D6, 0x2E50, 0xD0B8 }, { 0x30CD, 0xBB59, 0xA1BD }, { 0xBB48, 0xC40A, 0x53D0 }, { 0xAB53, 0x5103, 0x22D5 },
+  { 0x82A6, 0xE42F, 0x4B5B }, { 0x92BD, 0x7126, 0x3A5E }, { 0x1938, 0x0E75, 0xC833 }, { 0x0923, 0x9B7C, 0xB936 },
+  { 0xDCE3, 0xBC8B, 0x4D8E }, { 0xCCF8, 0x2982, 0x3C8B }, { 0x477D, 0x56D1, 0xCEE6 }, { 0x5766, 0xC3D8, 0xBFE3 },
+  { 0x7E93, 0x76F4, 0xD66D }, { 0x6E88, 0xE3FD, 0xA768 }, { 0xE50D, 0x9CAE, 0x5505 }, { 0xF516, 0x09A7, 0x2400 },
+  { 0x3817, 0x5A68, 0x0154 }, { 0x280C, 0xCF61, 0x7051 }, { 0xA389, 0xB032, 0x823C }, { 0xB392, 0x253B, 0xF339 },
+  { 0x9A67, 0x9017, 0x9AB7 }, { 0x8A7C, 0x051E, 0xEBB2 }, { 0x01F9, 0x7A4D, 0x19DF }, { 0x11E2, 0xEF44, 0x68DA },
+  { 0xC422, 0xC8B3, 0x9C62 }, { 0xD439, 0x5DBA, 0xED67 }, { 0x5FBC, 0x22E9, 0x1F0A }, { 0x4FA7, 0xB7E0, 0x6E0F },
+  { 0x6652, 0x02CC, 0x0781 }, { 0x7649, 0x97C5, 0x7684 }, { 0xFDCC, 0xE896, 0x84E9 }, { 0xEDD7, 0x7D9F, 0xF5EC },
+  { 0x60B5, 0xF118, 0xE05F }, { 0x70AE, 0x6411, 0x915A }, { 0xFB2B, 0x1B42, 0x6337 }, { 0xEB30, 0x8E4B, 0x1232 },
+  { 0xC2C5, 0x3B67, 0x7BBC }, { 0xD2DE, 0xAE6E, 0x0AB9 }, { 0x595B, 0xD13D, 0xF8D4 }, { 0x4940, 0x4434, 0x89D1 },
+  { 0x9C80, 0x63C3, 0x7D69 }, { 0x8C9B, 0xF6CA, 0x0C6C }, { 0x071E, 0x8999, 0xFE01 }, { 0x1705, 0x1C90, 0x8F04 },
+  { 0x3EF0, 0xA9BC, 0xE68A }, { 0x2EEB, 0x3CB5, 0x978F }, { 0xA56E, 0x43E6, 0x65E2 }, { 0xB575, 0xD6EF, 0x14E7 },
+  { 0x7874, 0x8520, 0x31B3 }, { 0x686F, 0x1029, 0x40B6 }, { 0xE3EA, 0x6F7A, 0xB2DB }, { 0xF3F1, 0xFA73, 0xC3DE },
+  { 0xDA04, 0x4F5F, 0xAA50 }, { 0xCA1F, 0xDA56, 0xDB55 }, { 0x419A, 0xA505, 0x2938 }, { 0x5181, 0x300C, 0x583D },
+  { 0x8441, 0x17FB, 0xAC85 }, { 0x945A, 0x82F2, 0xDD80 }, { 0x1FDF, 0xFDA1, 0x2FED }, { 0x0FC4, 0x68A8, 0x5EE8 },
+  { 0x2631, 0xDD84, 0x3766 }, { 0x362A, 0x488D, 0x4663 }, { 0xBDAF, 0x37DE, 0xB40E }, { 0xADB4, 0xA2D7, 0xC50B },
+  { 0x4063, 0xDF48, 0x30E7 }, { 0x5078, 0x4A41, 0x41E2 }, { 0xDBFD, 0x3512, 0xB38F }, { 0xCBE6, 0xA01B, 0xC28A },
+  { 0xE213, 0x1537, 0xAB04 }, { 0xF208, 0x803E, 0xDA01 }, { 0x798D, 0xFF6D, 0x286C }, { 0x6996, 0x6A64, 0x5969 },
+  { 0xBC56, 0x4D93, 0xADD1 }, { 0xAC4D, 0xD89A, 0xDCD4 }, { 0x27C8, 0xA7C9, 0x2EB9 }, { 0x37D3, 0x32C0, 0x5FBC },
+  { 0x1E26, 0x87EC, 0x3632 }, { 0x0E3D, 0x12E5, 0x4737 }, { 0x85B8, 0x6DB6, 0xB55A }, { 0x95A3, 0xF8BF, 0xC45F },
+  { 0x58A2, 0xAB70, 0xE10B }, { 0x48B9, 0x3E79, 0x900E }, { 0xC33C, 0x412A, 0x6263 }, { 0xD327, 0xD423, 0x1366 },
+  { 0xFAD2, 0x610F, 0x7AE8 }, { 0xEAC9, 0xF406, 0x0BED }, { 0x614C, 0x8B55, 0xF980 }, { 0x7157, 0x1E5C, 0x8885 },
+  { 0xA497, 0x39AB, 0x7C3D }, { 0xB48C, 0xACA2, 0x0D38 }, { 0x3F09, 0xD3F1, 0xFF55 }, { 0x2F12, 0x46F8, 0x8E50 },
+  { 0x06E7, 0xF3D4, 0xE7DE }, { 0x16FC, 0x66DD, 0x96DB }, { 0x9D79, 0x198E, 0x64B6 }, { 0x8D62, 0x8C87, 0x15B3 },
+  { 0x6E93, 0x2DAD, 0x2589 }, { 0x7E88, 0xB8A4, 0x548C }, { 0xF50D, 0xC7F7, 0xA6E1 }, { 0xE516, 0x52FE, 0xD7E4 },
+  { 0xCCE3, 0xE7D2, 0xBE6A }, { 0xDCF8, 0x72DB, 0xCF6F }, { 0x577D, 0x0D88, 0x3D02 }, { 0x4766, 0x9881, 0x4C07 },
+  { 0x92A6, 0xBF76, 0xB8BF }, { 0x82BD, 0x2A7F, 0xC9BA }, { 0x0938, 0x552C, 0x3BD7 }, { 0x1923, 0xC025, 0x4AD2 },
+  { 0x30D6, 0x7509, 0x235C }, { 0x20CD, 0xE000, 0x5259 }, { 0xAB48, 0x9F53, 0xA034 }, { 0xBB53, 0x0A5A, 0xD131 },
+  { 0x7652, 0x5995, 0xF465 }, { 0x6649, 0xCC9C, 0x8560 }, { 0xEDCC, 0xB3CF, 0x770D }, { 0xFDD7, 0x26C6, 0x0608 },
+  { 0xD422, 0x93EA, 0x6F86 }, { 0xC439, 0x06E3, 0x1E83 }, { 0x4FBC, 0x79B0, 0xECEE }, { 0x5FA7, 0xECB9, 0x9DEB },
+  { 0x8A67, 0xCB4E, 0x6953 }, { 0x9A7C, 0x5E47, 0x1856 }, { 0x11F9, 0x2114, 0xEA3B }, { 0x01E2, 0xB41D, 0x9B3E },
+  { 0x2817, 0x0131, 0xF2B0 }, { 0x380C, 0x9438, 0x83B5 }, { 0xB389, 0xEB6B, 0x71D8 }, { 0xA392, 0x7E62, 0x00DD },
+  { 0x4E45, 0x03FD, 0xF531 }, { 0x5E5E, 0x96F4, 0x8434 }, { 0xD5DB, 0xE9A7, 0x7659 }, { 0xC5C0, 0x7CAE, 0x075C },
+  { 0xEC35, 0xC982, 0x6ED2 }, { 0xFC2E, 0x5C8B, 0x1FD7 }, { 0x77AB, 0x23D8, 0xEDBA }, { 0x67B0, 0xB6D1, 0x9CBF },
+  { 0xB270, 0x9126, 0x6807 }, { 0xA26B, 0x042F, 0x1902 }, { 0x29EE, 0x7B7C, 0xEB6F }, { 0x39F5, 0xEE75, 0x9A6A },
+  { 0x1000, 0x5B59, 0xF3E4 }, { 0x001B, 0xCE50, 0x82E1 }, { 0x8B9E, 0xB103, 0x708C }, { 0x9B85, 0x240A, 0x0189 },
+  { 0x5684, 0x77C5, 0x24DD }, { 0x469F, 0xE2CC, 0x55D8 }, { 0xCD1A, 0x9D9F, 0xA7B5 }, { 0xDD01, 0x0896, 0xD6B0 },
+  { 0xF4F4, 0xBDBA, 0xBF3E }, { 0xE4EF, 0x28B3, 0xCE3B }, { 0x6F6A, 0x57E0, 0x3C56 }, { 0x7F71, 0xC2E9, 0x4D53 },
+  { 0xAAB1, 0xE51E, 0xB9EB }, { 0xBAAA, 0x7017, 0xC8EE }, { 0x312F, 0x0F44, 0x3A83 }, { 0x2134, 0x9A4D, 0x4B86 },
+  { 0x08C1, 0x2F61, 0x2208 }, { 0x18DA, 0xBA68, 0x530D }, { 0x935F, 0xC53B, 0xA160 }, { 0x8344, 0x5032, 0xD065 },
+  { 0x0E26, 0xDCB5, 0xC5D6 }, { 0x1E3D, 0x49BC, 0xB4D3 }, { 0x95B8, 0x36EF, 0x46BE }, { 0x85A3, 0xA3E6, 0x37BB },
+  { 0xAC56, 0x16CA, 0x5E35 }, { 0xBC4D, 0x83C3, 0x2F30 }, { 0x37C8, 0xFC90, 0xDD5D }, { 0x27D3, 0x6999, 0xAC58 },
+  { 0xF213, 0x4E6E, 0x58E0 }, { 0xE208, 0xDB67, 0x29E5 }, { 0x698D, 0xA434, 0xDB88 }, { 0x7996, 0x313D, 0xAA8D },
+  { 0x5063, 0x8411, 0xC303 }, { 0x4078, 0x1118, 0xB206 }, { 0xCBFD, 0x6E4B, 0x406B }, { 0xDBE6, 0xFB42, 0x316E },
+  { 0x16E7, 0xA88D, 0x143A }, { 0x06FC, 0x3D84, 0x653F }, { 0x8D79, 0x42D7, 0x9752 }, { 0x9D62, 0xD7DE, 0xE657 },
+  { 0xB497, 0x62F2, 0x8FD9 }, { 0xA48C, 0xF7FB, 0xFEDC }, { 0x2F09, 0x88A8, 0x0CB1 }, { 0x3F12, 0x1DA1, 0x7DB4 },
+  { 0xEAD2, 0x3A56, 0x890C }, { 0xFAC9, 0xAF5F, 0xF809 }, { 0x714C, 0xD00C, 0x0A64 }, { 0x6157, 0x4505, 0x7B61 },
+  { 0x48A2, 0xF029, 0x12EF }, { 0x58B9, 0x6520, 0x63EA }, { 0xD33C, 0x1A73, 0x9187 }, { 0xC327, 0x8F7A, 0xE082 },
+  { 0x2EF0, 0xF2E5, 0x156E }, { 0x3EEB, 0x67EC, 0x646B }, { 0xB56E, 0x18BF, 0x9606 }, { 0xA575, 0x8DB6, 0xE703 },
+  { 0x8C80, 0x389A, 0x8E8D }, { 0x9C9B, 0xAD93, 0xFF88 }, { 0x171E, 0xD2C0, 0x0DE5 }, { 0x0705, 0x47C9, 0x7CE0 },
+  { 0xD2C5, 0x603E, 0x8858 }, { 0xC2DE, 0xF537, 0xF95D }, { 0x495B, 0x8A64, 0x0B30 }, { 0x5940, 0x1F6D, 0x7A35 },
+  { 0x70B5, 0xAA41, 0x13BB }, { 0x60AE, 0x3F48, 0x62BE }, { 0xEB2B, 0x401B, 0x90D3 }, { 0xFB30, 0xD512, 0xE1D6 },
+  { 0x3631, 0x86DD, 0xC482 }, { 0x262A, 0x13D4, 0xB587 }, { 0xADAF, 0x6C87, 0x47EA }, { 0xBDB4, 0xF98E, 0x36EF },
+  { 0x9441, 0x4CA2, 0x5F61 }, { 0x845A, 0xD9AB, 0x2E64 }, { 0x0FDF, 0xA6F8, 0xDC09 }, { 0x1FC4, 0x33F1, 0xAD0C },
+  { 0xCA04, 0x1406, 0x59B4 }, { 0xDA1F, 0x810F, 0x28B1 }, { 0x519A, 0xFE5C, 0xDADC }, { 0x4181, 0x6B55, 0xABD9 },
+  { 0x6874, 0xDE79, 0xC257 }, { 0x786F, 0x4B70, 0xB352 }, { 0xF3EA, 0x3423, 0x413F }, { 0xE3F1, 0xA12A, 0x303A }
+ }
+} ;
+#endif // LDPC_ENCODE_BYTE_TABLE
+
+#ifdef LDPC_ENCODE_NIBBLE_TABLE
+// parity of every nibble value at every of the 40 nibble positions
+const uint16_t LDPC_ParityNibble_n208k160[40][16][3] = {
+ {  // nibble 0
+  { 0x0000, 0x0000, 0x0000 }, { 0x5A03, 0x1588, 0x5E04 }, { 0x1426, 0xB814, 0xCA2F }, { 0x4E25, 0xAD9C, 0x942B },
+  { 0xBE44, 0xFEF4, 0xC474 }, { 0xE447, 0xEB7C, 0x9A70 }, { 0xAA62, 0x46E0, 0x0E5B }, { 0xF061, 0x5368, 0x505F },
+  { 0x7250, 0xBA66, 0x7B8C }, { 0x2853, 0xAFEE, 0x2588 }, { 0x6676, 0x0272, 0xB1A3 }, { 0x3C75, 0x17FA, 0xEFA7 },
+  { 0xCC14, 0x4492, 0xBFF8 }, { 0x9617, 0x511A, 0xE1FC }, { 0xD832, 0xFC86, 0x75D7 }, { 0x8231, 0xE90E, 0x2BD3 }
+ },
+ {  // nibble 1
+  { 0x0000, 0x0000, 0x0000 }, { 0xCD74, 0xE8A2, 0x1D8B }, { 0x24E0, 0xC74C, 0x0ADA }, { 0xE994, 0x2FEE, 0x1751 },
+  { 0x4F8E, 0xE2CC, 0x0748 }, { 0x82FA, 0x0A6E, 0x1AC3 }, { 0x6B6E, 0x2580, 0x0D92 }, { 0xA61A, 0xCD22, 0x1019 },
+  { 0xB943, 0xCB41, 0x08D0 }, { 0x7437, 0x23E3, 0x155B }, { 0x9DA3, 0x0C0D, 0x020A }, { 0x50D7, 0xE4AF, 0x1F81 },
+  { 0xF6CD, 0x298D, 0x0F98 }, { 0x3BB9, 0xC12F, 0x1213 }, { 0xD22D, 0xEEC1, 0x0542 }, { 0x1F59, 0x0663, 0x18C9 }
+ },
+ {  // nibble 2
+  { 0x0000, 0x0000, 0x0000 }, { 0xB396, 0xB1AB, 0x680C }, { 0x2AFB, 0x802C, 0x5E93 }, { 0x996D, 0x3187, 0x369F },
+  { 0xA8D6, 0xC892, 0xBEE2 }, { 0x1B40, 0x7939, 0xD6EE }, { 0x822D, 0x48BE, 0xE071 }, { 0x31BB, 0xF915, 0x887D },
+  { 0xCC06, 0xB88A, 0x4F0D }, { 0x7F90, 0x0921, 0x2701 }, { 0xE6FD, 0x38A6, 0x119E }, { 0x556B, 0x890D, 0x7992 },
+  { 0x64D0, 0x7018, 0xF1EF }, { 0xD746, 0xC1B3, 0x99E3 }, { 0x4E2B, 0xF034, 0xAF7C }, { 0xFDBD, 0x419F, 0xC770 }
+ },
+ {  // nibble 3
+  { 0x0000, 0x0000, 0x0000 }, { 0x79F8, 0x4110, 0xA0E2 }, { 0x41E0, 0x1099, 0xE9AF }, { 0x3818, 0x5189, 0x494D },
+  { 0x91B0, 0xDA57, 0x6246 }, { 0xE848, 0x9B47, 0xC2A4 }, { 0xD050, 0xCACE, 0x8BE9 }, { 0xA9A8, 0x8BDE, 0x2B0B },
+  { 0x3814, 0xD429, 0x405C }, { 0x41EC, 0x9539, 0xE0BE }, { 0x79F4, 0xC4B0, 0xA9F3 }, { 0x000C, 0x85A0, 0x0911 },
+  { 0xA9A4, 0x0E7E, 0x221A }, { 0xD05C, 0x4F6E, 0x82F8 }, { 0xE844, 0x1EE7, 0xCBB5 }, { 0x91BC, 0x5FF7, 0x6B57 }
+ },
+ {  // nibble 4
+  { 0x0000, 0x0000, 0x0000 }, { 0xA78D, 0x177B, 0xF0A4 }, { 0xE998, 0xB0A7, 0x570C }, { 0x4E15, 0xA7DC, 0xA7A8 },
+  { 0x44DA, 0xED1D, 0xAAF8 }, { 0xE357, 0xFA66, 0x5A5C }, { 0xAD42, 0x5DBA, 0xFDF4 }, { 0x0ACF, 0x4AC1, 0x0D50 },
+  { 0x8A23, 0x8F7F, 0x9A36 }, { 0x2DAE, 0x9804, 0x6A92 }, { 0x63BB, 0x3FD8, 0xCD3A }, { 0xC436, 0x28A3, 0x3D9E },
+  { 0xCEF9, 0x6262, 0x30CE }, { 0x6974, 0x7519, 0xC06A }, { 0x2761, 0xD2C5, 0x67C2 }, { 0x80EC, 0xC5BE, 0x9766 }
+ },
+ {  // nibble 5
+  { 0x0000, 0x0000, 0x0000 }, { 0x5822, 0xBB68, 0x410B }, { 0xBEA3, 0x3C07, 0x7A2F }, { 0xE681, 0x876F, 0x3B24 },
+  { 0xF9AC, 0x8AF3, 0xAD03 }, { 0xA18E, 0x319B, 0xEC08 }, { 0x470F, 0xB6F4, 0xD72C }, { 0x1F2D, 0x0D9C, 0x9627 },
+  { 0xC5FB, 0x27F3, 0x9CAB }, { 0x9DD9, 0x9C9B, 0xDDA0 }, { 0x7B58, 0x1BF4, 0xE684 }, { 0x237A, 0xA09C, 0xA78F },
+  { 0x3C57, 0xAD00, 0x31A8 }, { 0x6475, 0x1668, 0x70A3 }, { 0x82F4, 0x9107, 0x4B87 }, { 0xDAD6, 0x2A6F, 0x0A8C }
+ },
+ {  // nibble 6
+  { 0x0000, 0x0000, 0x0000 }, { 0xAE30, 0x423E, 0xBB63 }, { 0xD874, 0xF52A, 0x41DE }, { 0x7644, 0xB714, 0xFABD },
+  { 0xB68E, 0xFD3A, 0xE17C }, { 0x18BE, 0xBF04, 0x5A1F }, { 0x6EFA, 0x0810, 0xA0A2 }, { 0xC0CA, 0x4A2E, 0x1BC1 },
+  { 0x12E2, 0xD185, 0x47E7 }, { 0xBCD2, 0x93BB, 0xFC84 }, { 0xCA96, 0x24AF, 0x0639 }, { 0x64A6, 0x6691, 0xBD5A },
+  { 0xA46C, 0x2CBF, 0xA69B }, { 0x0A5C, 0x6E81, 0x1DF8 }, { 0x7C18, 0xD995, 0xE745 }, { 0xD228, 0x9BAB, 0x5C26 }
+ },
+ {  // nibble 7
+  { 0x0000, 0x0000, 0x0000 }, { 0xC5B0, 0xF8BA, 0xCDAB }, { 0x50F4, 0x5E49, 0x50D7 }, { 0x9544, 0xA6F3, 0x9D7C },
+  { 0xB13F, 0x1FD7, 0xD727 }, { 0x748F, 0xE76D, 0x1A8C }, { 0xE1CB, 0x419E, 0x87F0 }, { 0x247B, 0xB924, 0x4A5B },
+  { 0xF3C2, 0x01AE, 0x37C1 }, { 0x3672, 0xF914, 0xFA6A }, { 0xA336, 0x5FE7, 0x6716 }, { 0x6686, 0xA75D, 0xAABD },
+  { 0x42FD, 0x1E79, 0xE0E6 }, { 0x874D, 0xE6C3, 0x2D4D }, { 0x1209, 0x4030, 0xB031 }, { 0xD7B9, 0xB88A, 0x7D9A }
+ },
+ {  // nibble 8
+  { 0x0000, 0x0000, 0x0000 }, { 0x4D5D, 0x9274, 0xE2F4 }, { 0x999C, 0xAAF2, 0xBD29 }, { 0xD4C1, 0x3886, 0x5FDD },
+  { 0x5B4E, 0x2EFD, 0x87BC }, { 0x1613, 0xBC89, 0x6548 }, { 0xC2D2, 0x840F, 0x3A95 }, { 0x8F8F, 0x167B, 0xD861 },
+  { 0xC56F, 0x7DAB, 0x6CCE }, { 0x8832, 0xEFDF, 0x8E3A }, { 0x5CF3, 0xD759, 0xD1E7 }, { 0x11AE, 0x452D, 0x3313 },
+  { 0x9E21, 0x5356, 0xEB72 }, { 0xD37C, 0xC122, 0x0986 }, { 0x07BD, 0xF9A4, 0x565B }, { 0x4AE0, 0x6BD0, 0xB4AF }
+ },
+ {  // nibble 9
+  { 0x0000, 0x0000, 0x0000 }, { 0xEE8E, 0xA74F, 0x6A18 }, { 0x69B6, 0x3504, 0x585F }, { 0x8738, 0x924B, 0x3247 },
+  { 0xD465, 0xB88A, 0x6F9D }, { 0x3AEB, 0x1FC5, 0x0585 }, { 0xBDD3, 0x8D8E, 0x37C2 }, { 0x535D, 0x2AC1, 0x5DDA },
+  { 0xD286, 0x1067, 0x4A15 }, { 0x3C08, 0xB728, 0x200D }, { 0xBB30, 0x2563, 0x124A }, { 0x55BE, 0x822C, 0x7852 },
+  { 0x06E3, 0xA8ED, 0x2588 }, { 0xE86D, 0x0FA2, 0x4F90 }, { 0x6F55, 0x9DE9, 0x7DD7 }, { 0x81DB, 0x3AA6, 0x17CF }
+ },
+ {  // nibble 10
+  { 0x0000, 0x0000, 0x0000 }, { 0x17AC, 0xE2DC, 0x464A }, { 0x2619, 0x82C0, 0x0435 }, { 0x31B5, 0x601C, 0x427F },
+  { 0xC4F6, 0xA371, 0x91AB }, { 0xD35A, 0x41AD, 0xD7E1 }, { 0xE2EF, 0x21B1, 0x959E }, { 0xF543, 0xC36D, 0xD3D4 },
+  { 0x7C64, 0x968A, 0x7F95 }, { 0x6BC8, 0x7456, 0x39DF }, { 0x5A7D, 0x144A, 0x7BA0 }, { 0x4DD1, 0xF696, 0x3DEA },
+  { 0xB892, 0x35FB, 0xEE3E }, { 0xAF3E, 0xD727, 0xA874 }, { 0x9E8B, 0xB73B, 0xEA0B }, { 0x8927, 0x55E7, 0xAC41 }
+ },
+ {  // nibble 11
+  { 0x0000, 0x0000, 0x0000 }, { 0x09D1, 0x7119, 0xC29D }, { 0x2A8E, 0xC1B0, 0xA561 }, { 0x235F, 0xB0A9, 0x67FC },
+  { 0x2129, 0xB1A7, 0xF63E }, { 0x28F8, 0xC0BE, 0x34A3 }, { 0x0BA7, 0x7017, 0x535F }, { 0x0276, 0x010E, 0x91C2 },
+  { 0x4B37, 0x3FC8, 0x6C0F }, { 0x42E6, 0x4ED1, 0xAE92 }, { 0x61B9, 0xFE78, 0xC96E }, { 0x6868, 0x8F61, 0x0BF3 },
+  { 0x6A1E, 0x8E6F, 0x9A31 }, { 0x63CF, 0xFF76, 0x58AC }, { 0x4090, 0x4FDF, 0x3F50 }, { 0x4941, 0x3EC6, 0xFDCD }
+ },
+ {  // nibble 12
+  { 0x0000, 0x0000, 0x0000 }, { 0xBD87, 0x76FB, 0xCC6C }, { 0x6142, 0xF014, 0xD3ED }, { 0xDCC5, 0x86EF, 0x1F81 },
+  { 0x287E, 0x44BE, 0xB7B3 }, { 0x95F9, 0x3245, 0x7BDF }, { 0x493C, 0xB4AA, 0x645E }, { 0xF4BB, 0xC251, 0xA832 },
+  { 0x78B3, 0x0530, 0xA1A3 }, { 0xC534, 0x73CB, 0x6DCF }, { 0x19F1, 0xF524, 0x724E }, { 0xA476, 0x83DF, 0xBE22 },
+  { 0x50CD, 0x418E, 0x1610 }, { 0xED4A, 0x3775, 0xDA7C }, { 0x318F, 0xB19A, 0xC5FD }, { 0x8C08, 0xC761, 0x0991 }
+ },
+ {  // nibble 13
+  { 0x0000, 0x0000, 0x0000 }, { 0x2989, 0x1408, 0xC225 }, { 0xB250, 0x5523, 0x60D4 }, { 0x9BD9, 0x412B, 0xA2F1 },
+  { 0xFD33, 0x83E2, 0x2711 }, { 0xD4BA, 0x97EA, 0xE534 }, { 0x4F63, 0xD6C1, 0x47C5 }, { 0x66EA, 0xC2C9, 0x85E0 },
+  { 0x74CC, 0x7B45, 0x5B8D }, { 0x5D45, 0x6F4D, 0x99A8 }, { 0xC69C, 0x2E66, 0x3B59 }, { 0xEF15, 0x3A6E, 0xF97C },
+  { 0x89FF, 0xF8A7, 0x7C9C }, { 0xA076, 0xECAF, 0xBEB9 }, { 0x3BAF, 0xAD84, 0x1C48 }, { 0x1226, 0xB98C, 0xDE6D }
+ },
+ {  // nibble 14
+  { 0x0000, 0x0000, 0x0000 }, { 0x0715, 0x9C89, 0x6D44 }, { 0xDEB4, 0x581A, 0xF067 }, { 0xD9A1, 0xC493, 0x9D23 },
+  { 0x017A, 0x5AF5, 0xE3E6 }, { 0x066F, 0xC67C, 0x8EA2 }, { 0xDFCE, 0x02EF, 0x1381 }, { 0xD8DB, 0x9E66, 0x7EC5 },
+  { 0x7E3E, 0xF7D8, 0xCE3D }, { 0x792B, 0x6B51, 0xA379 }, { 0xA08A, 0xAFC2, 0x3E5A }, { 0xA79F, 0x334B, 0x531E },
+  { 0x7F44, 0xAD2D, 0x2DDB }, { 0x7851, 0x31A4, 0x409F }, { 0xA1F0, 0xF537, 0xDDBC }, { 0xA6E5, 0x69BE, 0xB0F8 }
+ },
+ {  // nibble 15
+  { 0x0000, 0x0000, 0x0000 }, { 0x6C75, 0x0971, 0x80B3 }, { 0x4B9C, 0xDA4C, 0x7B45 }, { 0x27E9, 0xD33D, 0xFBF6 },
+  { 0xEA12, 0x6576, 0xBA79 }, { 0x8667, 0x6C07, 0x3ACA }, { 0xA18E, 0xBF3A, 0xC13C }, { 0xCDFB, 0xB64B, 0x418F },
+  { 0x7F63, 0x43E0, 0x2C93 }, { 0x1316, 0x4A91, 0xAC20 }, { 0x34FF, 0x99AC, 0x57D6 }, { 0x588A, 0x90DD, 0xD765 },
+  { 0x9571, 0x2696, 0x96EA }, { 0xF904, 0x2FE7, 0x1659 }, { 0xDEED, 0xFCDA, 0xEDAF }, { 0xB298, 0xF5AB, 0x6D1C }
+ },
+ {  // nibble 16
+  { 0x0000, 0x0000, 0x0000 }, { 0x62C1, 0x2EED, 0x2489 }, { 0x7BAD, 0x21F0, 0xAD33 }, { 0x196C, 0x0F1D, 0x89BA },
+  { 0xC034, 0x0100, 0x0002 }, { 0xA2F5, 0x2FED, 0x248B }, { 0xBB99, 0x20F0, 0xAD31 }, { 0xD958, 0x0E1D, 0x89B8 },
+  { 0x183D, 0x7105, 0xFB3F }, { 0x7AFC, 0x5FE8, 0xDFB6 }, { 0x6390, 0x50F5, 0x560C }, { 0x0151, 0x7E18, 0x7285 },
+  { 0xD809, 0x7005, 0xFB3D }, { 0xBAC8, 0x5EE8, 0xDFB4 }, { 0xA3A4, 0x51F5, 0x560E }, { 0xC165, 0x7F18, 0x7287 }
+ },
+ {  // nibble 17
+  { 0x0000, 0x0000, 0x0000 }, { 0xE142, 0x5AB6, 0xC7A4 }, { 0x6785, 0xDDB4, 0x6744 }, { 0x86C7, 0x8702, 0xA0E0 },
+  { 0xBD8B, 0xAD9A, 0x8C28 }, { 0x5CC9, 0xF72C, 0x4B8C }, { 0xDA0E, 0x702E, 0xEB6C }, { 0x3B4C, 0x2A98, 0x2CC8 },
+  { 0x7F82, 0x09ED, 0x3701 }, { 0x9EC0, 0x535B, 0xF0A5 }, { 0x1807, 0xD459, 0x5045 }, { 0xF945, 0x8EEF, 0x97E1 },
+  { 0xC209, 0xA477, 0xBB29 }, { 0x234B, 0xFEC1, 0x7C8D }, { 0xA58C, 0x79C3, 0xDC6D }, { 0x44CE, 0x2375, 0x1BC9 }
+ },
+ {  // nibble 18
+  { 0x0000, 0x0000, 0x0000 }, { 0x8567, 0x72D6, 0x97BF }, { 0x7B5E, 0x6FF5, 0xB7F9 }, { 0xFE39, 0x1D23, 0x2046 },
+  { 0xD090, 0x7086, 0x4446 }, { 0x55F7, 0x0250, 0xD3F9 }, { 0xABCE, 0x1F73, 0xF3BF }, { 0x2EA9, 0x6DA5, 0x6400 },
+  { 0xF9F8, 0x6082, 0x1CCF }, { 0x7C9F, 0x1254, 0x8B70 }, { 0x82A6, 0x0F77, 0xAB36 }, { 0x07C1, 0x7DA1, 0x3C89 },
+  { 0x2968, 0x1004, 0x5889 }, { 0xAC0F, 0x62D2, 0xCF36 }, { 0x5236, 0x7FF1, 0xEF70 }, { 0xD751, 0x0D27, 0x78CF }
+ },
+ {  // nibble 19
+  { 0x0000, 0x0000, 0x0000 }, { 0xFDED, 0xAEC2, 0xBDBA }, { 0x9010, 0xBA6A, 0x4009 }, { 0x6DFD, 0x14A8, 0xFDB3 },
+  { 0x6DAF, 0xF2DA, 0xCC7F }, { 0x9042, 0x5C18, 0x71C5 }, { 0xFDBF, 0x48B0, 0x8C76 }, { 0x0052, 0xE672, 0x31CC },
+  { 0x9642, 0x7C1A, 0xD17D }, { 0x6BAF, 0xD2D8, 0x6CC7 }, { 0x0652, 0xC670, 0x9174 }, { 0xFBBF, 0x68B2, 0x2CCE },
+  { 0xFBED, 0x8EC0, 0x1D02 }, { 0x0600, 0x2002, 0xA0B8 }, { 0x6BFD, 0x34AA, 0x5D0B }, { 0x9610, 0x9A68, 0xE0B1 }
+ },
+ {  // nibble 20
+  { 0x0000, 0x0000, 0x0000 }, { 0x9C09, 0xB98A, 0x441D }, { 0xA036, 0x4E7D, 0x9B73 }, { 0x3C3F, 0xF7F7, 0xDF6E },
+  { 0xB217, 0xFE5A, 0x414D }, { 0x2E1E, 0x47D0, 0x0550 }, { 0x1221, 0xB027, 0xDA3E }, { 0x8E28, 0x09AD, 0x9E23 },
+  { 0xCFD3, 0x56E6, 0x43C4 }, { 0x53DA, 0xEF6C, 0x07D9 }, { 0x6FE5, 0x189B, 0xD8B7 }, { 0xF3EC, 0xA111, 0x9CAA },
+  { 0x7DC4, 0xA8BC, 0x0289 }, { 0xE1CD, 0x1136, 0x4694 }, { 0xDDF2, 0xE6C1, 0x99FA }, { 0x41FB, 0x5F4B, 0xDDE7 }
+ },
+ {  // nibble 21
+  { 0x0000, 0x0000, 0x0000 }, { 0x3C8B, 0x5371, 0xC174 }, { 0x5DCC, 0x69BC, 0xA6E9 }, { 0x6147, 0x3ACD, 0x679D },
+  { 0xD588, 0x62FF, 0x8669 }, { 0xE903, 0x318E, 0x471D }, { 0x8844, 0x0B43, 0x2080 }, { 0xB4CF, 0x5832, 0xE1F4 },
+  { 0x52FD, 0x1E7B, 0xE0A6 }, { 0x6E76, 0x4D0A, 0x21D2 }, { 0x0F31, 0x77C7, 0x464F }, { 0x33BA, 0x24B6, 0x873B },
+  { 0x8775, 0x7C84, 0x66CF }, { 0xBBFE, 0x2FF5, 0xA7BB }, { 0xDAB9, 0x1538, 0xC026 }, { 0xE632, 0x4649, 0x0152 }
+ },
+ {  // nibble 22
+  { 0x0000, 0x0000, 0x0000 }, { 0x0C7A, 0xAD1C, 0xAA3A }, { 0xF2B5, 0xF51A, 0xC0EF }, { 0xFECF, 0x5806, 0x6AD5 },
+  { 0x6049, 0xE1A0, 0x7FE9 }, { 0x6C33, 0x4CBC, 0xD5D3 }, { 0x92FC, 0x14BA, 0xBF06 }, { 0x9E86, 0xB9A6, 0x153C },
+  { 0x76E1, 0x1989, 0x5F97 }, { 0x7A9B, 0xB495, 0xF5AD }, { 0x8454, 0xEC93, 0x9F78 }, { 0x882E, 0x418F, 0x3542 },
+  { 0x16A8, 0xF829, 0x207E }, { 0x1AD2, 0x5535, 0x8A44 }, { 0xE41D, 0x0D33, 0xE091 }, { 0xE867, 0xA02F, 0x4AAB }
+ },
+ {  // nibble 23
+  { 0x0000, 0x0000, 0x0000 }, { 0xC67C, 0xE663, 0x30FB }, { 0x4DB0, 0x3998, 0xF92F }, { 0x8BCC, 0xDFFB, 0xC9D4 },
+  { 0x4C15, 0x664C, 0x8BE8 }, { 0x8A69, 0x802F, 0xBB13 }, { 0x01A5, 0x5FD4, 0x72C7 }, { 0xC7D9, 0xB9B7, 0x423C },
+  { 0x35A7, 0x23C4, 0x123B }, { 0xF3DB, 0xC5A7, 0x22C0 }, { 0x7817, 0x1A5C, 0xEB14 }, { 0xBE6B, 0xFC3F, 0xDBEF },
+  { 0x79B2, 0x4588, 0x99D3 }, { 0xBFCE, 0xA3EB, 0xA928 }, { 0x3402, 0x7C10, 0x60FC }, { 0xF27E, 0x9A73, 0x5007 }
+ },
+ {  // nibble 24
+  { 0x0000, 0x0000, 0x0000 }, { 0xB91B, 0xAFCA, 0x2C18 }, { 0x40B3, 0xA500, 0x111A }, { 0xF9A8, 0x0ACA, 0x3D02 },
+  { 0xC244, 0x9B57, 0xEBB5 }, { 0x7B5F, 0x349D, 0xC7AD }, { 0x82F7, 0x3E57, 0xFAAF }, { 0x3BEC, 0x919D, 0xD6B7 },
+  { 0xBE21, 0x9C26, 0x6B06 }, { 0x073A, 0x33EC, 0x471E }, { 0xFE92, 0x3926, 0x7A1C }, { 0x4789, 0x96EC, 0x5604 },
+  { 0x7C65, 0x0771, 0x80B3 }, { 0xC57E, 0xA8BB, 0xACAB }, { 0x3CD6, 0xA271, 0x91A9 }, { 0x85CD, 0x0DBB, 0xBDB1 }
+ },
+ {  // nibble 25
+  { 0x0000, 0x0000, 0x0000 }, { 0xB812, 0xB08A, 0x4E0F }, { 0x2826, 0xEE44, 0x9A7A }, { 0x9034, 0x5ECE, 0xD475 },
+  { 0x5024, 0xFF69, 0x415E }, { 0xE836, 0x4FE3, 0x0F51 }, { 0x7802, 0x112D, 0xDB24 }, { 0xC010, 0xA1A7, 0x952B },
+  { 0x2536, 0x3254, 0xF82D }, { 0x9D24, 0x82DE, 0xB622 }, { 0x0D10, 0xDC10, 0x6257 }, { 0xB502, 0x6C9A, 0x2C58 },
+  { 0x7512, 0xCD3D, 0xB973 }, { 0xCD00, 0x7DB7, 0xF77C }, { 0x5D34, 0x2379, 0x2309 }, { 0xE526, 0x93F3, 0x6D06 }
+ },
+ {  // nibble 26
+  { 0x0000, 0x0000, 0x0000 }, { 0x141B, 0xDD09, 0x7145 }, { 0xE2E4, 0x3AF8, 0xCFAE }, { 0xF6FF, 0xE7F1, 0xBEEB },
+  { 0x3591, 0xE931, 0xB9F9 }, { 0x218A, 0x3438, 0xC8BC }, { 0xD775, 0xD3C9, 0x7657 }, { 0xC36E, 0x0EC0, 0x0712 },
+  { 0xCF09, 0xB817, 0xF93A }, { 0xDB12, 0x651E, 0x887F }, { 0x2DED, 0x82EF, 0x3694 }, { 0x39F6, 0x5FE6, 0x47D1 },
+  { 0xFA98, 0x5126, 0x40C3 }, { 0xEE83, 0x8C2F, 0x3186 }, { 0x187C, 0x6BDE, 0x8F6D }, { 0x0C67, 0xB6D7, 0xFE28 }
+ },
+ {  // nibble 27
+  { 0x0000, 0x0000, 0x0000 }, { 0x4FFC, 0x0CB0, 0xBDBB }, { 0x05C1, 0xB359, 0xC9AD }, { 0x4A3D, 0xBFE9, 0x7416 },
+  { 0x4A4F, 0xA93C, 0x8EB9 }, { 0x05B3, 0xA58C, 0x3302 }, { 0x4F8E, 0x1A65, 0x4714 }, { 0x0072, 0x16D5, 0xFAAF },
+  { 0x76EB, 0x9999, 0xE5B7 }, { 0x3917, 0x9529, 0x580C }, { 0x732A, 0x2AC0, 0x2C1A }, { 0x3CD6, 0x2670, 0x91A1 },
+  { 0x3CA4, 0x30A5, 0x6B0E }, { 0x7358, 0x3C15, 0xD6B5 }, { 0x3965, 0x83FC, 0xA2A3 }, { 0x7699, 0x8F4C, 0x1F18 }
+ },
+ {  // nibble 28
+  { 0x0000, 0x0000, 0x0000 }, { 0xC99C, 0x13E6, 0x6704 }, { 0x7CE7, 0x0770, 0x81A3 }, { 0xB57B, 0x1496, 0xE6A7 },
+  { 0x7797, 0xA7EC, 0x0709 }, { 0xBE0B, 0xB40A, 0x600D }, { 0x0B70, 0xA09C, 0x86AA }, { 0xC2EC, 0xB37A, 0xE1AE },
+  { 0x484F, 0x2F5D, 0x8BF8 }, { 0x81D3, 0x3CBB, 0xECFC }, { 0x34A8, 0x282D, 0x0A5B }, { 0xFD34, 0x3BCB, 0x6D5F },
+  { 0x3FD8, 0x88B1, 0x8CF1 }, { 0xF644, 0x9B57, 0xEBF5 }, { 0x433F, 0x8FC1, 0x0D52 }, { 0x8AA3, 0x9C27, 0x6A56 }
+ },
+ {  // nibble 29
+  { 0x0000, 0x0000, 0x0000 }, { 0x7F3B, 0xA880, 0x3D1A }, { 0xC6D2, 0xC90F, 0x2AC8 }, { 0xB9E9, 0x618F, 0x17D2 },
+  { 0x8DCF, 0x929A, 0xFCB0 }, { 0xF2F4, 0x3A1A, 0xC1AA }, { 0x4B1D, 0x5B95, 0xD678 }, { 0x3426, 0xF315, 0xEB62 },
+  { 0x56E5, 0x12F8, 0xCDAE }, { 0x29DE, 0xBA78, 0xF0B4 }, { 0x9037, 0xDBF7, 0xE766 }, { 0xEF0C, 0x7377, 0xDA7C },
+  { 0xDB2A, 0x8062, 0x311E }, { 0xA411, 0x28E2, 0x0C04 }, { 0x1DF8, 0x496D, 0x1BD6 }, { 0x62C3, 0xE1ED, 0x26CC }
+ },
+ {  // nibble 30
+  { 0x0000, 0x0000, 0x0000 }, { 0xC681, 0xE76F, 0x2B59 }, { 0x9CD1, 0xB7FA, 0xEFAC }, { 0x5A50, 0x5095, 0xC4F5 },
+  { 0x9DA9, 0xC6BF, 0x3643 }, { 0x5B28, 0x21D0, 0x1D1A }, { 0x0178, 0x7145, 0xD9EF }, { 0xC7F9, 0x962A, 0xF2B6 },
+  { 0xC5A5, 0x1DB3, 0xDD6E }, { 0x0324, 0xFADC, 0xF637 }, { 0x5974, 0xAA49, 0x32C2 }, { 0x9FF5, 0x4D26, 0x199B },
+  { 0x580C, 0xDB0C, 0xEB2D }, { 0x9E8D, 0x3C63, 0xC074 }, { 0xC4DD, 0x6CF6, 0x0481 }, { 0x025C, 0x8B99, 0x2FD8 }
+ },
+ {  // nibble 31
+  { 0x0000, 0x0000, 0x0000 }, { 0xC1FA, 0x54DB, 0xFD77 }, { 0x98CB, 0x9A57, 0x4C90 }, { 0x5931, 0xCE8C, 0xB1E7 },
+  { 0x3FDC, 0x27F0, 0xBDB9 }, { 0xFE26, 0x732B, 0x40CE }, { 0xA717, 0xBDA7, 0xF129 }, { 0x66ED, 0xE97C, 0x0C5E },
+  { 0xACB2, 0x83CF, 0x3702 }, { 0x6D48, 0xD714, 0xCA75 }, { 0x3479, 0x1998, 0x7B92 }, { 0xF583, 0x4D43, 0x86E5 },
+  { 0x936E, 0xA43F, 0x8ABB }, { 0x5294, 0xF0E4, 0x77CC }, { 0x0BA5, 0x3E68, 0xC62B }, { 0xCA5F, 0x6AB3, 0x3B5C }
+ },
+ {  // nibble 32
+  { 0x0000, 0x0000, 0x0000 }, { 0x1474, 0x9914, 0xCBA7 }, { 0x5A00, 0xDEF4, 0xC476 }, { 0x4E74, 0x47E0, 0x0FD1 },
+  { 0xB68D, 0x337B, 0xE02C }, { 0xA2F9, 0xAA6F, 0x2B8B }, { 0xEC8D, 0xED8F, 0x245A }, { 0xF8F9, 0x749B, 0xEFFD },
+  { 0x233E, 0xBFD5, 0xD71F }, { 0x374A, 0x26C1, 0x1CB8 }, { 0x793E, 0x6121, 0x1369 }, { 0x6D4A, 0xF835, 0xD8CE },
+  { 0x95B3, 0x8CAE, 0x3733 }, { 0x81C7, 0x15BA, 0xFC94 }, { 0xCFB3, 0x525A, 0xF345 }, { 0xDBC7, 0xCB4E, 0x38E2 }
+ },
+ {  // nibble 33
+  { 0x0000, 0x0000, 0x0000 }, { 0xE623, 0x0772, 0xB12B }, { 0x10B4, 0x3F65, 0x4B0E }, { 0xF697, 0x3817, 0xFA25 },
+  { 0x71DF, 0xEE11, 0x83E8 }, { 0x97FC, 0xE963, 0x32C3 }, { 0x616B, 0xD174, 0xC8E6 }, { 0x8748, 0xD606, 0x79CD },
+  { 0xB42B, 0x9D97, 0xE527 }, { 0x5208, 0x9AE5, 0x540C }, { 0xA49F, 0xA2F2, 0xAE29 }, { 0x42BC, 0xA580, 0x1F02 },
+  { 0xC5F4, 0x7386, 0x66CF }, { 0x23D7, 0x74F4, 0xD7E4 }, { 0xD540, 0x4CE3, 0x2DC1 }, { 0x3363, 0x4B91, 0x9CEA }
+ },
+ {  // nibble 34
+  { 0x0000, 0x0000, 0x0000 }, { 0x1908, 0x6B60, 0x12CB }, { 0x6138, 0xB649, 0x621E }, { 0x7830, 0xDD29, 0x70D5 },
+  { 0x38B1, 0x3104, 0x1B1F }, { 0x21B9, 0x5A64, 0x09D4 }, { 0x5989, 0x874D, 0x7901 }, { 0x4081, 0xEC2D, 0x6BCA },
+  { 0x6FA7, 0xF2B9, 0xC77E }, { 0x76AF, 0x99D9, 0xD5B5 }, { 0x0E9F, 0x44F0, 0xA560 }, { 0x1797, 0x2F90, 0xB7AB },
+  { 0x5716, 0xC3BD, 0xDC61 }, { 0x4E1E, 0xA8DD, 0xCEAA }, { 0x362E, 0x75F4, 0xBE7F }, { 0x2F26, 0x1E94, 0xACB4 }
+ },
+ {  // nibble 35
+  { 0x0000, 0x0000, 0x0000 }, { 0xBE05, 0x2C63, 0x3009 }, { 0x336B, 0xC2FC, 0x97F3 }, { 0x8D6E, 0xEE9F, 0xA7FA },
+  { 0xC78F, 0xF347, 0x4855 }, { 0x798A, 0xDF24, 0x785C }, { 0xF4E4, 0x31BB, 0xDFA6 }, { 0x4AE1, 0x1DD8, 0xEFAF },
+  { 0x7BF2, 0x8411, 0xA7A0 }, { 0xC5F7, 0xA872, 0x97A9 }, { 0x4899, 0x46ED, 0x3053 }, { 0xF69C, 0x6A8E, 0x005A },
+  { 0xBC7D, 0x7756, 0xEFF5 }, { 0x0278, 0x5B35, 0xDFFC }, { 0x8F16, 0xB5AA, 0x7806 }, { 0x3113, 0x99C9, 0x480F }
+ },
+ {  // nibble 36
+  { 0x0000, 0x0000, 0x0000 }, { 0xD8D0, 0xD087, 0x46C5 }, { 0x26E5, 0xC26C, 0x3F93 }, { 0xFE35, 0x12EB, 0x7956 },
+  { 0x2C15, 0xAC01, 0x3008 }, { 0xF4C5, 0x7C86, 0x76CD }, { 0x0AF0, 0x6E6D, 0x0F9B }, { 0xD220, 0xBEEA, 0x495E },
+  { 0x1D8A, 0x4B51, 0xA160 }, { 0xC55A, 0x9BD6, 0xE7A5 }, { 0x3B6F, 0x893D, 0x9EF3 }, { 0xE3BF, 0x59BA, 0xD836 },
+  { 0x319F, 0xE750, 0x9168 }, { 0xE94F, 0x37D7, 0xD7AD }, { 0x177A, 0x253C, 0xAEFB }, { 0xCFAA, 0xF5BB, 0xE83E }
+ },
+ {  // nibble 37
+  { 0x0000, 0x0000, 0x0000 }, { 0x175E, 0x07C0, 0x1C90 }, { 0xAEBB, 0xC65F, 0x1A42 }, { 0xB9E5, 0xC19F, 0x06D2 },
+  { 0xD4E8, 0xB6FA, 0xA4BE }, { 0xC3B6, 0xB13A, 0xB82E }, { 0x7A53, 0x70A5, 0xBEFC }, { 0x6D0D, 0x7765, 0xA26C },
+  { 0x5462, 0xF821, 0x71CE }, { 0x433C, 0xFFE1, 0x6D5E }, { 0xFAD9, 0x3E7E, 0x6B8C }, { 0xED87, 0x39BE, 0x771C },
+  { 0x808A, 0x4EDB, 0xD570 }, { 0x97D4, 0x491B, 0xC9E0 }, { 0x2E31, 0x8884, 0xCF32 }, { 0x396F, 0x8F44, 0xD3A2 }
+ },
+ {  // nibble 38
+  { 0x0000, 0x0000, 0x0000 }, { 0x101B, 0x9509, 0x7105 }, { 0x9B9E, 0xEA5A, 0x8368 }, { 0x8B85, 0x7F53, 0xF26D },
+  { 0xA270, 0xCA7F, 0x9BE3 }, { 0xB26B, 0x5F76, 0xEAE6 }, { 0x39EE, 0x2025, 0x188B }, { 0x29F5, 0xB52C, 0x698E },
+  { 0xFC35, 0x92DB, 0x9D36 }, { 0xEC2E, 0x07D2, 0xEC33 }, { 0x67AB, 0x7881, 0x1E5E }, { 0x77B0, 0xED88, 0x6F5B },
+  { 0x5E45, 0x58A4, 0x06D5 }, { 0x4E5E, 0xCDAD, 0x77D0 }, { 0xC5DB, 0xB2FE, 0x85BD }, { 0xD5C0, 0x27F7, 0xF4B8 }
+ },
+ {  // nibble 39
+  { 0x0000, 0x0000, 0x0000 }, { 0x18C1, 0x7438, 0xD1EC }, { 0x20D6, 0x2E50, 0xD0B8 }, { 0x3817, 0x5A68, 0x0154 },
+  { 0x60B5, 0xF118, 0xE05F }, { 0x7874, 0x8520, 0x31B3 }, { 0x4063, 0xDF48, 0x30E7 }, { 0x58A2, 0xAB70, 0xE10B },
+  { 0x6E93, 0x2DAD, 0x2589 }, { 0x7652, 0x5995, 0xF465 }, { 0x4E45, 0x03FD, 0xF531 }, { 0x5684, 0x77C5, 0x24DD },
+  { 0x0E26, 0xDCB5, 0xC5D6 }, { 0x16E7, 0xA88D, 0x143A }, { 0x2EF0, 0xF2E5, 0x156E }, { 0x3631, 0x86DD, 0xC482 }
+ }
+} ;
+#endif // LDPC_ENCODE_NIBBLE_TABLE
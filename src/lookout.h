@@ -0,0 +1,207 @@
+#ifndef __LOOKOUT_H__
+#define __LOOKOUT_H__
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "intmath.h"
+#include "format.h"
+
+// Collision prediction: own and target tracks are extrapolated in one second steps over a horizon of 20-30 seconds
+// with their speed, heading, turn rate and climb, all in fixed point. The step of the closest approach gives the warning level.
+// Positions are relative to own position in 1/128 meter units, velocities in 1/128 m/s.
+// The heading changes by rotating the velocity vector with the sine/cosine of the turn per step:
+// no trigonometric functions inside the step loop. Own track is computed once and shared by all the targets.
+// The cost per target is bounded by the horizon and the number of targets by MaxTargets.
+// Targets which can not come close within the horizon are not extrapolated:
+// their closest approach is taken along straight lines, to be reported but never to warn.
+
+class LookOut_Target                          // result of the prediction for one target
+{ public:
+   uint32_t AddressAndType;                   // address-type and address (2+24 = 26 bits)
+   uint16_t MissDist;                         // [m] distance at the closest approach (vertical counts double)
+    int16_t MissAlt;                          // [m] vertical separation at the closest approach
+   uint8_t  TimeToCPA;                        // [sec] time to the closest approach
+   uint8_t  Warn;                             // warning level: 0 = none, 1 = low, 2 = important, 3 = urgent
+
+  public:
+   void Clear(void) { AddressAndType=0; MissDist=0xFFFF; MissAlt=0; TimeToCPA=0xFF; Warn=0; }
+
+   uint8_t Print(char *Out) const             // print: address, warning level, time and distance of the closest approach
+   { uint8_t Len=0;
+     Out[Len++]='0'+(AddressAndType>>24); Out[Len++]=':';
+     Len+=Format_Hex(Out+Len, (uint8_t)(AddressAndType>>16));
+     Len+=Format_Hex(Out+Len, (uint16_t)AddressAndType);
+     Out[Len++]=' '; Out[Len++]='W'; Out[Len++]='0'+Warn;
+     Out[Len++]=' '; Len+=Format_UnsDec(Out+Len, (uint16_t)TimeToCPA); Out[Len++]='s';
+     Out[Len++]=' '; Len+=Format_UnsDec(Out+Len, MissDist); Out[Len++]='m';
+     Out[Len++]=' '; Len+=Format_SignDec(Out+Len, MissAlt); Out[Len++]='m';
+     Out[Len]=0; return Len; }
+
+} ;
+
+template <uint8_t MaxTargets=64>
+ class LookOut
+{ public:
+   static const uint8_t  MaxHorizon = 30;     // [sec] longest prediction
+   static const uint8_t  PosBits    = 7;      // [1/128 m] fixed point positions and velocities
+   static const int32_t  MaxRange   = 0x3FFF; // [m] targets further than that are not considered
+
+   uint8_t  Horizon;                          // [sec] how far to predict: 20-30 sec
+   uint16_t WarnDist;                         // [m] warn when the closest approach is below that
+   uint8_t  WarnTime[2];                      // [sec] time to the closest approach for warning levels 3 and 2, level 1 up to the horizon
+
+   int32_t  OwnX[MaxHorizon+1];               // [1/128 m] own track: east
+   int32_t  OwnY[MaxHorizon+1];               // [1/128 m] own track: north
+   int32_t  OwnZ[MaxHorizon+1];               // [1/128 m] own track: up
+   uint16_t OwnSpeed;                         // [0.1m/s]
+   int32_t  OwnV[3];                          // [1/128 m/s] own velocity now: east, north, up
+
+   LookOut_Target Target[MaxTargets];         // results for the targets of this round
+   uint8_t  Targets;                          // number of targets in this round
+   uint8_t  Worst;                            // target with the highest warning level, MaxTargets when none
+   uint32_t Steps;                            // [steps] extrapolation steps made, to check the CPU use
+
+  public:
+   LookOut() { Horizon=20; WarnDist=200; WarnTime[0]=8; WarnTime[1]=13; Clear(); }
+
+   void Clear(void) { Targets=0; Worst=MaxTargets; Steps=0; }
+
+   static int16_t Angle(int16_t Heading) { return ((int32_t)Heading<<12)/225; } // [0.1deg] => [16-bit cordic]
+
+   static int32_t Velocity(int16_t Speed) { return ((int32_t)Speed*205+8)>>4; } // [0.1m/s] => [1/128 m/s]
+
+   // start a new round: own track from speed, heading, climb and turn rate
+   void setOwn(int16_t Speed, int16_t Heading, int16_t ClimbRate, int16_t TurnRate) // [0.1m/s], [0.1deg], [0.1m/s], [0.1deg/s]
+   { Clear();
+     if(Horizon>MaxHorizon) Horizon=MaxHorizon;
+     OwnSpeed = Speed>0 ? Speed:0;
+     int32_t X=0, Y=0, Z=0;
+     OwnX[0]=X; OwnY[0]=Y; OwnZ[0]=Z;
+     int32_t Vx, Vy, Vz; int16_t C, S;
+     Start(Vx, Vy, Vz, C, S, Speed, Heading, ClimbRate, TurnRate);
+     OwnV[0]=Vx; OwnV[1]=Vy; OwnV[2]=Vz;
+     for(uint8_t Time=1; Time<=Horizon; Time++)
+     { Step(X, Y, Z, Vx, Vy, Vz, C, S);
+       OwnX[Time]=X; OwnY[Time]=Y; OwnZ[Time]=Z; }
+   }
+
+   // predict a target: position relative to own [m], its motion and how old the position is [ms]: returns the warning level or -1 when no more space
+   int8_t addTarget(uint32_t AddressAndType, int32_t East, int32_t North, int32_t Up,
+                    int16_t Speed, int16_t Heading, int16_t ClimbRate, int16_t TurnRate, int16_t Age=0)
+   { if(Targets>=MaxTargets) return -1;
+     LookOut_Target &Tgt = Target[Targets];
+     Tgt.Clear(); Tgt.AddressAndType=AddressAndType;
+     calcTarget(Tgt, East, North, Up, Speed, Heading, ClimbRate, TurnRate, Age);
+     if(Tgt.Warn && (Worst>=MaxTargets || Tgt.Warn>Target[Worst].Warn ||
+        (Tgt.Warn==Target[Worst].Warn && Tgt.MissDist<Target[Worst].MissDist)) ) Worst=Targets;
+     Targets++;
+     return Tgt.Warn; }
+
+   const LookOut_Target *getWorst(void) const { return Worst<MaxTargets ? Target+Worst:0; }
+
+   uint8_t Print(char *Out) const             // print: targets and the most dangerous one
+   { uint8_t Len=0;
+     Len+=Format_UnsDec(Out+Len, (uint16_t)Targets); Out[Len++]='/';
+     Len+=Format_UnsDec(Out+Len, (uint16_t)MaxTargets);
+     const LookOut_Target *Tgt=getWorst();
+     if(Tgt) { Out[Len++]=' '; Len+=Tgt->Print(Out+Len); }
+     Out[Len]=0; return Len; }
+
+  private:
+   static void Start(int32_t &Vx, int32_t &Vy, int32_t &Vz, int16_t &C, int16_t &S,
+                     int16_t Speed, int16_t Heading, int16_t ClimbRate, int16_t TurnRate)
+   { if(Speed<0) Speed=0;
+     int32_t V = Velocity(Speed);
+     int16_t Head = Angle(Heading);
+     Vx = (V*Isin(Head)+0x800)>>12;                             // east
+     Vy = (V*Icos(Head)+0x800)>>12;                             // north
+     Vz = Velocity(ClimbRate);
+     int16_t Turn = Angle(TurnRate);                           // turn per step (one second)
+     C = Icos(Turn); S = Isin(Turn); }
+
+   static void Step(int32_t &X, int32_t &Y, int32_t &Z, int32_t &Vx, int32_t &Vy, int32_t Vz, int16_t C, int16_t S) // one second forward
+   { int32_t Vx2 = (Vx*C + Vy*S + 0x800)>>12;                  // turn the velocity: heading increases clockwise
+     int32_t Vy2 = (Vy*C - Vx*S + 0x800)>>12; 
+     X += (Vx+Vx2)>>1; Y += (Vy+Vy2)>>1; Z += Vz;              // average velocity over the step
+     Vx=Vx2; Vy=Vy2; }
+
+   void calcTarget(LookOut_Target &Tgt, int32_t East, int32_t North, int32_t Up,
+                   int16_t Speed, int16_t Heading, int16_t ClimbRate, int16_t TurnRate, int16_t Age)
+   { if(Speed<0) Speed=0;
+     int32_t Vx, Vy, Vz; int16_t C, S;
+     if(Age) Heading += ((int32_t)TurnRate*Age)/1000;          // the target position is older than own: bring it forward
+     Start(Vx, Vy, Vz, C, S, Speed, Heading, ClimbRate, TurnRate);
+     uint32_t Range = abs(East)+abs(North);                    // [m] (over)estimate of the distance
+     uint32_t Close = ((uint32_t)(OwnSpeed+Speed)*Horizon*3/2+5)/10 + WarnDist; // [m] max. closing within the horizon (with margin)
+     if(abs(East)>MaxRange || abs(North)>MaxRange || Range>2*Close) // too far or can not come close: skip the extrapolation
+     { calcLinear(Tgt, East, North, Up, Vx, Vy, Vz, Age); return; }
+     int32_t X=East<<PosBits, Y=North<<PosBits, Z=Up<<PosBits;
+     if(Age) { X += (Vx*Age)/1000; Y += (Vy*Age)/1000; Z += (Vz*Age)/1000; }
+     int32_t Prev[3], Rel[3], MinPrev[3], MinRel[3], MinNext[3];   // [m] relative positions: before, at and after the closest step
+     uint32_t MinDist=calcRel(Rel, X, Y, Z, 0); uint8_t MinTime=0; bool Next=0;
+     copy(MinRel, Rel); copy(MinPrev, Rel); copy(MinNext, Rel);
+     for(uint8_t Time=1; Time<=Horizon; Time++)
+     { copy(Prev, Rel);
+       Step(X, Y, Z, Vx, Vy, Vz, C, S);
+       uint32_t Dist=calcRel(Rel, X, Y, Z, Time);
+       if(Dist<MinDist) { MinDist=Dist; MinTime=Time; copy(MinPrev, Prev); copy(MinRel, Rel); Next=0; }
+       else if(Time==MinTime+1) { copy(MinNext, Rel); Next=1; } }
+     Steps+=Horizon;
+     int16_t Frac=0; int32_t MinAlt=MinRel[2];                // [1/16 sec] closest approach between the steps
+     if(MinDist!=0xFFFFFFFF)
+     { if(MinTime>0) Refine(MinDist, Frac, MinAlt, MinRel, MinPrev, -16);
+       if(Next)      Refine(MinDist, Frac, MinAlt, MinRel, MinNext,  16); }
+     uint32_t Miss=IntSqrt(MinDist);                          // [m]
+     Tgt.MissDist = Miss<0xFFFF ? Miss:0xFFFF;
+     Tgt.MissAlt  = MinAlt/2;
+     MinTime = ((int16_t)MinTime*16+Frac+8)>>4; Tgt.TimeToCPA = MinTime;
+     if(Miss>WarnDist) return;
+          if(MinTime<=WarnTime[0]) Tgt.Warn=3;
+     else if(MinTime<=WarnTime[1]) Tgt.Warn=2;
+     else                          Tgt.Warn=1;
+   }
+
+   // closest approach along straight lines with the present velocities, within the horizon: for the targets not extrapolated
+   void calcLinear(LookOut_Target &Tgt, int32_t East, int32_t North, int32_t Up, int32_t Vx, int32_t Vy, int32_t Vz, int16_t Age) const
+   { int64_t Pos[3] = { (int64_t)East<<PosBits, (int64_t)North<<PosBits, (int64_t)Up<<(PosBits+1) }; // [1/128 m] vertical counts double
+     int64_t Vel[3] = { Vx-OwnV[0], Vy-OwnV[1], 2*(Vz-OwnV[2]) }; // [1/128 m/s] relative velocity
+     if(Age) { Pos[0] += ((int64_t)Vx*Age)/1000; Pos[1] += ((int64_t)Vy*Age)/1000; Pos[2] += ((int64_t)2*Vz*Age)/1000; }
+     int64_t Dot  = -(Pos[0]*Vel[0]+Pos[1]*Vel[1]+Pos[2]*Vel[2]); // positive when getting closer
+     int64_t Norm = Vel[0]*Vel[0]+Vel[1]*Vel[1]+Vel[2]*Vel[2];
+     int32_t Time = 0;                                         // [1/16 sec]
+     if(Dot>0 && Norm>0) Time = Dot*16>=Norm*16*Horizon ? 16*Horizon : (Dot*16+Norm/2)/Norm;
+     uint64_t Dist=0;                                          // [m^2]
+     for(uint8_t Axis=0; Axis<3; Axis++)
+     { Pos[Axis] += (Vel[Axis]*Time)/16;
+       int64_t D = Pos[Axis]>>PosBits; Dist += D*D; }
+     uint32_t Miss=IntSqrt(Dist);                              // [m]
+     Tgt.MissDist = Miss<0xFFFF ? Miss:0xFFFF;
+     int64_t Alt = Pos[2]>>(PosBits+1);
+     Tgt.MissAlt  = Alt>0x7FFF ? 0x7FFF : Alt<(-0x7FFF) ? (-0x7FFF) : Alt;
+     Tgt.TimeToCPA = (Time+8)>>4; }
+
+   static void copy(int32_t *Dst, const int32_t *Src) { Dst[0]=Src[0]; Dst[1]=Src[1]; Dst[2]=Src[2]; }
+
+   // the relative motion is close to linear over one step: look for a closer approach on the way to the neighbour step
+   static void Refine(uint32_t &MinDist, int16_t &Frac, int32_t &MinAlt, const int32_t *Rel, const int32_t *Neighbour, int16_t Dir)
+   { int32_t dX=Neighbour[0]-Rel[0], dY=Neighbour[1]-Rel[1], dZ=Neighbour[2]-Rel[2];
+     int32_t Norm = dX*dX+dY*dY+dZ*dZ; if(Norm==0) return;
+     int32_t Dot  = -(Rel[0]*dX+Rel[1]*dY+Rel[2]*dZ);        // positive when getting closer towards the neighbour
+     if(Dot<=0) return;
+     int32_t Part = Dot>=Norm ? 16 : (Dot*16+Norm/2)/Norm;   // [1/16] of the way
+     if(Part<=0) return;
+     int32_t X=Rel[0]+(dX*Part)/16, Y=Rel[1]+(dY*Part)/16, Z=Rel[2]+(dZ*Part)/16;
+     uint32_t Dist=(uint32_t)(X*X)+(uint32_t)(Y*Y)+(uint32_t)(Z*Z);
+     if(Dist>=MinDist) return;
+     MinDist=Dist; MinAlt=Z; Frac = Dir<0 ? -(int16_t)Part:Part; }
+
+   uint32_t calcRel(int32_t *Rel, int32_t X, int32_t Y, int32_t Z, uint8_t Time) const // [m^2] squared distance to own position, vertical counts double
+   { int32_t dX=(X-OwnX[Time])>>PosBits, dY=(Y-OwnY[Time])>>PosBits, dZ=(Z-OwnZ[Time])>>(PosBits-1);
+     Rel[0]=dX; Rel[1]=dY; Rel[2]=dZ;
+     if(abs(dX)>MaxRange || abs(dY)>MaxRange || abs(dZ)>MaxRange) return 0xFFFFFFFF;
+     return (uint32_t)(dX*dX) + (uint32_t)(dY*dY) + (uint32_t)(dZ*dZ); }
+
+} ;
+
+#endif // __LOOKOUT_H__
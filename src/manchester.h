@@ -1,6 +1,8 @@
 #ifndef __MANCHESTER_H_
 #define __MANCHESTER_H_
 
+#include <stdint.h>
+
 const uint8_t ManchesterEncode[0x10] =  // lookup table for 4-bit nibbles for quick Manchester encoding
 {
    0xAA, // hex: 0, bin: 0000, manch: 10101010
@@ -2,6 +2,8 @@
 #define __NMEA_H__
 
 #include <stdint.h>
+#include <stddef.h>
+#include <string.h>
 
 uint8_t NMEA_Check(uint8_t *NMEA, uint8_t Len);
 uint8_t NMEA_AppendCheck(uint8_t *NMEA, uint8_t Len);
@@ -9,24 +11,33 @@ inline uint8_t NMEA_AppendCheck(char *NMEA, uint8_t Len) { return NMEA_AppendChe
 uint8_t NMEA_AppendCheckCRNL(uint8_t *NMEA, uint8_t Len);
 inline uint8_t NMEA_AppendCheckCRNL(char *NMEA, uint8_t Len) { return NMEA_AppendCheckCRNL((uint8_t*)NMEA, Len); }
 
+constexpr uint32_t NMEA_Type(char A, char B, char C)    // sentence type packed for a switch(): GGA, RMC, GSV, ...
+{ return ((uint32_t)(uint8_t)A<<16) | ((uint32_t)(uint8_t)B<<8) | (uint8_t)C; }
+
+constexpr uint16_t NMEA_Talker(char A, char B)          // talker packed for a switch(): GP, GN, GL, BD, ...
+{ return ((uint16_t)(uint8_t)A<<8) | (uint8_t)B; }
+
  class NMEA_RxMsg                    // receiver for the NMEA sentences
 { public:
    static const uint8_t MaxLen=120;  // maximum length
    static const uint8_t MaxParms=24; // maximum number of parameters (commas)
-   uint8_t Data[MaxLen];             // the message itself
+   uint8_t Data[MaxLen];             // the message itself, when it had to be copied
+   uint8_t *Msg;                     // the message: points to Data[] or in place into the block given to ProcessBlock()
    uint8_t Len;                      // number of bytes
    uint8_t Parms;                    // number of commas
    uint8_t Parm[MaxParms];           // offset to each comma
-   uint8_t State;                    // bits: 0:loading, 1:complete, 2:locked,
+   uint8_t State;                    // bits: 0:loading, 1:complete, 2:locked, 3:indexed
    uint8_t Check;                    // check sum: should be a XOR of all bytes between '$' and '*'
 
   public:
+   NMEA_RxMsg() { Clear(); }
+
    void Clear(void)                          // Clear the frame: discard all data, ready for next message
-     { State=0; Len=0; Parms=0; }
+     { State=0; Len=0; Parms=0; Msg=Data; }
 
    void Send(void (*SendByte)(char) ) const
    { for(uint8_t Idx=0; Idx<Len; Idx++)
-     { (*SendByte)(Data[Idx]); }
+     { (*SendByte)(Msg[Idx]); }
      (*SendByte)('\r'); (*SendByte)('\n'); }
 
    void ProcessByte(uint8_t Byte)            // pass all bytes through this call and it will build the frame
@@ -35,7 +46,7 @@ inline uint8_t NMEA_AppendCheckCRNL(char *NMEA, uint8_t Len) { return NMEA_Appen
        if(Len==0)                            // if data is empty
        { if(Byte!='$') return;               // then ignore all bytes but '$'
          Data[Len++]=Byte;                   // start storing the frame
-         setLoading(); Check=0x00; Parms=0; } // set state to "isLoading", clear checksum
+         setLoading(); setIndexed(); Check=0x00; Parms=0; } // set state to "isLoading", clear checksum
 /*
        if(Byte=='$')                         // should '$' sign restart an ongoing NMEA sentence ?
        { Len=0; Data[Len++]=Byte;
@@ -45,7 +56,7 @@ inline uint8_t NMEA_AppendCheckCRNL(char *NMEA, uint8_t Len) { return NMEA_Appen
        { if((Byte=='\r')||(Byte=='\n'))      // if CR (or NL ?) then frame is complete
          { setComplete(); if(Len<MaxLen) Data[Len]=0;
            return; }
-         else if(Byte<=' ')                  // other control bytes treat as errors
+         else if(Byte<=' ' || Byte>=0x80)    // other control bytes and non-ASCII treat as errors
          { Clear(); return; }                // and drop the frame
          else if(Byte==',')                  // save comma positions to later get back to the fields
          { if(Parms<MaxParms) Parm[Parms++]=Len+1; }       // save the position just after the comma
@@ -54,6 +65,67 @@ inline uint8_t NMEA_AppendCheckCRNL(char *NMEA, uint8_t Len) { return NMEA_Appen
        }
        return; }
 
+   size_t ProcessBlock(uint8_t *Block, size_t BlockLen)          // pass blocks of bytes: the sentence is framed, but commas and the check-sum are left to Index()
+     { size_t Idx=0;                                               // returns the number of bytes taken: stops after a complete sentence
+       while(Idx<BlockLen && !isComplete())                        // a sentence complete in this block stays in place: the block must not change until Clear()
+       { if(Len==0)                                                // not in a sentence: look for the '$'
+         { const uint8_t *Start = (const uint8_t *)memchr(Block+Idx, '$', BlockLen-Idx);
+           if(Start==0) return BlockLen;
+           Idx=Start-Block;
+           size_t Ctrl = Idx+ScanCtrl(Block+Idx, BlockLen-Idx);    // first control byte: CR/LF or an error
+           if(Ctrl<BlockLen && Ctrl-Idx<=MaxLen)                   // whole sentence in this block: no copy
+           { uint8_t Byte=Block[Ctrl];
+             if((Byte!='\r')&&(Byte!='\n')) return Ctrl;          // other control bytes treat as errors: left for the caller
+             Msg=Block+Idx; Len=Ctrl-Idx; setLoading(); setComplete(); Msg[Len]=0;
+             return Ctrl+1; } }
+         size_t Ctrl = Idx+ScanCtrl(Block+Idx, BlockLen-Idx);      // first control byte: CR/LF or an error
+         size_t Taken = Append(Block+Idx, Ctrl-Idx);               // copy the bytes up to it
+         Idx+=Taken; if(Idx<Ctrl) continue;                        // dropped as too long: look for the next '$'
+         if(Idx>=BlockLen) break;                                  // sentence continues in the next block
+         uint8_t Byte=Block[Idx];
+         if((Byte!='\r')&&(Byte!='\n')) { Clear(); return Idx; }   // other control bytes treat as errors: left for the caller
+         Idx++; setComplete(); if(Len<MaxLen) Data[Len]=0; }
+       return Idx; }
+
+   static size_t ScanCtrl(const uint8_t *Block, size_t BlockLen)   // index of the first byte <=' ' or non-ASCII, BlockLen if none
+     { size_t Idx=0;
+       for( ; Idx<BlockLen && ((size_t)(Block+Idx)&3); Idx++)        // byte by byte up to a word boundary
+         if(Block[Idx]<=' ' || Block[Idx]>=0x80) return Idx;
+       for( ; Idx+4<=BlockLen; Idx+=4)                             // then four bytes at a time
+       { uint32_t Word; memcpy(&Word, Block+Idx, 4);
+         if(((Word-0x21212121)|Word)&0x80808080) break; }          // a byte below 0x21 or above 0x7F somewhere in this word
+       for( ; Idx<BlockLen; Idx++)
+         if(Block[Idx]<=' ' || Block[Idx]>=0x80) return Idx;
+       return BlockLen; }
+
+   size_t Append(const uint8_t *Seg, size_t SegLen)                // append bytes which are known not to be control bytes
+     { if(SegLen==0) return 0;                                     // returns the number of bytes taken
+       size_t Taken=0;
+       if(Len==0)                                                  // start of the sentence: the '$'
+       { Data[Len++]=*Seg++; SegLen--; Taken++;
+         setLoading(); Check=0x00; Parms=0; }
+       if(Len+SegLen>MaxLen)                                       // if too long, then drop the frame completely
+       { Taken+=MaxLen-Len+1; Clear(); return Taken; }             // including the byte which did not fit
+       memcpy(Data+Len, Seg, SegLen); Len+=SegLen;
+       return Taken+SegLen; }
+
+   uint8_t Index(void)                                             // check-sum and comma positions, return the number of fields
+     { if(isIndexed()) return Parms;                               // only needed for the sentences which are read
+       uint8_t Xor=0; Parms=0;
+       for(uint8_t Idx=1; Idx<Len; Idx++)
+       { uint8_t Byte=Msg[Idx]; Xor^=Byte;
+         if(Byte==',' && Parms<MaxParms) Parm[Parms++]=Idx+1; }
+       Check=Xor; setIndexed();
+       return Parms; }
+
+   uint32_t getType(void) const                                    // sentence type packed as NMEA_Type(), 0 if too short
+     { if(Len<6) return 0;
+       return ((uint32_t)Msg[3]<<16) | ((uint32_t)Msg[4]<<8) | Msg[5]; }
+
+   uint16_t getTalker(void) const                                  // talker packed as NMEA_Talker(), 0 if too short
+     { if(Len<3) return 0;
+       return ((uint16_t)Msg[1]<<8) | Msg[2]; }
+
    uint8_t isLoading(void) const  { return State &0x01; }
    void   setLoading(void)        {        State|=0x01; }
 
@@ -62,17 +134,20 @@ inline uint8_t NMEA_AppendCheckCRNL(char *NMEA, uint8_t Len) { return NMEA_Appen
 
    uint8_t isLocked(void) const   { return State&0x04; }
 
+   uint8_t isIndexed(void) const  { return State &0x08; }
+   void   setIndexed(void)        {        State|=0x08; }
+
    uint8_t isEmpty(void) const    { return Len==0; }
 
    uint8_t hasCheck(void) const
      { if(Len<4) return 0;
-       return Data[Len-3]=='*'; }
+       return Msg[Len-3]=='*'; }
 
-   uint8_t isChecked(void) const    // is the NMEA checksum OK ?
+   uint8_t isChecked(void) const    // is the NMEA checksum OK ? (after Index() for sentences from ProcessBlock())
      { if(!hasCheck()) return 0;
-       uint8_t DataCheck = Check^Data[Len-3]^Data[Len-2]^Data[Len-1];
-       int8_t HighDigit=HexValue(Data[Len-2]); if(HighDigit<0) return 0;
-       int8_t LowDigit=HexValue(Data[Len-1]); if(LowDigit<0) return 0;
+       uint8_t DataCheck = Check^Msg[Len-3]^Msg[Len-2]^Msg[Len-1];
+       int8_t HighDigit=HexValue(Msg[Len-2]); if(HighDigit<0) return 0;
+       int8_t LowDigit=HexValue(Msg[Len-1]); if(LowDigit<0) return 0;
        uint8_t FrameCheck = (HighDigit<<4) | LowDigit;
        return DataCheck==FrameCheck; }
 /*
@@ -92,7 +167,7 @@ inline uint8_t NMEA_AppendCheckCRNL(char *NMEA, uint8_t Len) { return NMEA_Appen
 
    const uint8_t *ParmPtr(uint8_t Field) const            // get a pointer to given (comma separated) field
      { if(Field>=Parms) return 0;
-       return Data+Parm[Field]; }
+       return Msg+Parm[Field]; }
 
    uint8_t ParmLen(uint8_t Field) const
      { if(Field>=Parms) return 0;
@@ -100,161 +175,161 @@ inline uint8_t NMEA_AppendCheckCRNL(char *NMEA, uint8_t Len) { return NMEA_Appen
        return Parm[Field+1]-Parm[Field]-1; }
 
    uint8_t isGP(void) const                     // GPS sentence ?
-     { if(Data[1]!='G') return 0;
-       return Data[2]=='P'; }
+     { if(Msg[1]!='G') return 0;
+       return Msg[2]=='P'; }
 
    uint8_t isGL(void) const                     // GLONASS sentence ?
-     { if(Data[1]!='G') return 0;
-       return Data[2]=='L'; }
+     { if(Msg[1]!='G') return 0;
+       return Msg[2]=='L'; }
 
    uint8_t isGA(void) const                     // GALILEO sentence ?
-     { if(Data[1]!='G') return 0;
-       return Data[2]=='A'; }
+     { if(Msg[1]!='G') return 0;
+       return Msg[2]=='A'; }
 
    uint8_t isGN(void) const
-     { if(Data[1]!='G') return 0;
-       return Data[2]=='N'; }
+     { if(Msg[1]!='G') return 0;
+       return Msg[2]=='N'; }
 
    uint8_t isBD(void) const                     // for Beidou GSA and GSV
-     { if(Data[1]!='B') return 0;
-       return Data[2]=='D'; }
+     { if(Msg[1]!='B') return 0;
+       return Msg[2]=='D'; }
 
    uint8_t isGx(void) const                     // GPS or GLONASS sentence ?
-     { return Data[1]=='G'; }
+     { return Msg[1]=='G'; }
 
    uint8_t isGPRMC(void) const                  // GPS recomended minimum data
      { if(!isGP()) return 0;
-       if(Data[3]!='R') return 0;
-       if(Data[4]!='M') return 0;
-       return Data[5]=='C'; }
+       if(Msg[3]!='R') return 0;
+       if(Msg[4]!='M') return 0;
+       return Msg[5]=='C'; }
 
    uint8_t isGNRMC(void) const                  // GPS recomended minimum data
      { if(!isGN()) return 0;
-       if(Data[3]!='R') return 0;
-       if(Data[4]!='M') return 0;
-       return Data[5]=='C'; }
+       if(Msg[3]!='R') return 0;
+       if(Msg[4]!='M') return 0;
+       return Msg[5]=='C'; }
 
    uint8_t isGxRMC(void) const                  // GPS recomended minimum data
      { if(!isGx()) return 0;
-       if(Data[3]!='R') return 0;
-       if(Data[4]!='M') return 0;
-       return Data[5]=='C'; }
+       if(Msg[3]!='R') return 0;
+       if(Msg[4]!='M') return 0;
+       return Msg[5]=='C'; }
 
    uint8_t isGPGGA(void) const                  // GPS 3-D fix data
      { if(!isGP()) return 0;
-       if(Data[3]!='G') return 0;
-       if(Data[4]!='G') return 0;
-       return Data[5]=='A'; }
+       if(Msg[3]!='G') return 0;
+       if(Msg[4]!='G') return 0;
+       return Msg[5]=='A'; }
 
    uint8_t isGNGGA(void) const                  // GPS 3-D fix data
      { if(!isGN()) return 0;
-       if(Data[3]!='G') return 0;
-       if(Data[4]!='G') return 0;
-       return Data[5]=='A'; }
+       if(Msg[3]!='G') return 0;
+       if(Msg[4]!='G') return 0;
+       return Msg[5]=='A'; }
 
    uint8_t isGxGGA(void) const                  // 
      { if(!isGx()) return 0;
-       if(Data[3]!='G') return 0;
-       if(Data[4]!='G') return 0;
-       return Data[5]=='A'; }
+       if(Msg[3]!='G') return 0;
+       if(Msg[4]!='G') return 0;
+       return Msg[5]=='A'; }
 
    uint8_t isGxVTG(void) const                  // velocity relative to the ground
      { if(!isGx()) return 0;
-       if(Data[3]!='V') return 0;
-       if(Data[4]!='T') return 0;
-       return Data[5]=='G'; }
+       if(Msg[3]!='V') return 0;
+       if(Msg[4]!='T') return 0;
+       return Msg[5]=='G'; }
 
    uint8_t isGxZDA(void) const                  // UTC time+date, time zone
      { if(!isGx()) return 0;
-       if(Data[3]!='Z') return 0;
-       if(Data[4]!='D') return 0;
-       return Data[5]=='A'; }
+       if(Msg[3]!='Z') return 0;
+       if(Msg[4]!='D') return 0;
+       return Msg[5]=='A'; }
 
    uint8_t isGPGSA(void) const                   // GPS satellite data
      { if(!isGP()) return 0;
-       if(Data[3]!='G') return 0;
-       if(Data[4]!='S') return 0;
-       return Data[5]=='A'; }
+       if(Msg[3]!='G') return 0;
+       if(Msg[4]!='S') return 0;
+       return Msg[5]=='A'; }
 
    uint8_t isGNGSA(void) const                   // 
      { if(!isGN()) return 0;
-       if(Data[3]!='G') return 0;
-       if(Data[4]!='S') return 0;
-       return Data[5]=='A'; }
+       if(Msg[3]!='G') return 0;
+       if(Msg[4]!='S') return 0;
+       return Msg[5]=='A'; }
 
    uint8_t isGxGSA(void) const                   // GP=GPS, GA=Galileo, GL=Glonass, GB=BaiDou, GN=any of the systems combined
      { if(!isGx()) return 0;
-       if(Data[3]!='G') return 0;
-       if(Data[4]!='S') return 0;
-       return Data[5]=='A'; }
+       if(Msg[3]!='G') return 0;
+       if(Msg[4]!='S') return 0;
+       return Msg[5]=='A'; }
 
    uint8_t isGxGSV(void) const                   // Satellite data
      { if(!isGx() && !isBD()) return 0;          // we include as well $BDGSV
-       if(Data[3]!='G') return 0;
-       if(Data[4]!='S') return 0;
-       return Data[5]=='V'; }
+       if(Msg[3]!='G') return 0;
+       if(Msg[4]!='S') return 0;
+       return Msg[5]=='V'; }
 
    uint8_t isGPGSV(void) const                   // GPS satellite data
      { if(!isGP()) return 0;
-       if(Data[3]!='G') return 0;
-       if(Data[4]!='S') return 0;
-       return Data[5]=='V'; }
+       if(Msg[3]!='G') return 0;
+       if(Msg[4]!='S') return 0;
+       return Msg[5]=='V'; }
 
    uint8_t isGLGSV(void) const                   // GLONASS satellite data
      { if(!isGL()) return 0;
-       if(Data[3]!='G') return 0;
-       if(Data[4]!='S') return 0;
-       return Data[5]=='V'; }
+       if(Msg[3]!='G') return 0;
+       if(Msg[4]!='S') return 0;
+       return Msg[5]=='V'; }
 
    uint8_t isGAGSV(void) const                   // GALILEO satellite data
      { if(!isGA()) return 0;
-       if(Data[3]!='G') return 0;
-       if(Data[4]!='S') return 0;
-       return Data[5]=='V'; }
+       if(Msg[3]!='G') return 0;
+       if(Msg[4]!='S') return 0;
+       return Msg[5]=='V'; }
 
    uint8_t isBDGSV(void) const                   // BEIDOU satellite data
      { if(!isBD()) return 0;
-       if(Data[3]!='G') return 0;
-       if(Data[4]!='S') return 0;
-       return Data[5]=='V'; }
+       if(Msg[3]!='G') return 0;
+       if(Msg[4]!='S') return 0;
+       return Msg[5]=='V'; }
 
    uint8_t isGPTXT(void) const                   // GPS test message
      { if(!isGP()) return 0;
-       if(Data[3]!='T') return 0;
-       if(Data[4]!='X') return 0;
-       return Data[5]=='T'; }
+       if(Msg[3]!='T') return 0;
+       if(Msg[4]!='X') return 0;
+       return Msg[5]=='T'; }
 
    uint8_t isP(void) const                       // Private thus specific to the euqipment
-   { return Data[1]=='P'; }
+   { return Msg[1]=='P'; }
 
    uint8_t isPOGN(void) const                    // OGN dedicated NMEA sentence
-     { if(Data[1]!='P') return 0;
-       if(Data[2]!='O') return 0;
-       if(Data[3]!='G') return 0;
-       return Data[4]=='N'; }
+     { if(Msg[1]!='P') return 0;
+       if(Msg[2]!='O') return 0;
+       if(Msg[3]!='G') return 0;
+       return Msg[4]=='N'; }
 
    uint8_t isPOGNB(void)                         // barometric report from the OGN tracker
      { if(!isPOGN()) return 0;
-       return Data[5]=='B'; }
+       return Msg[5]=='B'; }
 
    uint8_t isPOGNT(void)                         // other aircraft position (tracking) report from OGN trackers
      { if(!isPOGN()) return 0;
-       return Data[5]=='T'; }
+       return Msg[5]=='T'; }
 
    uint8_t isPOGNS(void)                         // tracker parameters setup
      { if(!isPOGN()) return 0;
-       return Data[5]=='S'; }
+       return Msg[5]=='S'; }
 
    uint8_t isPGRMZ(void)                         // barometric pressure report
      { if(!isP()) return 0;
-       if(Data[2]!='G') return 0;
-       if(Data[3]!='R') return 0;
-       if(Data[4]!='M') return 0;
-       return Data[5]=='Z'; }
+       if(Msg[2]!='G') return 0;
+       if(Msg[3]!='R') return 0;
+       if(Msg[4]!='M') return 0;
+       return Msg[5]=='Z'; }
 
    uint8_t isPOGNL(void)                         // log file list request
      { if(!isPOGN()) return 0;
-       return Data[5]=='L'; }
+       return Msg[5]=='L'; }
 
 } ;
 
@@ -16,6 +16,7 @@
 #include "bitcount.h"
 #include "nmea.h"
 #include "ubx.h"
+#include "casic.h"
 #include "mavlink.h"
 
 #include "ldpc.h"
@@ -112,6 +113,12 @@ template <class OGNx_Packet=OGN1_Packet>
    // void calcFEC(const uint32_t ParityGen[48][5]) { LDPC_Encode(&PacketHeaderWord,  FEC, ParityGen); }
    void    calcFEC(void)                   { LDPC_Encode(Packet.Word()); }       // calculate the 48-bit parity check
    uint8_t checkFEC(void)    const  { return LDPC_Check(Packet.Word()); }        // returns number of parity checks that fail (0 => no errors, all fine)
+   void    patchFEC(uint32_t PrevHeader)       { LDPC_UpdateParity(FEC, 0, PrevHeader^Packet.HeaderWord); } // update the FEC after a change in the header
+
+   void setRelay(uint8_t Relay)                                                // set the relay count and keep the FEC valid
+   { uint32_t Prev=Packet.HeaderWord; Packet.Header.Relay=Relay; patchFEC(Prev); }
+   void setEmergency(uint8_t Emergency)                                        // set the emergency flag and keep the FEC valid
+   { uint32_t Prev=Packet.HeaderWord; Packet.Header.Emergency=Emergency; patchFEC(Prev); }
 
    uint8_t  *Byte(void) const { return (uint8_t  *)&Packet.HeaderWord; } // packet as bytes
    uint32_t *Word(void) const { return (uint32_t *)&Packet.HeaderWord; } // packet as words
@@ -226,6 +233,12 @@ template <class OGNx_Packet=OGN1_Packet>
    // void calcFEC(const uint32_t ParityGen[48][5]) { LDPC_Encode(&PacketHeaderWord,  FEC, ParityGen); }
    void    calcFEC(void)                   { LDPC_Encode(Packet.Word()); }       // calculate the 48-bit parity check
    uint8_t checkFEC(void)    const  { return LDPC_Check(Packet.Word()); }        // returns number of parity checks that fail (0 => no errors, all fine)
+   void    patchFEC(uint32_t PrevHeader)       { LDPC_UpdateParity(FEC, 0, PrevHeader^Packet.HeaderWord); } // update the FEC after a change in the header
+
+   void setRelay(uint8_t Relay)                                                // set the relay count and keep the FEC valid
+   { uint32_t Prev=Packet.HeaderWord; Packet.Header.Relay=Relay; patchFEC(Prev); }
+   void setEmergency(uint8_t Emergency)                                        // set the emergency flag and keep the FEC valid
+   { uint32_t Prev=Packet.HeaderWord; Packet.Header.Emergency=Emergency; patchFEC(Prev); }
 
    int BitErr(OGN_RxPacket &RefPacket) const // return number of different data bits between this Packet and RefPacket
    { return Count1s(Packet.HeaderWord^RefPacket.Packet.HeaderWord)
@@ -573,52 +586,57 @@ class OGN_PPM_Packet                                        // OGN packet with F
 
 // ---------------------------------------------------------------------------------------------------------------------
 
-template<class OGNx_Packet, uint8_t Size=8>
+// Relay queue: the received packets and their relay-ranks.
+// Every operation scans all the slots: for the tracker's queue sizes this is the fastest and the smallest.
+// From about 64 slots up the OGN_TreePrioQueue below is faster (relay_test/prioqueue_bench).
+
+template<class OGNx_Packet, uint16_t Size=8>
  class OGN_PrioQueue
 { public:
-   // static const uint8_t Size = 8;            // number of packets kept
    OGN_RxPacket<OGNx_Packet> Packet[Size];   // OGN packets
-   uint16_t             Sum;                 // sum of all ranks
-   uint8_t              Low, LowIdx;         // the lowest rank and the index of it
+   uint32_t             Sum;                 // sum of all ranks
+   uint8_t              Low;                 // the lowest rank
+   uint16_t             LowIdx;              // and the index of it
 
   public:
    void Clear(void)                                                           // clear (reset) the queue
-   { for(uint8_t Idx=0; Idx<Size; Idx++)                                      // clear every packet
+   { for(uint16_t Idx=0; Idx<Size; Idx++)                                     // clear every packet
      { Packet[Idx].Clear(); }
      Sum=0; Low=0; LowIdx=0; }                                                // clear the rank sum, lowest rank
 
-   OGN_RxPacket<OGNx_Packet> * operator [](uint8_t Idx) { return Packet+Idx; }
+   OGN_RxPacket<OGNx_Packet> * operator [](uint16_t Idx) { return Packet+Idx; }
+
+   uint32_t getSum(void) const { return Sum; }                                // sum of all ranks
+   uint16_t getLow(void) const { return LowIdx; }                             // a free or the lowest rank slot
+   uint8_t getRank(uint16_t Idx) const { return Packet[Idx].Rank; }           // relay-rank of given slot
 
-   uint8_t getNew(void)                                                       // get (index of) a free or lowest rank packet
-   { Sum-=Packet[LowIdx].Rank; Packet[LowIdx].Rank=0; Low=0; return LowIdx; } // remove old packet from the rank sum
+   uint16_t getNew(void)                                                      // get (index of) a free or lowest rank packet
+   { uint16_t Idx=LowIdx; clean(Idx); return Idx; }                           // remove old packet from the queue
 
-   uint8_t size(void)                                                        // count all slots with Alloc flag set
-   { uint8_t Count=0;
-     for(uint8_t Idx=0; Idx<Size; Idx++)
+   uint16_t size(void) const                                                  // count all slots with Alloc flag set
+   { uint16_t Count=0;
+     for(uint16_t Idx=0; Idx<Size; Idx++)
      { if(Packet[Idx].Alloc) Count++; }
      return Count; }
 
-   OGN_RxPacket<OGNx_Packet> *addNew(uint8_t NewIdx)                          // add the new packet to the queue
+   OGN_RxPacket<OGNx_Packet> *addNew(uint16_t NewIdx)                         // add the new packet to the queue
    { OGN_RxPacket<OGNx_Packet> *Prev = 0;
-     Packet[NewIdx].Alloc=1;                                                  // mark this clot as allocated
+     Packet[NewIdx].Alloc=1;                                                  // mark this slot as allocated
      uint32_t AddressAndType = Packet[NewIdx].Packet.getAddressAndType();     // get ID of this packet: ID is address-type and address (2+24 = 26 bits)
-     for(uint8_t Idx=0; Idx<Size; Idx++)                                      // look for other packets with same ID
-     { if(Idx==NewIdx) continue;                                              // avoid the new packet
+     for(uint16_t Idx=0; Idx<Size; Idx++)                                     // look for other packets with same ID
+     { if(Idx==NewIdx || Packet[Idx].Alloc==0) continue;                      // avoid the new packet and the free slots
        if(Packet[Idx].Packet.getAddressAndType() == AddressAndType)           // if another packet with same ID:
        { Prev=Packet+Idx; clean(Idx); }                                       // then remove it: set rank to zero
      }
      uint8_t Rank=Packet[NewIdx].Rank; Sum+=Rank;                             // add the new packet to the rank sum
      if(NewIdx==LowIdx) reCalc();
      else { if(Rank<Low) { Low=Rank; LowIdx=NewIdx; } }
-     // if(NewIdx!=LowIdx)                                                       //
-     // { if(Rank<=Low) { Low=Rank; LowIdx=NewIdx; } }
-     // else reCalc();
      return Prev; }
 
-   uint8_t getRand(uint32_t Rand) const                                       // get a position by random selection but probabilities prop. to ranks
+   uint16_t getRand(uint32_t Rand) const                                      // get a position by random selection but probabilities prop. to ranks
    { if(Sum==0) return Rand%Size;                                             //
-     uint16_t RankIdx = Rand%Sum;
-     uint8_t Idx; uint16_t RankSum=0;
+     uint32_t RankIdx = Rand%Sum;
+     uint16_t Idx; uint32_t RankSum=0;
      for(Idx=0; Idx<Size; Idx++)
      { if(Packet[Idx].Alloc==0) continue;
        uint8_t Rank=Packet[Idx].Rank; if(Rank==0) continue;
@@ -627,7 +645,8 @@ template<class OGNx_Packet, uint8_t Size=8>
 
    void reCalc(void)                                                           // find the lowest rank and calc. the sum of all ranks
    { Sum=Low=Packet[0].Rank; LowIdx=0;                                         // take minimum at the first slot
-     for(uint8_t Idx=1; Idx<Size; Idx++)                                       // loop over all other slots
+     if(Packet[0].Alloc==0) { Sum=0; Low=0; }
+     for(uint16_t Idx=1; Idx<Size; Idx++)                                      // loop over all other slots
      { if(Packet[Idx].Alloc==0) { Low=0; LowIdx=Idx; continue; }
        uint8_t Rank=Packet[Idx].Rank;
        Sum+=Rank;                                                              // sum up the ranks
@@ -636,17 +655,17 @@ template<class OGNx_Packet, uint8_t Size=8>
    }
 
    void cleanTime(uint8_t Time)                                                // clean up slots of given Time
-   { for(int Idx=0; Idx<Size; Idx++)
+   { for(uint16_t Idx=0; Idx<Size; Idx++)
      { if(Packet[Idx].Alloc==0) continue;
        uint8_t PktTime=Packet[Idx].Packet.Position.Time;
        if( PktTime==Time || PktTime>=60) clean(Idx);
      }
    }
 
-   void clean(uint8_t Idx)                                                      // clean given slot, remove it from the sum
+   void clean(uint16_t Idx)                                                     // clean given slot, remove it from the sum
    { Sum-=Packet[Idx].Rank; Packet[Idx].Rank=0; Packet[Idx].Alloc=0; Low=0; LowIdx=Idx; }
 
-   void decrRank(uint8_t Idx, uint8_t Decr=1)                                   // decrement rank of given slot
+   void decrRank(uint16_t Idx, uint8_t Decr=1)                                  // decrement rank of given slot
    { uint8_t Rank=Packet[Idx].Rank; if(Rank==0) return;                         // if zero already: do nothing
      if(Decr>Rank) Decr=Rank;                                                   // if to decrement by more than the rank already: reduce the decrement
      Rank-=Decr; Sum-=Decr;                                                     // decrement the rank and the sum of ranks
@@ -655,23 +674,374 @@ template<class OGNx_Packet, uint8_t Size=8>
 
    uint8_t Print(char *Out)
    { uint8_t Len=0;
-     for(uint8_t Idx=0; Idx<Size; Idx++)                                        // loop through the slots
+     for(uint16_t Idx=0; Idx<Size; Idx++)                                       // loop through the slots
      { if(Packet[Idx].Alloc==0) continue;
-       uint8_t Rank=Packet[Idx].Rank;
-       Out[Len++]=' '; Len+=Format_Hex(Out+Len, Rank);                          // print the slot Rank
-       // if(Rank)                                                                 // if Rank is none-zero
+       Out[Len++]=' '; Len+=Format_Hex(Out+Len, Packet[Idx].Rank);              // print the slot Rank
        { Out[Len++]='/'; Len+=Format_Hex(Out+Len, Packet[Idx].Packet.getAddressAndType() );   // print address-type and address
          Out[Len++]=':';
          if(Packet[Idx].Packet.Header.Encrypted) Len+=Format_String(Out+Len, "ee");
          else Len+=Format_UnsDec(Out+Len, Packet[Idx].Packet.Position.Time, 2); // [sec] print time
        }
      }
-     Out[Len++]=' '; Len+=Format_Hex(Out+Len, Sum);                             // sum of all Ranks
+     Out[Len++]=' '; Len+=Format_Hex(Out+Len, (uint16_t)Sum);                   // sum of all Ranks
      Out[Len++]='/'; Len+=Format_Hex(Out+Len, LowIdx);                          // index of the lowest Rank or a free slot
      Out[Len++]='\n'; Out[Len]=0; return Len; }
 
 } ;
 
+// Relay queue for a large number of slots, same interface as OGN_PrioQueue.
+// The ranks are kept in a contiguous array and in a sum-tree: weighted random selection and rank updates are O(log Size).
+// The same tree keeps the slot with the lowest rank, which is to be replaced by a new packet.
+// The slots are indexed by address-type and address (open addressing, linear probing)
+// and chained by the packet time (second) thus duplicates and old packets are found without scanning all the slots.
+// Faster than the scanning queue from about 64 slots up, but takes about 3/4 more RAM.
+
+constexpr uint8_t OGN_calcBits(uint16_t Min, uint8_t Bits=0) { return (1u<<Bits)>=Min ? Bits : OGN_calcBits(Min, Bits+1); } // bits to count up to Min
+
+template<class OGNx_Packet, uint16_t Size=8>
+ class OGN_TreePrioQueue
+{ public:
+   static const uint8_t  TreeBits = OGN_calcBits(Size);
+   static const uint16_t Leaves   = 1u<<TreeBits;      // leaves of the sum-tree: slots rounded up to a power of 2
+   static const uint8_t  HashBits = OGN_calcBits(2*Size); // index not more than half full
+   static const uint16_t HashSize = 1u<<HashBits;
+   static const uint16_t None     = 0xFFFF;            // end of list, empty index entry
+   static const uint8_t  TimeLists = 61;               // 60 seconds, all unknown times on the last list
+
+   OGN_RxPacket<OGNx_Packet> Packet[Size];   // OGN packets
+   uint8_t              Rank[Size];          // relay-ranks of the slots, zero for free slots
+   uint32_t             RankSum[2*Leaves];   // sum-tree of the ranks: [1] is the total, [Leaves+Idx] is the slot Idx
+   uint32_t             Low[2*Leaves];       // min-tree: lowest rank in the branch and the slot of it, [1] for the whole queue
+   uint16_t             Index[HashSize];     // slots of allocated packets, by address-type and address
+   uint16_t             TimeHead[TimeLists]; // first slot of the packets with a given time (second)
+   uint16_t             TimeNext[Size];      // next slot with the same time
+   uint16_t             Count;               // number of allocated slots
+
+  public:
+   void Clear(void)                                                           // clear (reset) the queue
+   { for(uint16_t Idx=0; Idx<Size; Idx++)                                     // clear every packet
+     { Packet[Idx].Clear(); Rank[Idx]=0; TimeNext[Idx]=None; }
+     for(uint16_t Idx=0; Idx<HashSize; Idx++) Index[Idx]=None;
+     for(uint8_t Sec=0; Sec<TimeLists; Sec++) TimeHead[Sec]=None;
+     for(uint16_t Idx=0; Idx<Leaves; Idx++)
+     { RankSum[Leaves+Idx]=0; Low[Leaves+Idx]=lowKey(Idx, 0, 0); }
+     for(uint16_t Node=Leaves-1; Node>0; Node--) calcNode(Node);             // build the trees
+     Count=0; }
+
+   OGN_RxPacket<OGNx_Packet> * operator [](uint16_t Idx) { return Packet+Idx; }
+
+   uint32_t getSum(void) const { return RankSum[1]; }                         // sum of all ranks
+   uint16_t getLow(void) const { return Low[1]&0xFFFF; }                      // a free or the lowest rank slot
+   uint8_t getRank(uint16_t Idx) const { return Rank[Idx]; }                  // relay-rank of given slot
+
+   uint16_t getNew(void)                                                      // get (index of) a free or lowest rank packet
+   { uint16_t Idx=getLow(); clean(Idx); return Idx; }                         // remove old packet from the queue
+
+   uint16_t size(void) const { return Count; }                               // number of slots with Alloc flag set
+
+   OGN_RxPacket<OGNx_Packet> *addNew(uint16_t NewIdx)                         // add the new packet to the queue
+   { OGN_RxPacket<OGNx_Packet> *Prev = 0;
+     if(Packet[NewIdx].Alloc) clean(NewIdx);                                  // should not happen: the slot should come from getNew()
+     uint32_t AddressAndType = Packet[NewIdx].Packet.getAddressAndType();     // get ID of this packet: ID is address-type and address (2+24 = 26 bits)
+     uint16_t Pos = findAddr(AddressAndType);                                 // look for another packet with same ID
+     if(Index[Pos]!=None)
+     { uint16_t Idx=Index[Pos]; Prev=Packet+Idx; clean(Idx);                  // then remove it
+       Pos = findAddr(AddressAndType); }                                      // the index may have been shifted
+     Index[Pos]=NewIdx;
+     Packet[NewIdx].Alloc=1; Count++;                                         // mark this slot as allocated
+     uint8_t Sec=timeList(NewIdx);                                            // chain it by time
+     TimeNext[NewIdx]=TimeHead[Sec]; TimeHead[Sec]=NewIdx;
+     setRank(NewIdx, Packet[NewIdx].Rank);                                    // add the new packet to the rank sum
+     return Prev; }
+
+   uint16_t getRand(uint32_t Rand) const                                      // get a position by random selection but probabilities prop. to ranks
+   { if(getSum()==0) return Rand%Size;                                        //
+     uint32_t RankIdx = Rand%getSum();
+     uint16_t Node=1;
+     while(Node<Leaves)                                                       // descend the sum-tree
+     { Node<<=1;
+       if(RankIdx>=RankSum[Node]) { RankIdx-=RankSum[Node]; Node++; } }
+     return Node-Leaves; }
+
+   void cleanTime(uint8_t Time)                                               // clean up slots of given Time
+   { if(Time<60) cleanList(Time);
+     cleanList(TimeLists-1); }                                                // and the packets with unknown time
+
+   void clean(uint16_t Idx)                                                   // clean given slot, remove it from the sum
+   { if(Packet[Idx].Alloc) removeTime(Idx);
+     release(Idx); }
+
+   void decrRank(uint16_t Idx, uint8_t Decr=1)                                // decrement rank of given slot
+   { uint8_t Rank=this->Rank[Idx]; if(Rank==0) return;                        // if zero already: do nothing
+     if(Decr>Rank) Decr=Rank;                                                 // if to decrement by more than the rank already: reduce the decrement
+     Rank-=Decr;
+     Packet[Idx].Rank=Rank; setRank(Idx, Rank); }                             // update the rank of this slot and the trees
+
+   uint8_t Print(char *Out)
+   { uint8_t Len=0;
+     for(uint16_t Idx=0; Idx<Size; Idx++)                                       // loop through the slots
+     { if(Packet[Idx].Alloc==0) continue;
+       Out[Len++]=' '; Len+=Format_Hex(Out+Len, Rank[Idx]);                     // print the slot Rank
+       { Out[Len++]='/'; Len+=Format_Hex(Out+Len, Packet[Idx].Packet.getAddressAndType() );   // print address-type and address
+         Out[Len++]=':';
+         if(Packet[Idx].Packet.Header.Encrypted) Len+=Format_String(Out+Len, "ee");
+         else Len+=Format_UnsDec(Out+Len, Packet[Idx].Packet.Position.Time, 2); // [sec] print time
+       }
+     }
+     Out[Len++]=' '; Len+=Format_Hex(Out+Len, (uint16_t)getSum());            // sum of all Ranks
+     Out[Len++]='/'; Len+=Format_Hex(Out+Len, getLow());                      // index of the lowest Rank or a free slot
+     Out[Len++]='\n'; Out[Len]=0; return Len; }
+
+  private:
+   static uint32_t lowKey(uint16_t Idx, uint8_t Rank, bool Alloc)             // lower is replaced first: free slots before allocated ones of the same rank
+   { if(Idx>=Size) return 0xFFFFFFFF;                                         // padding leaves are never taken
+     return ((uint32_t)Rank<<17) | ((uint32_t)Alloc<<16) | Idx; }
+
+   void calcNode(uint16_t Node)                                               // recalc. a node of the trees from its two branches
+   { uint16_t Left=Node<<1, Right=Left+1;
+     RankSum[Node] = RankSum[Left]+RankSum[Right];
+     Low[Node] = Low[Right]<Low[Left] ? Low[Right]:Low[Left]; }
+
+   void setRank(uint16_t Idx, uint8_t NewRank)                                // set the rank of a slot and update the trees up to the root
+   { Rank[Idx]=NewRank;
+     uint16_t Node=Leaves+Idx; RankSum[Node]=NewRank; Low[Node]=lowKey(Idx, NewRank, Packet[Idx].Alloc);
+     for(Node>>=1; Node; Node>>=1) calcNode(Node); }
+
+   static uint16_t hashAddr(uint32_t AddressAndType)
+   { return (AddressAndType*0x9E3779B1)>>(32-HashBits); }
+
+   uint16_t findAddr(uint32_t AddressAndType) const                           // index position of the address or of the empty entry where it would go
+   { uint16_t Pos=hashAddr(AddressAndType);
+     for( ; ; )
+     { uint16_t Idx=Index[Pos]; if(Idx==None) return Pos;
+       if(Packet[Idx].Packet.getAddressAndType()==AddressAndType) return Pos;
+       Pos = (Pos+1)&(HashSize-1); }
+   }
+
+   void removeAddr(uint16_t Idx)                                              // remove a slot from the address index
+   { uint16_t Pos=findAddr(Packet[Idx].Packet.getAddressAndType());
+     if(Index[Pos]!=Idx)                                                      // should not happen: the packet has been changed
+     { for(Pos=0; Pos<HashSize; Pos++) if(Index[Pos]==Idx) break;
+       if(Pos>=HashSize) return; }
+     for( ; ; )                                                               // shift back the following entries: no tombstones
+     { Index[Pos]=None;
+       uint16_t Next=Pos;
+       for( ; ; )
+       { Next = (Next+1)&(HashSize-1);
+         uint16_t NextIdx=Index[Next]; if(NextIdx==None) return;
+         uint16_t Home=hashAddr(Packet[NextIdx].Packet.getAddressAndType());
+         if(((Next-Home)&(HashSize-1)) >= ((Next-Pos)&(HashSize-1))) break; } // can move back to the hole
+       Index[Pos]=Index[Next]; Pos=Next; }
+   }
+
+   uint8_t timeList(uint16_t Idx) const
+   { uint8_t Sec=Packet[Idx].Packet.Position.Time;
+     return Sec<60 ? Sec:TimeLists-1; }
+
+   void removeTime(uint16_t Idx)                                              // remove a slot from its time list
+   { uint16_t *Link=TimeHead+timeList(Idx);
+     for(uint16_t Links=0; *Link!=None && Links<Size; Links++)
+     { if(*Link==Idx) { *Link=TimeNext[Idx]; break; }
+       Link=TimeNext+*Link; }
+     TimeNext[Idx]=None; }
+
+   void release(uint16_t Idx)                                                 // free a slot already taken off its time list
+   { if(Packet[Idx].Alloc)
+     { removeAddr(Idx);
+       Packet[Idx].Alloc=0; Count--; }
+     Packet[Idx].Rank=0; setRank(Idx, 0); }
+
+   void cleanList(uint8_t Sec)                                                // clean all slots on the given time list
+   { for( ; ; )
+     { uint16_t Idx=TimeHead[Sec]; if(Idx==None) break;
+       TimeHead[Sec]=TimeNext[Idx]; TimeNext[Idx]=None;
+       release(Idx); }
+   }
+
+} ;
+
+// Traffic table: what is known about every aircraft heard recently, one entry per address-type and address.
+// The entries are found through an open-addressing index thus lookup is O(1).
+// Distance and bearing from own position are computed only when asked for
+// and then kept until a new position of the aircraft or a new own position.
+
+class OGN_Traffic                            // one aircraft
+{ public:
+   uint32_t AddressAndType;                  // address-type and address (2+24 = 26 bits)
+   uint32_t Time;                            // [sec] when the last position was received
+   uint32_t FirstTime;                       // [sec] when first heard
+    int32_t Latitude;                        // [1/600000deg] last decoded position
+    int32_t Longitude;                       // [1/600000deg]
+    int32_t Altitude;                        // [m]
+   uint16_t Speed;                           // [0.1m/s]
+   uint16_t Heading;                         // [0.1deg]
+    int16_t ClimbRate;                       // [0.1m/s]
+    int16_t TurnRate;                        // [0.1deg/s]
+   uint8_t  AcftType;                        // glider, tow-plane, etc.
+   uint8_t  PosTime;                        // [sec] time-of-minute of the position
+   uint8_t  RxRSSI;                          // [-0.5dBm] of the last packet
+   uint8_t  RxErr;                           // bit errors corrected in the last packet
+   uint16_t Packets;                         // packets received
+   uint16_t Relayed;                         // out of them through a relay
+   uint16_t RefEpoch;                        // own position the geometry below is computed for, 0 = not computed
+    int16_t LatDist;                         // [m] relative position: north
+    int16_t LonDist;                         // [m] relative position: east
+    int16_t AltDist;                         // [m] relative altitude: up
+   uint16_t Distance;                        // [m] horizontal distance
+   uint16_t Bearing;                         // [16-bit cyclic] direction to the aircraft
+   uint8_t  Warn;                            // collision warning level from the LookOut: 0 = none .. 3 = urgent
+   union
+   { uint8_t Flags;
+     struct
+     { bool Used   :1;                       // entry in use
+       bool InRange:1;                       // relative geometry is valid: not too far
+     } ;
+   } ;
+
+  public:
+   void Clear(void) { Flags=0; RefEpoch=0; Warn=0; }
+
+   template <class OGNx_Packet>
+    void setPosition(const OGNx_Packet &Packet)              // take the position from a decoded (dewhitened) packet
+   { Latitude  = Packet.DecodeLatitude();
+     Longitude = Packet.DecodeLongitude();
+     Altitude  = Packet.DecodeAltitude();
+     Speed     = Packet.DecodeSpeed();
+     Heading   = Packet.DecodeHeading();
+     ClimbRate = Packet.DecodeClimbRate();
+     TurnRate  = Packet.DecodeTurnRate();
+     AcftType  = Packet.Position.AcftType;
+     PosTime   = Packet.Position.Time;
+     RefEpoch  = 0; }                                         // relative geometry to be computed again
+
+   bool calcRelative(int32_t RefLat, int32_t RefLon, int32_t RefAlt, uint16_t LatCos, int32_t MaxDist=0x7FFF) // like calcDistanceVector()
+   { InRange=0;
+     int32_t Dist = ((Latitude-RefLat)*1517+0x1000)>>13;     // convert from 1/600000deg to meters
+     if(abs(Dist)>MaxDist) return 0;
+     LatDist=Dist;
+     Dist = ((Longitude-RefLon)*1517+0x1000)>>13;
+     if(abs(Dist)>(4*MaxDist)) return 0;
+     Dist = (Dist*LatCos+0x800)>>12;
+     if(abs(Dist)>MaxDist) return 0;
+     LonDist=Dist;
+     Dist = Altitude-RefAlt; if(Dist>0x7FFF) Dist=0x7FFF; else if(Dist<(-0x7FFF)) Dist=(-0x7FFF);
+     AltDist=Dist;
+     Distance = IntDistance(LatDist, LonDist);                // [m]
+     Bearing  = IntAtan2(LonDist, LatDist);                   // [16-bit cyclic]
+     InRange=1; return 1; }
+
+} ;
+
+template <uint16_t Size=32>
+ class OGN_TrafficTable
+{ public:
+   static const uint8_t  HashBits = OGN_calcBits(2*Size); // index not more than half full
+   static const uint16_t HashSize = 1u<<HashBits;
+   static const uint16_t None     = 0xFFFF;            // empty index entry
+   static const uint8_t  MaxAge   = 60;                // [sec] forget aircraft not heard for that long
+
+   OGN_Traffic Acft[Size];                   // the aircraft
+   uint16_t    Index[HashSize];              // entries in use, by address-type and address
+   uint16_t    Free[Size];                   // stack of the free entries
+   uint16_t    Count;                        // number of entries in use
+    int32_t    RefLat, RefLon, RefAlt;       // [1/600000deg, 1/600000deg, m] own position
+   uint16_t    RefLatCos;                    // [1.0/4096] cosine of own latitude
+   uint16_t    RefEpoch;                     // incremented with every new own position, 0 = no own position yet
+
+  public:
+   OGN_TrafficTable() { Clear(); RefEpoch=0; }
+
+   void Clear(void)
+   { for(uint16_t Idx=0; Idx<Size; Idx++) { Acft[Idx].Clear(); Free[Idx]=Size-1-Idx; }
+     for(uint16_t Pos=0; Pos<HashSize; Pos++) Index[Pos]=None;
+     Count=0; }
+
+   OGN_Traffic * operator [](uint16_t Idx) { return Acft+Idx; }
+
+   uint16_t size(void) const { return Count; }
+
+   void setRef(int32_t Lat, int32_t Lon, int32_t Alt, uint16_t LatCos) // set own position: relative geometry of all aircraft becomes out-of-date
+   { RefLat=Lat; RefLon=Lon; RefAlt=Alt; RefLatCos=LatCos;
+     RefEpoch++; if(RefEpoch==0) RefEpoch=1; }
+
+   bool calcRelative(OGN_Traffic &Traffic)                  // distance and bearing to an aircraft: only computed when out-of-date
+   { if(RefEpoch==0) return 0;
+     if(Traffic.RefEpoch!=RefEpoch)
+     { Traffic.calcRelative(RefLat, RefLon, RefAlt, RefLatCos);
+       Traffic.RefEpoch=RefEpoch; }
+     return Traffic.InRange; }
+
+   OGN_Traffic *Find(uint32_t AddressAndType)               // find an aircraft, null when not known
+   { uint16_t Idx=Index[findAddr(AddressAndType)];
+     return Idx==None ? 0:Acft+Idx; }
+
+   template <class OGNx_Packet>
+    OGN_Traffic *Update(const OGNx_Packet &Packet, uint32_t Time, uint8_t RxRSSI, uint8_t RxErr) // new position of an aircraft
+   { uint32_t AddressAndType = Packet.getAddressAndType();
+     uint16_t Pos=findAddr(AddressAndType);
+     uint16_t Idx=Index[Pos];
+     if(Idx==None)                                           // new aircraft
+     { Idx=getFree();
+       Pos=findAddr(AddressAndType);                         // the index may have changed by removing an old entry
+       Index[Pos]=Idx;
+       OGN_Traffic &New=Acft[Idx]; New.Clear(); New.Used=1;
+       New.AddressAndType=AddressAndType; New.FirstTime=Time;
+       New.Packets=0; New.Relayed=0; }
+     OGN_Traffic &Traffic=Acft[Idx];
+     Traffic.setPosition(Packet);
+     Traffic.Time=Time; Traffic.RxRSSI=RxRSSI; Traffic.RxErr=RxErr;
+     Traffic.Packets++; if(Packet.Header.Relay) Traffic.Relayed++;
+     return &Traffic; }
+
+   void cleanTime(uint32_t Now)                              // remove aircraft not heard for MaxAge
+   { for(uint16_t Idx=0; Idx<Size; Idx++)
+     { if(Acft[Idx].Used && (Now-Acft[Idx].Time)>MaxAge) Remove(Idx); }
+   }
+
+   void Remove(uint16_t Idx)                                 // remove an entry
+   { if(!Acft[Idx].Used) return;
+     uint16_t Pos=findAddr(Acft[Idx].AddressAndType);
+     Acft[Idx].Used=0; Count--; Free[Size-1-Count]=Idx;
+     if(Index[Pos]!=Idx) return;                             // should not happen
+     for( ; ; )                                              // shift back the following entries: no tombstones
+     { Index[Pos]=None;
+       uint16_t Next=Pos;
+       for( ; ; )
+       { Next = (Next+1)&(HashSize-1);
+         uint16_t NextIdx=Index[Next]; if(NextIdx==None) return;
+         uint16_t Home=hashAddr(Acft[NextIdx].AddressAndType);
+         if(((Next-Home)&(HashSize-1)) >= ((Next-Pos)&(HashSize-1))) break; } // can move back to the hole
+       Index[Pos]=Index[Next]; Pos=Next; }
+   }
+
+   uint8_t Print(char *Out) const                            // print: aircraft in the table
+   { uint8_t Len=0;
+     Len+=Format_UnsDec(Out+Len, Count);
+     Out[Len++]='/'; Len+=Format_UnsDec(Out+Len, Size);
+     Out[Len]=0; return Len; }
+
+  private:
+   static uint16_t hashAddr(uint32_t AddressAndType)
+   { return (AddressAndType*0x9E3779B1)>>(32-HashBits); }
+
+   uint16_t findAddr(uint32_t AddressAndType) const          // index position of the address or of the empty entry where it would go
+   { uint16_t Pos=hashAddr(AddressAndType);
+     for( ; ; )
+     { uint16_t Idx=Index[Pos]; if(Idx==None) return Pos;
+       if(Acft[Idx].AddressAndType==AddressAndType) return Pos;
+       Pos = (Pos+1)&(HashSize-1); }
+   }
+
+   uint16_t getFree(void)                                    // take a free entry or the aircraft not heard for the longest time
+   { if(Count>=Size)                                         // table full: only then a scan is needed
+     { uint16_t Oldest=0;
+       for(uint16_t Idx=1; Idx<Size; Idx++)
+         if((int32_t)(Acft[Idx].Time-Acft[Oldest].Time)<0) Oldest=Idx;
+       Remove(Oldest); }
+     return Free[Size-1-Count++]; }
+
+} ;
+
 class GPS_Time
 { public:
    int8_t  Year, Month, Day;    // Date (UTC) from GPS
@@ -1107,15 +1477,50 @@ class GPS_Position: public GPS_Time
      Satellites = SOL->numSV;
      return 1; }
 
+   int8_t ReadCASIC(CASIC_RxMsg &RxMsg)
+   { if(!RxMsg.isNAV()) return 0;
+     if(RxMsg.isNAV_PV()     ) return ReadCASIC_NAV_PV(RxMsg);
+     if(RxMsg.isNAV_TIMEUTC()) return ReadCASIC_NAV_TIMEUTC(RxMsg);
+     return 0; }
+
+   int8_t ReadCASIC_NAV_PV(CASIC_RxMsg &RxMsg)
+   { CASIC_NAV_PV *PV = (CASIC_NAV_PV *)(RxMsg.Byte);
+     FixMode    = PV->posValid>=7 ? 3 : PV->posValid==6 ? 2:1;        // 7:3-D, 8:GNSS+DR, 6:2-D, other: no fix
+     FixQuality = FixMode>=2;
+     Satellites = PV->numSV;
+     PDOP = DOP_Round(PV->pDop); HDOP = PDOP; VDOP = PDOP+PDOP/2;      // NAV-PV has only the PDOP
+     Latitude        = Round(PV->lat*600000.0);                        // [1/600000 deg]
+     Longitude       = Round(PV->lon*600000.0);
+     Altitude        = Round((PV->height-PV->sepGeoid)*10.0f);         // [0.1m] above the geoid
+     GeoidSeparation = Round(PV->sepGeoid*10.0f);
+     Speed           = Round(PV->speed2D*10.0f);                       // [0.1m/s]
+     int32_t Track   = Round(PV->heading*10.0f); if(Track<0) Track+=3600; if(Track>=3600) Track-=3600;
+     Heading         = Track;                                          // [0.1deg]
+     calcLatitudeCosine();
+     hasGPS = 1;
+     return 1; }
+
+   int8_t ReadCASIC_NAV_TIMEUTC(CASIC_RxMsg &RxMsg)
+   { CASIC_NAV_TIMEUTC *TIMEUTC = (CASIC_NAV_TIMEUTC *)(RxMsg.Byte);
+     if(!TIMEUTC->valid) { hasTime=0; return 0; }
+     Year  = TIMEUTC->year-2000;
+     Month = TIMEUTC->month;
+     Day   = TIMEUTC->day;
+     Hour  = TIMEUTC->hour;
+     Min   = TIMEUTC->min;
+     Sec   = TIMEUTC->sec;
+     mSec  = TIMEUTC->ms;                                              // [ms]
+     if(mSec>=1000) { incrTimeDate(); mSec-=1000; }
+     hasTime = 1;
+     return 1; }
+
    int8_t ReadNMEA(NMEA_RxMsg &RxMsg)
-   { // if(RxMsg.isGPGGA()) return ReadGGA(RxMsg);
-     if(RxMsg.isGxGGA()) return ReadGGA(RxMsg);
-     // if(RxMsg.isGPRMC()) return ReadRMC(RxMsg);
-     if(RxMsg.isGxRMC()) return ReadRMC(RxMsg);
-     // if(RxMsg.isGPGSA()) return ReadGSA(RxMsg);
-     if(RxMsg.isGxGSA()) return ReadGSA(RxMsg);
-     if(RxMsg.isPGRMZ()) return ReadPGRMZ(RxMsg); // (pressure) altitude
-     // if(RxMsg.isGxGSV()) return ReadGSV(RxMsg);
+   { switch(RxMsg.getType())                              // the fields are indexed only for the sentences we read
+     { case NMEA_Type('G','G','A'): if(RxMsg.isGx()) return ReadGGA(RxMsg); break;
+       case NMEA_Type('R','M','C'): if(RxMsg.isGx()) return ReadRMC(RxMsg); break;
+       case NMEA_Type('G','S','A'): if(RxMsg.isGx()) return ReadGSA(RxMsg); break;
+       case NMEA_Type('R','M','Z'): if(RxMsg.getTalker()==NMEA_Talker('P','G')) return ReadPGRMZ(RxMsg); break; // (pressure) altitude
+     }
      return 0; }
 
    int8_t ReadNMEA(const char *NMEA)
@@ -1127,7 +1532,7 @@ class GPS_Position: public GPS_Time
      return 0; }
 
    int8_t ReadPGRMZ(NMEA_RxMsg &RxMsg)
-   { if(RxMsg.Parms<3) return -2;
+   { if(RxMsg.Index()<3) return -2;
      int8_t Ret=Read_Float1(StdAltitude, (const char *)(RxMsg.ParmPtr(0)));
      if(Ret<=0) return -1;
      char Unit=RxMsg.ParmPtr(1)[0];
@@ -1138,7 +1543,7 @@ class GPS_Position: public GPS_Time
      return 1; }
 
    int8_t ReadGGA(NMEA_RxMsg &RxMsg)
-   { if(RxMsg.Parms<14) return -2;                                                        // no less than 14 paramaters
+   { if(RxMsg.Index()<14) return -2;                                                      // no less than 14 paramaters
      hasGPS = ReadTime((const char *)RxMsg.ParmPtr(0))>0;                                 // read time and check if same as the RMC says
      FixQuality =Read_Dec1(*RxMsg.ParmPtr(5)); if(FixQuality<0) FixQuality=0;             // fix quality: 0=invalid, 1=GPS, 2=DGPS
      Satellites=Read_Dec2((const char *)RxMsg.ParmPtr(6));                                // number of satellites
@@ -1203,7 +1608,7 @@ class GPS_Position: public GPS_Time
      return 1; }
 
    int8_t ReadGSA(NMEA_RxMsg &RxMsg)
-   { if(RxMsg.Parms<17) return -1;
+   { if(RxMsg.Index()<17) return -1;
      FixMode =Read_Dec1(*RxMsg.ParmPtr(1)); if(FixMode<0) FixMode=0;                      // fix mode
      ReadPDOP((const char *)RxMsg.ParmPtr(14));                                           // total dilution of precision
      ReadHDOP((const char *)RxMsg.ParmPtr(15));                                           // horizontal dilution of precision
@@ -1230,7 +1635,7 @@ class GPS_Position: public GPS_Time
      return 1; }
 */
    int ReadRMC(NMEA_RxMsg &RxMsg)
-   { if(RxMsg.Parms<11) return -2;                                                        // no less than 12 parameters
+   { if(RxMsg.Index()<11) return -2;                                                      // no less than 12 parameters
      hasGPS = ReadTime((const char *)RxMsg.ParmPtr(0))>0;                                 // read time and check if same as the GGA says
      if(ReadDate((const char *)RxMsg.ParmPtr(8))<0) setDefaultDate();                     // date
      ReadLatitude(*RxMsg.ParmPtr(3), (const char *)RxMsg.ParmPtr(2));                     // Latitude
@@ -1258,46 +1663,33 @@ class GPS_Position: public GPS_Time
      else if(TimeDiff>=180000) TimeDiff-=360000;
      return TimeDiff; }                                                                     // [0.01s]
 */
+   static const uint8_t RecipBits = 12;           // fractional bits of the reciprocal of the time difference
+
+   static uint32_t calcRecip(int16_t TimeDiff)     // [ms] => [1000/TimeDiff/4096]: to turn differences into rates per second
+   { return (((uint32_t)1000<<RecipBits)+TimeDiff/2)/TimeDiff; }
+
+   static int16_t calcRate(int32_t Diff, uint32_t Recip) // difference over the time of Recip => rate per second
+   { int32_t Rate = ((int64_t)Diff*Recip+(1<<(RecipBits-1)))>>RecipBits;
+     if(Rate>0x7FFF) Rate=0x7FFF; else if(Rate<(-0x7FFF)) Rate=(-0x7FFF);
+     return Rate; }
+
    int16_t calcDifferentials(GPS_Position &RefPos, bool useBaro=1) // calculate climb rate and turn rate with an earlier reference position
-   { // ClimbRate=0; hasClimb=0;
-     // TurnRate=0;  hasTurn=0;
-     // LongAccel=0; hasAccel=0;
-     if(RefPos.FixQuality==0) return 0;            // give up if no fix on the reference position
+   { if(RefPos.FixQuality==0) return 0;            // give up if no fix on the reference position
      int16_t TimeDiff = calcTimeDiff(RefPos);      // [ms] time difference between positions
      if(TimeDiff<10) return 0;                     // [ms] give up if smaller than 10ms (as well when negative)
-     TurnRate = Heading-RefPos.Heading;            // [0.1deg/s] turn rate
-     if(TurnRate>1800) TurnRate-=3600; else if(TurnRate<(-1800)) TurnRate+=3600; // wrap-around
-     ClimbRate = Altitude-RefPos.Altitude;         // [0.1m/s] climb rate as altitude difference
+     return calcDifferentials(RefPos, TimeDiff, calcRecip(TimeDiff), useBaro); }
+
+   int16_t calcDifferentials(GPS_Position &RefPos, int16_t TimeDiff, uint32_t Recip, bool useBaro=1) // same, with the reciprocal of TimeDiff given: no division
+   { int32_t Turn = Heading-RefPos.Heading;        // [0.1deg] heading change
+     if(Turn>1800) Turn-=3600; else if(Turn<(-1800)) Turn+=3600; // wrap-around
+     int32_t Climb = Altitude-RefPos.Altitude;     // [0.1m] altitude change
      if(useBaro && hasBaro && RefPos.hasBaro && (abs(Altitude-StdAltitude)<2500) ) // if there is baro data then
-     { ClimbRate += StdAltitude-RefPos.StdAltitude; // [0.1m/s] on pressure altitude
-       ClimbRate = (ClimbRate+1)>>1; }             // take average of the GPS and baro climb rate
-     LongAccel = Speed-RefPos.Speed;               // longitual acceleration
-     if(TimeDiff==100)                             // [ms] if 0.1sec difference
-     { ClimbRate *=10;
-       TurnRate  *=10;
-       LongAccel *=10; }
-     if(TimeDiff==200)                             // [ms] if 0.2sec difference
-     { ClimbRate *=5;
-       TurnRate  *=5;
-       LongAccel *=5; }
-     if(TimeDiff==250)                             // [ms] if 0.25sec difference
-     { ClimbRate *=4;
-       TurnRate  *=4;
-       LongAccel *=4; }
-     else if(TimeDiff==500)
-     { ClimbRate *=2;
-       TurnRate  *=2;
-       LongAccel *=2; }
-     else if(TimeDiff==1000)
-     { }
-     else if(TimeDiff==2000)
-     { ClimbRate = (ClimbRate+1)>>1;
-       TurnRate  = ( TurnRate+1)>>1;
-       LongAccel = (LongAccel+1)>>1; }
-     else if(TimeDiff!=0)
-     { ClimbRate = ((int32_t)ClimbRate*1000)/TimeDiff;
-       TurnRate  = ((int32_t) TurnRate*1000)/TimeDiff;
-       LongAccel = ((int32_t)LongAccel*1000)/TimeDiff; }
+     { Climb += StdAltitude-RefPos.StdAltitude;    // [0.1m] on pressure altitude
+       Climb = (Climb+1)>>1; }                     // take average of the GPS and baro climb
+     int32_t Accel = Speed-RefPos.Speed;           // [0.1m/s] speed change
+     ClimbRate = calcRate(Climb, Recip);           // [0.1m/s]
+     TurnRate  = calcRate(Turn , Recip);           // [0.1deg/s]
+     LongAccel = calcRate(Accel, Recip);           // [0.1m/s^2]
      // printf("calcDifferences( , %d) %02d.%03ds hasBaro:%d:%d %4dms %3.1f/%3.1f m %+4.1f m/s\n",
      //         useBaro, Sec, mSec, hasBaro, RefPos.hasBaro, TimeDiff, 0.1*Altitude, 0.1*StdAltitude, 0.1*ClimbRate);
      hasClimb=1; hasTurn=1; hasAccel=1;
@@ -1680,6 +2072,10 @@ class GPS_Position: public GPS_Time
 
   private:
 
+   static int32_t Round(double Value) { return Value>=0 ? (int32_t)(Value+0.5) : -(int32_t)(0.5-Value); }  // binary GPS data
+   static int32_t Round(float Value)  { return Value>=0 ? (int32_t)(Value+0.5f) : -(int32_t)(0.5f-Value); }
+   static uint8_t DOP_Round(float DOP) { int32_t Val=Round(DOP*10.0f); return Val<0 ? 0 : Val>255 ? 255:Val; } // [0.1]
+
    int8_t ReadLatitude(char Sign, const char *Value)
    { int8_t Deg=Read_Dec2(Value); if(Deg<0) return -1;
      int8_t Min=Read_Dec2(Value+2); if(Min<0) return -1;
@@ -1768,5 +2164,49 @@ class GPS_Position: public GPS_Time
 
 } ;
 
+// ring of the most recent GPS positions: the GPS fills the new one, the rates are taken over a window of fixes.
+// Works for any fix rate: with 1Hz and a window of one fix it is the old pair of positions.
+template <uint8_t SizeBits=4>
+ class GPS_PosRing
+{ public:
+   static const uint8_t Size = 1<<SizeBits;         // number of positions kept
+   static const uint8_t Mask = Size-1;
+
+   GPS_Position Pos[Size];
+   uint16_t Seq;                                    // sequence number of the position being filled by the GPS
+   uint8_t  Window;                                 // [fixes] climb and turn rates over that many fixes
+   int16_t  WindowTime;                             // [ms] time over the window, for which Recip is valid
+   uint32_t Recip;                                  // reciprocal of WindowTime: calculated only when it changes
+
+  public:
+   GPS_PosRing() { Clear(); }
+
+   void Clear(void)
+   { for(uint8_t Idx=0; Idx<Size; Idx++) { Pos[Idx].Clear(); Pos[Idx].Seq=0; }
+     Seq=0; Window=1; WindowTime=0; Recip=0; }
+
+   void setWindow(uint8_t Fixes)                    // [fixes] window for the climb and turn rates
+   { if(Fixes<1) Fixes=1; else if(Fixes>Mask) Fixes=Mask;
+     Window=Fixes; }
+
+   GPS_Position &getNew(void) { return Pos[Seq&Mask]; }                         // being filled by the GPS
+   GPS_Position &getLast(uint8_t Back=0) { return Pos[(Seq-1-Back)&Mask]; }     // most recent complete one or earlier
+
+   int16_t Next(bool useBaro=1)                     // the new position is complete: calc. the rates and step to the next
+   { GPS_Position &New = getNew(); New.Seq=Seq;
+     GPS_Position &Ref = Pos[(Seq-Window)&Mask];    // the position a window before
+     int16_t TimeDiff=0;
+     if(New.isValid() && Ref.isValid() && (uint16_t)(Seq-Ref.Seq)==Window)
+     { TimeDiff = New.calcTimeDiff(Ref);            // [ms] should be the window, unless fixes were missed
+       if(TimeDiff>=10)
+       { if(TimeDiff!=WindowTime) { WindowTime=TimeDiff; Recip=GPS_Position::calcRecip(TimeDiff); } // only when the rate changes
+         New.calcDifferentials(Ref, TimeDiff, Recip, useBaro); }
+       else TimeDiff=0; }
+     Seq++;
+     getNew() = New;                                // the next one starts as a copy: the GPS may not update all fields every fix
+     return TimeDiff; }                             // [ms] time over which the rates were taken, 0 = not taken
+
+} ;
+
 #endif // of __OGN_H__
 
@@ -0,0 +1,105 @@
+#ifndef __PPS_H__
+#define __PPS_H__
+
+#include <stdint.h>
+
+#include "format.h"
+
+// Estimate of the GPS second boundary from the times the GPS bursts are seen to start, when there is no PPS line.
+// The burst starts a fixed time after the PPS, but the loop sees it late: by up to the time the loop was busy elsewhere.
+// The measurements thus scatter only towards later times: the loop below follows the early edge of the scatter
+// (large gain on early measurements, small on late ones), late outliers are not taken at all.
+// The period is estimated as well: the CPU clock is not the GPS clock, thus the prediction drifts otherwise.
+// The period follows the phase corrections (not the errors, which are biased by the latency) and only after the lock.
+
+class PPS_Estimator
+{ public:
+   static const uint8_t  FracBits = 8;                 // fractional bits of the period
+   static const int32_t  Gate     = 4000;              // [us] measurements later than that are outliers
+   static const uint8_t  MaxMiss  = 8;                 // outliers in a row to start again
+   static const uint8_t  MaxSecs  = 8;                 // [sec] longer gaps: start again
+   static const uint8_t  LockMin  = 8;                 // updates to consider the estimate good
+   static const uint32_t MaxDrift = 500<<FracBits;     // [1/256 us] the CPU clock is surely within 500ppm
+   static const int32_t  MaxStep  = 200;               // [us] largest correction per second taken for the period
+   static const uint8_t  HistBins = 8;                 // error histogram: <-2, -2..-1, -1..0, 0..1, 1..2, 2..4, 4..8, >8 [ms]
+
+   uint32_t Time;                                      // [us] estimated start of the most recent burst
+   uint32_t Period;                                    // [1/256 us] estimated length of the second
+    int32_t Error;                                     // [us] last measurement minus the prediction
+   uint8_t  Lock;                                      // updates since the start, up to 255
+   uint8_t  Miss;                                      // outliers in a row
+    int32_t MissMin;                                   // [us] smallest error of the outliers in a row
+   uint32_t Outliers;                                  // outliers in total
+   uint16_t Hist[HistBins];                            // counts of the error
+
+  public:
+   PPS_Estimator() { Clear(); }
+
+   void Clear(void)
+   { Time=0; Period=(uint32_t)1000000<<FracBits; Error=0; Lock=0; Miss=0; MissMin=0; Outliers=0; clrHist(); }
+
+   void clrHist(void) { for(uint8_t Bin=0; Bin<HistBins; Bin++) Hist[Bin]=0; }
+
+   bool isLocked(void) const { return Lock>=LockMin; }
+
+   uint32_t getTime(void) const { return Time; }       // [us] estimated start of the most recent burst
+
+   uint32_t getPeriod(void) const { return (Period+(1<<(FracBits-1)))>>FracBits; } // [us]
+
+   int8_t Process(uint32_t Meas)                       // [us] burst start as seen: return 1 when taken, 0 for outliers, -1 when starting again
+   { if(Lock==0) { Start(Meas); return -1; }
+     uint32_t Per = getPeriod();
+     uint32_t Secs = (Meas-Time+Per/2)/Per;            // [sec] since the last update
+     if(Secs==0) return 0;                             // same second: a burst split by a pause
+     if(Secs>MaxSecs) { Start(Meas); return -1; }
+     uint32_t Pred = Time + (uint32_t)(((uint64_t)Secs*Period+(1<<(FracBits-1)))>>FracBits);
+     Error = Meas-Pred; addHist(Error);
+     if(Error>Gate && Lock>=2)                         // late outlier: the prediction goes on
+     { Outliers++; Time=Pred;
+       if(Miss==0 || Error<MissMin) MissMin=Error;     // the earliest of the missed: should the burst have really moved
+       if(++Miss>=MaxMiss) { Start(Pred+MissMin); return -1; }
+       return 0; }
+     Miss=0;
+     int32_t Corr;                                     // phase correction: early measurements are the better ones
+     if(Error<0)             Corr = Lock<LockMin ? Error : Error/2;  // while locking: the earliest so far is the best
+     else if(Lock<LockMin)   Corr = Error/8;
+     else                    Corr = Error/32;          // late: most likely the loop latency
+     Time = Pred+Corr;
+     if(Lock>=LockMin)                                 // period follows the phase corrections: no bias from the latency
+     { int32_t Step = Corr/(int32_t)Secs;              // [us] large corrections are rather phase errors
+       if(Step>MaxStep) Step=MaxStep; else if(Step<(-MaxStep)) Step=(-MaxStep);
+       Period += (Step*(1<<FracBits))/(Lock<64 ? 8:64);  // the gain goes down as the estimate settles
+       const uint32_t Nom = (uint32_t)1000000<<FracBits;
+            if(Period>Nom+MaxDrift) Period=Nom+MaxDrift;
+       else if(Period<Nom-MaxDrift) Period=Nom-MaxDrift; }
+     if(Lock<255) Lock++;
+     return 1; }
+
+   uint8_t Print(char *Out) const                      // print: period, last error, outliers, histogram
+   { uint8_t Len=0;
+     Len+=Format_UnsDec(Out+Len, getPeriod()); Len+=Format_String(Out+Len, "us ");
+     Len+=Format_SignDec(Out+Len, Error); Len+=Format_String(Out+Len, "us ");
+     Len+=Format_UnsDec(Out+Len, (uint16_t)Lock); Out[Len++]='/';
+     Len+=Format_UnsDec(Out+Len, Outliers); Len+=Format_String(Out+Len, " [-2-1 0 1 2 4 8ms]");
+     for(uint8_t Bin=0; Bin<HistBins; Bin++)
+     { Out[Len++]=' '; Len+=Format_UnsDec(Out+Len, Hist[Bin]); }
+     Out[Len]=0; return Len; }
+
+  private:
+   void Start(uint32_t Meas) { Time=Meas; Lock=1; Miss=0; }
+
+   void addHist(int32_t Err)                           // [us]
+   { uint8_t Bin;
+          if(Err<(-2000)) Bin=0;
+     else if(Err<(-1000)) Bin=1;
+     else if(Err<     0 ) Bin=2;
+     else if(Err<  1000 ) Bin=3;
+     else if(Err<  2000 ) Bin=4;
+     else if(Err<  4000 ) Bin=5;
+     else if(Err<  8000 ) Bin=6;
+     else                 Bin=7;
+     if(Hist[Bin]<0xFFFF) Hist[Bin]++; }
+
+} ;
+
+#endif // __PPS_H__
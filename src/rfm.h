@@ -9,6 +9,7 @@
 #include "ogn.h"
 #include "fanet.h"
 #include "paw.h"
+#include "manchester.h"
 
 class RFM_LoRa_Config
 { public:
@@ -86,18 +87,73 @@ class RFM_LoRa_RxPacket
 
 } ;
 
+class RFM_FSK_RxPktRaw              // raw OGN frame as captured in the radio callback: to be decoded later
+{ public:
+   static const uint8_t Bytes=52;   // [bytes] Manchester encoded packet
+   uint32_t Time;                   // [sec] Time slot
+   uint16_t msTime;                 // [ms] reception time since the PPS[Time]
+   uint8_t Channel;                 // [   ] channel where the packet has been recieved
+   uint8_t RSSI;                    // [-0.5dBm] receiver signal strength
+   uint8_t Chips[Bytes];            // as received from the RF chip
+} ;
+
+class RFM_FSK_TxFrame               // OGN or ADS-L frame ready for the radio: Manchester encoded, digital signature appended
+{ public:
+   static const uint8_t MaxBytes=2*26+68; // [bytes] encoded packet and the signature
+   const uint8_t *SYNC;             // SYNC of the protocol: selects the TX configuration
+   uint8_t Len;                     // [bytes] 0 = nothing to send
+   bool Armed;                      // the radio has been configured for this frame
+   uint8_t Chips[MaxBytes];         // as to be sent by the RF chip
+
+  public:
+   void Clear(void) { Len=0; Armed=0; }
+
+   uint8_t Encode(const uint8_t *SyncWord, const uint8_t *Data, uint8_t PktLen, const uint8_t *Sign=0, uint8_t SignLen=0)
+   { SYNC=SyncWord; Armed=0; Len=0;
+     for(uint8_t Idx=0; Idx<PktLen; Idx++)
+     { uint8_t Byte=Data[Idx];
+       Chips[Len++]=ManchesterEncode[Byte>>4];       // software manchester encode every byte
+       Chips[Len++]=ManchesterEncode[Byte&0x0F]; }
+     if(Sign)
+     { if(SignLen>MaxBytes-Len) SignLen=MaxBytes-Len;
+       memcpy(Chips+Len, Sign, SignLen); Len+=SignLen; } // the signature is not Manchester encoded
+     return Len; }
+} ;
+
 class RFM_FSK_RxPktData             // OGN packet received by the RF chip
 { public:
    static const uint8_t Bytes=26;   // [bytes] number of bytes in the packet
+   static const uint8_t Words=(Bytes+3)/4; // [words] same as 32-bit words
    uint32_t Time;                   // [sec] Time slot
    uint16_t msTime;                 // [ms] reception time since the PPS[Time]
    uint8_t Channel;                 // [   ] channel where the packet has been recieved
    uint8_t RSSI;                    // [-0.5dBm] receiver signal strength
-   uint8_t Data[Bytes];             // Manchester decoded data bits/bytes
-   uint8_t Err [Bytes];             // Manchester decoding errors
+   union
+   { uint8_t  Data[Bytes];          // Manchester decoded data bits/bytes
+     uint32_t DataWord[Words];      // same as 32-bit words for the LDPC decoder
+   } ;
+
+   union
+   { uint8_t  Err [Bytes];          // Manchester decoding errors
+     uint32_t ErrWord[Words];
+   } ;
 
   public:
 
+   void Manchester(const uint8_t *Chips)                // decode the 2*Bytes chips received into the data and error bytes
+   { for(uint8_t Idx=0; Idx<Bytes; Idx++)                // loop over packet bytes
+     { uint8_t ByteH = *Chips++;
+       ByteH = ManchesterDecode[ByteH]; uint8_t ErrH=ByteH>>4; ByteH&=0x0F; // decode manchester, detect (some) errors
+       uint8_t ByteL = *Chips++;
+       ByteL = ManchesterDecode[ByteL]; uint8_t ErrL=ByteL>>4; ByteL&=0x0F;
+       Data[Idx]=(ByteH<<4) | ByteL;
+       Err [Idx]=(ErrH <<4) | ErrL ; }
+   }
+
+   void Input(const RFM_FSK_RxPktRaw &Raw)              // take a raw frame: decode the Manchester and copy the reception info
+   { Time=Raw.Time; msTime=Raw.msTime; Channel=Raw.Channel; RSSI=Raw.RSSI;
+     Manchester(Raw.Chips); }
+
    void Print(void (*CONS_UART_Write)(char), uint8_t WithData=0) const
    { // uint8_t ManchErr = Count1s(RxPktErr, 26);
      Format_String(CONS_UART_Write, "RxPktData: ");
@@ -134,25 +190,92 @@ class RFM_FSK_RxPktData             // OGN packet received by the RF chip
        Count+=Count1s((uint8_t)((Data[Idx]^Corr[Idx])&(~Err[Idx])));
      return Count; }
 
+ template <class OGNx_Packet>
+  void setRxInfo(OGN_RxPacket<OGNx_Packet> &Packet, bool Correct) const // set reception info: corrected bytes must be already in the Packet
+  { uint8_t RxErr = ErrCount() + ErrCount(Packet.Packet.Byte());    // Manchester errors plus bits corrected by the FEC
+    if(RxErr>15) RxErr=15;
+    Packet.RxErr  = RxErr;
+    Packet.RxChan = Channel;
+    Packet.RxRSSI = RSSI;
+    Packet.Correct= Correct; }
+
  template <class OGNx_Packet>
   uint8_t Decode(OGN_RxPacket<OGNx_Packet> &Packet, LDPC_Decoder &Decoder, uint8_t Iter=32) const
-  { uint8_t Check=0;
+  { uint8_t Check=0; uint8_t Loops=0;
+#ifndef __AVR__
     uint8_t RxErr = ErrCount();                                // conunt Manchester decoding errors
+    if(RxErr<=2)                                               // few Manchester errors: try the syndrome first
+    { uint32_t Word[LDPC_Decoder::CodeWords];
+      memcpy(Word, DataWord, Bytes); Word[LDPC_Decoder::CodeWords-1]&=0xFFFF;
+      int8_t Corr=LDPC_CorrectSyndrome(Word, LDPC_Syndrome(Word)); // clean frame or 1-2 bits to correct
+      if(Corr>=0)
+      { uint8_t *Byte = (uint8_t *)Word;
+        uint8_t Flip=ErrCount(Byte);                           // corrected bits which were not flagged by Manchester
+        if(RxErr+Flip<=2)                                      // all together not more than two suspect bits
+        { memcpy(Packet.Packet.Byte(), Byte, Bytes);
+          Decoder.Stat.Syndrome[Corr]++;
+          setRxInfo(Packet, 1);
+          return 0; }
+      }
+    }
+#endif
     Decoder.Input(Data, Err);                                  // put data into the FEC decoder
-    for( ; Iter; Iter--)                                       // more loops is more chance to recover the packet
-    { Check=Decoder.ProcessChecks();                           // do an iteration
+    for( ; Loops<Iter; )                                       // more loops is more chance to recover the packet
+    { Check=Decoder.ProcessChecks(); Loops++;                  // do an iteration
       if(Check==0) break; }                                    // if FEC all fine: break
+    Decoder.Stat.Add(Loops, Check!=0);                         // count iterations needed
     Decoder.Output(Packet.Packet.Byte());                      // get corrected bytes into the OGN packet
-    RxErr += ErrCount(Packet.Packet.Byte());
-    if(RxErr>15) RxErr=15;
-    Packet.RxErr  = RxErr;
-    Packet.RxChan = Channel;
-    Packet.RxRSSI = RSSI;
-    Packet.Correct= Check==0;
+    setRxInfo(Packet, Check==0);
     return Check; }
 
 } ;
 
+template <uint8_t Entries=8>
+ class RFM_FSK_RxDupCache           // recently received frames: exact duplicates do not need to go through the FEC again
+{ public:
+   static const uint8_t MaxAge=4;   // [sec] forget frames older than that
+   static const uint8_t Free=0xFF;  // result code of an unused entry
+   uint32_t Hash  [Entries];        // hash of the data and error bytes
+   uint32_t Time  [Entries];        // [sec] when received
+   uint8_t  Result[Entries];        // 0 = decoded and accepted, other = failed
+   uint8_t  Ptr;                    // next entry to be replaced
+   uint32_t Hits;                   // [frames] found in the cache: the FEC was skipped
+   uint32_t Misses;                 // [frames] not found
+
+  public:
+   RFM_FSK_RxDupCache() { Clear(); Hits=0; Misses=0; }
+
+   void Clear(void)
+   { for(uint8_t Idx=0; Idx<Entries; Idx++) Result[Idx]=Free;
+     Ptr=0; }
+
+   static uint32_t calcHash(const RFM_FSK_RxPktData &RxPkt) // fast hash over the data and error words
+   { uint32_t Hash=0x811C9DC5;
+     for(uint8_t Idx=0; Idx<RxPkt.Words; Idx++)
+     { uint32_t Word = RxPkt.DataWord[Idx] ^ (RxPkt.ErrWord[Idx]<<1 | RxPkt.ErrWord[Idx]>>31);
+       if(Idx==RxPkt.Words-1) Word &= 0xFFFF;          // the last word has only 16 bits
+       Hash = (Hash^Word)*0x9E3779B1; Hash ^= Hash>>15; }
+     return Hash; }
+
+   int8_t Find(uint32_t FrameHash, uint32_t Now)      // return the result of the same frame or -1 when not found
+   { for(uint8_t Idx=0; Idx<Entries; Idx++)
+     { if(Result[Idx]==Free || Hash[Idx]!=FrameHash) continue;
+       if((Now-Time[Idx])>MaxAge) continue;
+       Hits++; return Result[Idx]; }
+     Misses++; return -1; }
+
+   void Add(uint32_t FrameHash, uint32_t Now, uint8_t FrameResult) // store the result of a decoded frame
+   { Hash[Ptr]=FrameHash; Time[Ptr]=Now; Result[Ptr]=FrameResult!=0;
+     Ptr++; if(Ptr>=Entries) Ptr=0; }
+
+   uint8_t Print(char *Out) const   // print: hits/misses
+   { uint8_t Len=0;
+     Len+=Format_UnsDec(Out+Len, Hits);
+     Out[Len++]='/'; Len+=Format_UnsDec(Out+Len, Misses);
+     Out[Len]=0; return Len; }
+
+} ;
+
 #if defined(WITH_RFM69) || defined(WITH_RFM95) || defined(WITH_SX1272) || defined(WITH_SX1262)
 
 // -----------------------------------------------------------------------------------------------------------------------
@@ -276,8 +399,6 @@ SX1262 setup calls
 
 #endif
 
-#include "manchester.h"
-
 class RFM_TRX
 { public:                             // hardware access functions
 